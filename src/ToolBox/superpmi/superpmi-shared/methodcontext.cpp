@@ -1456,6 +1456,7 @@ void MethodContext::repGetCallInfo(CORINFO_RESOLVED_TOKEN* pResolvedToken,
         pResult->stubLookup.runtimeLookup.indirectFirstOffset = value.stubLookup.runtimeLookup.indirectFirstOffset != 0;
         pResult->stubLookup.runtimeLookup.indirectSecondOffset =
             value.stubLookup.runtimeLookup.indirectSecondOffset != 0;
+        pResult->stubLookup.runtimeLookup.sizeOffset = (WORD)value.stubLookup.runtimeLookup.sizeOffset;
         for (int i                                       = 0; i < CORINFO_MAXINDIRECTIONS; i++)
             pResult->stubLookup.runtimeLookup.offsets[i] = (SIZE_T)value.stubLookup.runtimeLookup.offsets[i];
     }
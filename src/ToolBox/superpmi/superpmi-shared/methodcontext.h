@@ -237,6 +237,7 @@ public:
         DWORDLONG offsets[CORINFO_MAXINDIRECTIONS];
         DWORD     indirectFirstOffset;
         DWORD     indirectSecondOffset;
+        DWORD     sizeOffset;
     };
     struct Agnostic_CORINFO_LOOKUP
     {
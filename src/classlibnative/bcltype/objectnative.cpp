@@ -19,6 +19,7 @@
 #include "object.h"
 #include "comsynchronizable.h"
 #include "eeconfig.h"
+#include "win32threadpool.h"
 
 
 /********************************************************************/
@@ -284,7 +285,10 @@ FCIMPL3(FC_BOOL_RET, ObjectNative::WaitTimeout, CLR_BOOL exitContext, INT32 Time
     if ((Timeout < 0) && (Timeout != INFINITE_TIMEOUT))
         COMPlusThrowArgumentOutOfRange(W("millisecondsTimeout"), W("ArgumentOutOfRange_NeedNonNegNum"));
 
-    retVal = pThis->Wait(Timeout, exitContext);
+    {
+        ThreadpoolMgr::BlockingWaitHolder blockingWait(Timeout);
+        retVal = pThis->Wait(Timeout, exitContext);
+    }
 
     HELPER_METHOD_FRAME_END();
     FC_RETURN_BOOL(retVal);
@@ -20,6 +20,7 @@
 #include "daccess.h"
 #include "binder.h"
 #include "win32threadpool.h"
+#include "threadpoolrequest.h"
 
 #ifdef FEATURE_PAL            
 #include <dactablerva.h>
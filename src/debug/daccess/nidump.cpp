@@ -6340,7 +6340,6 @@ void NativeImageDumper::WriteFieldDictionaryLayout(const char * name,
     }
     m_display->StartVStructureWithOffset( name, offset, fieldSize );
     DisplayStartArray( "DictionaryLayouts", NULL, ALWAYS );
-    do
     {
         DisplayStartStructure( "DictionaryLayout", DPtrToPreferredAddr(layout),
                                sizeof(DictionaryLayout)
@@ -6348,10 +6347,10 @@ void NativeImageDumper::WriteFieldDictionaryLayout(const char * name,
                                * (layout->m_numSlots - 1), ALWAYS );
 
 
-        DisplayWriteFieldPointer( m_pNext, DataPtrToDisplay((TADDR)layout->m_pNext),
-                                  DictionaryLayout, ALWAYS );
         DisplayWriteFieldInt( m_numSlots, layout->m_numSlots,
                               DictionaryLayout, ALWAYS );
+        DisplayWriteFieldInt( m_numInitialSlots, layout->m_numInitialSlots,
+                              DictionaryLayout, ALWAYS );
         DisplayStartArrayWithOffset( m_slots, NULL, DictionaryLayout, ALWAYS );
         for( unsigned i = 0; i < layout->m_numSlots; ++i )
         {
@@ -6380,8 +6379,7 @@ void NativeImageDumper::WriteFieldDictionaryLayout(const char * name,
         }
         DisplayEndArray( "Total Dictionary Entries",  ALWAYS ); //m_slots
         DisplayEndStructure( ALWAYS ); //Layout
-        layout = PTR_DictionaryLayout(TO_TADDR(layout->m_pNext));
-    }while( layout != NULL );
+    }
     DisplayEndArray( "Total Dictionary Layouts", ALWAYS ); //DictionaryLayouts
 
 
@@ -7018,7 +7016,7 @@ NativeImageDumper::DumpMethodTable( PTR_MethodTable mt, const char * name,
                     PTR_DictionaryEntryLayout entryLayout(layout->GetEntryLayout(i));
 
                     //Dictionary::GetSlotAddr
-                    PTR_DictionaryEntry ent(currentDictionary->EntryAddr(mt->GetNumGenericArgs() + i));
+                    PTR_DictionaryEntry ent(currentDictionary->EntryAddr(mt->GetNumGenericArgs() + 1 + i));
 
                     DumpDictionaryEntry( "Entry", entryLayout->GetKind(), ent );
                 }
@@ -7962,13 +7960,12 @@ void NativeImageDumper::DumpMethodDesc( PTR_MethodDesc md, PTR_Module module )
             }
             else
             {
-                while( layout != NULL )
+                if( layout != NULL )
                 {
                     CoverageRead( PTR_TO_TADDR(layout),
                                   sizeof(DictionaryLayout)
                                   + sizeof(DictionaryEntryLayout)
                                   * (layout->m_numSlots - 1) );
-                    layout = PTR_DictionaryLayout(TO_TADDR(layout->m_pNext));
                 }
             }
         }
@@ -8598,13 +8595,12 @@ NativeImageDumper::DumpEEClassForMethodTable( PTR_MethodTable mt )
             }
             else
             {
-                while( layout != NULL )
+                if( layout != NULL )
                 {
                     CoverageRead( PTR_TO_TADDR(layout),
                                   sizeof(DictionaryLayout)
                                   + sizeof(DictionaryEntryLayout)
                                   * (layout->m_numSlots - 1) );
-                    layout = PTR_DictionaryLayout(TO_TADDR(layout->m_pNext));
                 }
             }
         }
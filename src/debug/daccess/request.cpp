@@ -12,6 +12,7 @@
 
 #include "stdafx.h"
 #include <win32threadpool.h>
+#include <threadpoolrequest.h>
 
 #include "typestring.h"
 #include <gccover.h>
@@ -270,10 +271,18 @@ ClrDataAccess::GetWorkRequestData(CLRDATA_ADDRESS addr, struct DacpWorkRequestDa
 
     SOSDacEnter();
 
-    WorkRequest *pRequest = PTR_WorkRequest(TO_TADDR(addr));
+    PTR_WorkRequest pRequest = PTR_WorkRequest(TO_TADDR(addr));
     workRequestData->Function = (TADDR)(pRequest->Function);
     workRequestData->Context = (TADDR)(pRequest->Context);
-    workRequestData->NextWorkRequest = (TADDR)(pRequest->next);
+
+    // The requests in the global queue are linked through next and are followed by the
+    // requests in the worker local queues, whose next field is stale.
+    bool isLocal;
+    PTR_WorkRequest pNextLocal = PerAppDomainTPCountList::GetUnmanagedTPCount()->GetNextLocalWorkRequest(pRequest, &isLocal);
+    if (isLocal || pRequest->next == NULL)
+        workRequestData->NextWorkRequest = PTR_CDADDR(pNextLocal);
+    else
+        workRequestData->NextWorkRequest = (TADDR)(pRequest->next);
 
     SOSDacLeave();
     return hr;
@@ -322,7 +331,16 @@ ClrDataAccess::GetThreadpoolData(struct DacpThreadpoolData *threadpoolData)
     threadpoolData->NumIdleWorkerThreads = counts.NumActive - counts.NumWorking;
     threadpoolData->NumRetiredWorkerThreads = counts.NumRetired;
 
-    threadpoolData->FirstUnmanagedWorkRequest = HOST_CDADDR(ThreadpoolMgr::WorkRequestHead);
+    // See GetWorkRequestData for how the requests in the worker local queues are reached
+    if (ThreadpoolMgr::WorkRequestHead != NULL)
+    {
+        threadpoolData->FirstUnmanagedWorkRequest = HOST_CDADDR(ThreadpoolMgr::WorkRequestHead);
+    }
+    else
+    {
+        bool foundPrevious;
+        threadpoolData->FirstUnmanagedWorkRequest = PTR_CDADDR(PerAppDomainTPCountList::GetUnmanagedTPCount()->GetNextLocalWorkRequest(NULL, &foundPrevious));
+    }
 
     threadpoolData->HillClimbingLog = dac_cast<TADDR>(&HillClimbingLog);
     threadpoolData->HillClimbingLogFirstIndex = HillClimbingLogFirstIndex;
@@ -344,17 +362,7 @@ ClrDataAccess::GetThreadpoolData(struct DacpThreadpoolData *threadpoolData)
     threadpoolData->CurrentLimitTotalCPThreads = (LONG)(counts.NumActive); //legacy: currently has no meaning
     threadpoolData->MinLimitTotalCPThreads = ThreadpoolMgr::MinLimitTotalCPThreads;
 
-    TADDR pEntry = DacGetTargetAddrForHostAddr(&ThreadpoolMgr::TimerQueue,true);
-    ThreadpoolMgr::LIST_ENTRY entry;
-    DacReadAll(pEntry,&entry,sizeof(ThreadpoolMgr::LIST_ENTRY),true);
-    TADDR node = (TADDR) entry.Flink;
-    threadpoolData->NumTimers = 0;
-    while (node && node != pEntry)
-    {
-        threadpoolData->NumTimers++;
-        DacReadAll(node,&entry,sizeof(ThreadpoolMgr::LIST_ENTRY),true);
-        node = (TADDR) entry.Flink;
-    }
+    threadpoolData->NumTimers = ThreadpoolMgr::TimerCount;
     
     threadpoolData->AsyncTimerCallbackCompletionFPtr = (CLRDATA_ADDRESS) GFN_TADDR(ThreadpoolMgr__AsyncTimerCallbackCompletion);
     SOSDacLeave();
@@ -15,6 +15,7 @@
 
 #include "../../vm/virtualcallstub.h"
 #include "../../vm/win32threadpool.h"
+#include "../../vm/threadpoolrequest.h"
 #include "../../vm/hillclimbing.h"
 #include "../../vm/codeman.h"
 #include "../../vm/eedbginterfaceimpl.h"
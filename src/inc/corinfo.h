@@ -217,11 +217,11 @@ TODO: Talk about initializing strutures before use
 #endif
 #endif
 
-SELECTANY const GUID JITEEVersionIdentifier = { /* d609bed1-7831-49fc-bd49-b6f054dd4d46 */
-    0xd609bed1,
-    0x7831,
-    0x49fc,
-    {0xbd, 0x49, 0xb6, 0xf0, 0x54, 0xdd, 0x4d, 0x46}
+SELECTANY const GUID JITEEVersionIdentifier = { /* 2c6b4ab7-f89d-45df-af41-b1ffc7c4a86f */
+    0x2c6b4ab7,
+    0xf89d,
+    0x45df,
+    {0xaf, 0x41, 0xb1, 0xff, 0xc7, 0xc4, 0xa8, 0x6f}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1332,6 +1332,7 @@ struct CORINFO_LOOKUP_KIND
 //
 #define CORINFO_MAXINDIRECTIONS 4
 #define CORINFO_USEHELPER ((WORD) 0xffff)
+#define CORINFO_NO_SIZE_CHECK ((WORD) 0xffff)
 
 struct CORINFO_RUNTIME_LOOKUP
 {
@@ -1351,6 +1352,11 @@ struct CORINFO_RUNTIME_LOOKUP
     // If set, test for null and branch to helper if null
     bool                    testForNull;
 
+    // If not CORINFO_NO_SIZE_CHECK, the offset of the size (in bytes) of the dictionary the last
+    // indirection goes through. The helper must be called instead of reading the slot if the
+    // size is not larger than the last offset (see code:DictionaryLayout in the runtime).
+    WORD                    sizeOffset;
+
     // If set, test the lowest bit and dereference if set (see code:FixupPointer)
     bool                    testForFixup;
 
@@ -52,7 +52,7 @@ public:
 
     #endif // !defined(_TARGET_X86_)
 
-        CORJIT_FLAG_UNUSED6                 = 13,
+        CORJIT_FLAG_GCPOLL_LOOPS            = 13, // Emit inlined GC polls at loop back edges only, rely on hijacking for returns
 
     #if defined(_TARGET_X86_) || defined(_TARGET_AMD64_)
 
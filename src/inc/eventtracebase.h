@@ -1190,6 +1190,7 @@ namespace ETW
                 static void SendResume(UINT32 newMethodCount);
                 static void SendBackgroundJitStart(UINT32 pendingMethodCount);
                 static void SendBackgroundJitStop(UINT32 pendingMethodCount, UINT32 jittedMethodCount);
+                static void SendBackgroundJitMethod(MethodDesc *pMethodDesc, UINT32 queueDurationMs, UINT32 jitDurationMs);
 #else
                 static bool IsEnabled() { return false; }
                 static void SendSettings() {}
@@ -147,6 +147,18 @@ public:
         LIMITED_METHOD_CONTRACT;
         SetValue(addr);
     }
+
+    // Atomically set the pointer to addr if it currently points to comparand, and return
+    // the value it pointed to before. Neither value can be NULL.
+    PTR_TYPE CompareExchangeValue(PTR_TYPE addr, PTR_TYPE comparand)
+    {
+        LIMITED_METHOD_CONTRACT;
+        PRECONDITION(addr != NULL);
+        PRECONDITION(comparand != NULL);
+        TADDR base = (TADDR)this;
+        TADDR delta = InterlockedCompareExchangeT(&m_delta, (TADDR)addr - base, (TADDR)comparand - base);
+        return dac_cast<PTR_TYPE>(base + delta);
+    }
 #endif
 
 #ifndef DACCESS_COMPILE
@@ -747,6 +759,14 @@ public:
         LIMITED_METHOD_CONTRACT;
         VolatileStore((PTR_TYPE *)(&m_ptr), addr);
     }
+
+    // Atomically set the pointer to addr if it currently points to comparand, and return
+    // the value it pointed to before.
+    PTR_TYPE CompareExchangeValue(PTR_TYPE addr, PTR_TYPE comparand)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return dac_cast<PTR_TYPE>(InterlockedCompareExchangeT(&m_ptr, dac_cast<TADDR>(addr), dac_cast<TADDR>(comparand)));
+    }
 #endif
 
     static TADDR GetRelativeMaybeNull(TADDR base, TADDR addr)
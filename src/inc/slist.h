@@ -53,8 +53,9 @@ struct SLink
 
         PTR_SLink pTemp = m_pNext;
 
-        m_pNext = PTR_SLink(pLinkToInsert);
+        // Link the new node up before publishing it to readers walking the list
         pLinkToInsert->m_pNext = pTemp;
+        VolatileStore(&m_pNext, PTR_SLink(pLinkToInsert));
     }
 
     // find pLink within the list starting at pHead
@@ -75,7 +76,9 @@ struct SLink
 		    if (pHead->m_pNext == pLink)
 		    {
 			    pFreeLink = pLink;
-			    pHead->m_pNext = pLink->m_pNext;
+			    // pLink->m_pNext is left alone, so a reader standing on pLink
+			    // can still carry on into the rest of the list
+			    VolatileStore(&pHead->m_pNext, pLink->m_pNext);
                 *ppPrior = pHead;
                 break;
 		    }
@@ -187,7 +190,8 @@ public:
             _ASSERTE(pObj != NULL);
             SLink *pLink = GetLink(pObj);
 
-            m_pTail->m_pNext = pLink;
+            // Publish pObj to readers walking the list only once it is initialized
+            VolatileStore(&m_pTail->m_pNext, PTR_SLink(pLink));
             m_pTail = pLink;
         }
         else 
@@ -206,7 +210,7 @@ public:
             SLink *pLink = GetLink(pObj);
             
             pLink->m_pNext = m_pHead->m_pNext;
-            m_pHead->m_pNext = pLink;
+            VolatileStore(&m_pHead->m_pNext, PTR_SLink(pLink));
         }
         else
         {// you instantiated this class asking only for InsertTail operations
@@ -220,7 +224,7 @@ public:
         SLink* pLink = m_pHead->m_pNext;
         if (pLink != NULL)
         {
-            m_pHead->m_pNext = pLink->m_pNext;
+            VolatileStore(&m_pHead->m_pNext, pLink->m_pNext);
         }
         // conditionally compiled, if the instantiated class
         // uses Insert Tail operations
@@ -240,7 +244,7 @@ public:
     T*	GetHead()
     {
         WRAPPER_NO_CONTRACT;
-        return GetObject(m_pHead->m_pNext);
+        return GetObject(VolatileLoad(&m_pHead->m_pNext));
     }
     
     T*	GetTail()
@@ -261,7 +265,7 @@ public:
         WRAPPER_NO_CONTRACT;
 
         _ASSERTE(pObj != NULL);
-        return GetObject(GetLink(pObj)->m_pNext);
+        return GetObject(VolatileLoad(&GetLink(pObj)->m_pNext));
     }
 
     T* FindAndRemove(T *pObj)
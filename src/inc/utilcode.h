@@ -5302,6 +5302,7 @@ struct SpinConstants
     DWORD dwBackoffFactor;
     DWORD dwRepetitions;
     DWORD dwMonitorSpinCount;
+    DWORD dwMonitorThinLockYieldCount;
 };
 
 extern SpinConstants g_SpinConstants;
@@ -3557,7 +3557,8 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     }
 #endif
 
-    opts.compGCPollType = GCPOLL_NONE;
+    opts.compGCPollType      = GCPOLL_NONE;
+    opts.compGCPollLoopsOnly = false;
     if (jitFlags->IsSet(JitFlags::JIT_FLAG_GCPOLL_CALLS))
     {
         opts.compGCPollType = GCPOLL_CALL;
@@ -3568,6 +3569,13 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
         assert(opts.compGCPollType == GCPOLL_NONE);
         opts.compGCPollType = GCPOLL_INLINE;
     }
+    else if (jitFlags->IsSet(JitFlags::JIT_FLAG_GCPOLL_LOOPS))
+    {
+        // make sure that the EE didn't set more than one flag.
+        assert(opts.compGCPollType == GCPOLL_NONE);
+        opts.compGCPollType      = GCPOLL_INLINE;
+        opts.compGCPollLoopsOnly = true;
+    }
 
 #ifdef PROFILING_SUPPORTED
 #ifdef UNIX_AMD64_ABI
@@ -4568,6 +4576,10 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         /* Unroll loops */
         optUnrollLoops();
         EndPhase(PHASE_UNROLL_LOOPS);
+
+        // Replace multiplications of loop iterators with derived induction variables.
+        optStrengthReduceLoops();
+        EndPhase(PHASE_STRENGTH_REDUCE_LOOPS);
     }
 
 #ifdef DEBUG
@@ -5768,6 +5768,13 @@ public:
 
     void optUnrollLoops(); // Unrolls loops (needs to have cost info)
 
+    // Replace multiplications of loop iterators by loop invariants with derived induction variables.
+    void optStrengthReduceLoops();
+    bool optCanStrengthReduceLoops();
+    void optStrengthReduceLoop(unsigned lnum);
+    static fgWalkPreFn optStrengthReduceCB;
+    static fgWalkPreFn optStrengthReduceAddrCB;
+
 protected:
     // This enumeration describes what is killed by a call.
 
@@ -6796,6 +6803,8 @@ public:
     bool optIsStackLocalInvariant(unsigned loopNum, unsigned lclNum);
     bool optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsNum);
     bool optReconstructArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsNum);
+    bool optExtractSpanIndex(GenTree* tree, SpanIndex* result);
+    bool optGetLoopCloningStride(LoopDsc* loop, int* pStride);
     bool optIdentifyLoopOptInfo(unsigned loopNum, LoopCloneContext* context);
     static fgWalkPreFn optCanOptimizeByLoopCloningVisitor;
     fgWalkResult optCanOptimizeByLoopCloning(GenTree* tree, LoopCloneVisitorInfo* info);
@@ -8520,6 +8529,10 @@ public:
 #endif
 
         GCPollType compGCPollType;
+
+        // Only poll on back edges: returns rely on the VM hijacking the return address, as they do when not
+        // polling, and loops get a poll rather than making the method fully interruptible.
+        bool compGCPollLoopsOnly;
     } opts;
 
 #ifdef ALT_JIT
@@ -3470,9 +3470,9 @@ void Compiler::fgMarkGCPollBlocks()
 
     BasicBlock* block;
 
-    // Return blocks always need GC polls.  In addition, all back edges (including those from switch
-    // statements) need GC polls.  The poll is on the block with the outgoing back edge (or ret), rather than
-    // on the destination or on the edge itself.
+    // Return blocks always need GC polls, unless the VM only asked for polls in loops.  In addition, all back
+    // edges (including those from switch statements) need GC polls.  The poll is on the block with the outgoing
+    // back edge (or ret), rather than on the destination or on the edge itself.
     for (block = fgFirstBB; block; block = block->bbNext)
     {
         bool blockNeedsPoll = false;
@@ -3484,7 +3484,7 @@ void Compiler::fgMarkGCPollBlocks()
                 break;
 
             case BBJ_RETURN:
-                blockNeedsPoll = true;
+                blockNeedsPoll = !opts.compGCPollLoopsOnly;
                 break;
 
             case BBJ_SWITCH:
@@ -19006,9 +19006,9 @@ void Compiler::fgSetBlockOrder()
             // using polls, all return blocks meeting this criteria would have
             // already added polls and then marked as being GC safe
             // (BBF_GC_SAFE_POINT). Thus we can only reach here when *NOT*
-            // using GC polls, but instead relying on the JIT to generate
-            // fully-interruptible code.
-            noway_assert(GCPOLL_NONE == opts.compGCPollType);
+            // using GC polls, or only polling in loops, but instead relying
+            // on the JIT to generate fully-interruptible code.
+            noway_assert((GCPOLL_NONE == opts.compGCPollType) || opts.compGCPollLoopsOnly);
 
             // This tail call might combine with other tail calls to form a
             // loop.  Thus we need to either add a poll, or make the method
@@ -2051,6 +2051,8 @@ GenTree* Compiler::getRuntimeContextTree(CORINFO_RUNTIME_LOOKUP_KIND kind)
       2b. pLookup->testForNull == true : Dereference the instantiation-specific handle.
           If it is non-NULL, it is the handle required. Else, call a helper
           to lookup the handle.
+      2c. pLookup->sizeOffset != CORINFO_NO_SIZE_CHECK : As 2b, but first check that the
+          dictionary is large enough to contain the slot, and call the helper if it is not.
  */
 
 GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken,
@@ -2091,7 +2093,8 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
                                    nullptr DEBUGARG("impRuntimeLookup slot"));
     }
 
-    GenTree* indOffTree = nullptr;
+    GenTree* indOffTree    = nullptr;
+    GenTree* lastIndOfTree = nullptr;
 
     // Applied repeated indirections
     for (WORD i = 0; i < pRuntimeLookup->indirections; i++)
@@ -2114,6 +2117,13 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
             slotPtrTree = gtNewOperNode(GT_ADD, TYP_I_IMPL, indOffTree, slotPtrTree);
         }
 
+        // Keep the dictionary pointer around for the size check
+        if ((i == pRuntimeLookup->indirections - 1) && (pRuntimeLookup->sizeOffset != CORINFO_NO_SIZE_CHECK))
+        {
+            lastIndOfTree = impCloneExpr(slotPtrTree, &slotPtrTree, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL,
+                                         nullptr DEBUGARG("impRuntimeLookup dictionary"));
+        }
+
         if (pRuntimeLookup->offsets[i] != 0)
         {
             slotPtrTree =
@@ -2124,6 +2134,8 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
     // No null test required
     if (!pRuntimeLookup->testForNull)
     {
+        assert(pRuntimeLookup->sizeOffset == CORINFO_NO_SIZE_CHECK);
+
         if (pRuntimeLookup->indirections == 0)
         {
             return slotPtrTree;
@@ -2173,6 +2185,29 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
     GenTree* handle = gtNewOperNode(GT_IND, TYP_I_IMPL, slotPtrTree);
     handle->gtFlags |= GTF_IND_NONFAULTING;
 
+    if (pRuntimeLookup->sizeOffset != CORINFO_NO_SIZE_CHECK)
+    {
+        // The dictionary may predate the slot, so only read the slot if the dictionary
+        // is large enough and otherwise treat it as empty so the helper is called.
+        assert(lastIndOfTree != nullptr);
+
+        GenTree* sizeAddr =
+            gtNewOperNode(GT_ADD, TYP_I_IMPL, lastIndOfTree, gtNewIconNode(pRuntimeLookup->sizeOffset, TYP_I_IMPL));
+        GenTree* sizeValue = gtNewOperNode(GT_IND, TYP_I_IMPL, sizeAddr);
+        sizeValue->gtFlags |= GTF_IND_NONFAULTING;
+
+        GenTree* slotOffset = gtNewIconNode(pRuntimeLookup->offsets[pRuntimeLookup->indirections - 1], TYP_I_IMPL);
+        GenTree* sizeCheck  = gtNewOperNode(GT_GT, TYP_INT, sizeValue, slotOffset);
+
+        GenTree* sizeColon = new (this, GT_COLON) GenTreeColon(TYP_I_IMPL, handle, gtNewIconNode(0, TYP_I_IMPL));
+        GenTree* sizeQmark = gtNewQmarkNode(TYP_I_IMPL, sizeCheck, sizeColon);
+
+        unsigned slotLclNum = lvaGrabTemp(true DEBUGARG("impRuntimeLookup size check"));
+        impAssignTempGen(slotLclNum, sizeQmark, (unsigned)CHECK_SPILL_NONE);
+
+        handle = gtNewLclvNode(slotLclNum, TYP_I_IMPL);
+    }
+
     GenTree* handleCopy = impCloneExpr(handle, &handle, NO_CLASS_HANDLE, (unsigned)CHECK_SPILL_ALL,
                                        nullptr DEBUGARG("impRuntimeLookup typehandle"));
 
@@ -36,6 +36,8 @@ CONFIG_INTEGER(JitBreakOnMinOpts, W("JITBreakOnMinOpts"), 0) // Halt if jit swit
 CONFIG_INTEGER(JitBreakOnUnsafeCode, W("JitBreakOnUnsafeCode"), 0)
 CONFIG_INTEGER(JitCanUseSSE2, W("JitCanUseSSE2"), -1)
 CONFIG_INTEGER(JitCloneLoops, W("JitCloneLoops"), 1) // If 0, don't clone. Otherwise clone loops for optimizations.
+CONFIG_INTEGER(JitStrengthReduceLoops, W("JitStrengthReduceLoops"), 1) // If 0, don't strength reduce derived
+                                                                       // induction variables in loops.
 CONFIG_INTEGER(JitDebugLogLoopCloning, W("JitDebugLogLoopCloning"), 0) // In debug builds log places where loop cloning
                                                                        // optimizations are performed on the fast path.
 CONFIG_INTEGER(JitDefaultFill, W("JitDefaultFill"), 0xdd) // In debug builds, initialize the memory allocated by the nra
@@ -391,6 +393,10 @@ CONFIG_INTEGER(JitEnableRemoveEmptyTry, W("JitEnableRemoveEmptyTry"), 0)
 #endif // defined(FEATURE_CORECLR)
 #endif // DEBUG
 
+// Give spilled lclVars a register on entry to loop headers hotter than their allocated predecessor,
+// see LinearScan::allocateSpilledLiveIns. Currently not enabled by default.
+CONFIG_INTEGER(JitReloadSpilledLiveIns, W("JitReloadSpilledLiveIns"), 0)
+
 // Overall master enable for Guarded Devirtualization. Currently not enabled by default.
 CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualization"), 0)
 
@@ -39,7 +39,7 @@ public:
 
     #endif // !defined(_TARGET_X86_)
 
-        JIT_FLAG_UNUSED6                 = 13,
+        JIT_FLAG_GCPOLL_LOOPS            = 13, // Emit inlined GC polls at loop back edges only, rely on hijacking for returns
 
     #if defined(_TARGET_X86_) || defined(_TARGET_AMD64_)
 
@@ -235,6 +235,7 @@ public:
         FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_MIN_OPT, JIT_FLAG_MIN_OPT);
         FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_GCPOLL_CALLS, JIT_FLAG_GCPOLL_CALLS);
         FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_MCJIT_BACKGROUND, JIT_FLAG_MCJIT_BACKGROUND);
+        FLAGS_EQUAL(CORJIT_FLAGS::CORJIT_FLAG_GCPOLL_LOOPS, JIT_FLAG_GCPOLL_LOOPS);
 
 #if defined(_TARGET_X86_)
 
@@ -61,6 +61,12 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
         marked on them.
 
     Limitations
+        - Increasing loops ("i < limit" or "i <= limit") and decreasing loops ("i > limit" or
+        "i >= limit") with any constant stride are handled. For strides other than 1 an extra
+        condition guarantees that stepping the iterator past the limit cannot overflow.
+        - Span accesses are checked against a local length, so they contribute cloning
+        conditions but no deref conditions. A loop that only has span candidates gets a
+        single condition block.
         - For array based optimizations the loop choice condition is checked
         before the loop body. This implies that the loop initializer statement
         has not executed at the time of the check. So any loop cloning condition
@@ -121,6 +127,33 @@ struct ArrIndex
 #endif
 };
 
+/**
+ *
+ *  Represents a bounds checked access where both the index and the length are
+ *  local variables, as produced by the Span<T> and ReadOnlySpan<T> indexers once
+ *  the span struct has been promoted. Unlike arrays there is nothing to dereference
+ *  to obtain the length, so no null checks are needed to hoist the check.
+ *
+ */
+struct SpanIndex
+{
+    unsigned    lenLcl;   // The length local num
+    unsigned    indLcl;   // The index local num
+    GenTree*    bndsChk;  // The GT_COMMA node whose first operand is the bounds check
+    BasicBlock* useBlock; // Block where the access occurs
+
+    SpanIndex() : lenLcl(BAD_VAR_NUM), indLcl(BAD_VAR_NUM), bndsChk(nullptr), useBlock(nullptr)
+    {
+    }
+
+#ifdef DEBUG
+    void Print()
+    {
+        printf("V%02d (length V%02d)", indLcl, lenLcl);
+    }
+#endif
+};
+
 // Forward declarations
 #define LC_OPT(en) struct en##OptInfo;
 #include "loopcloningopts.h"
@@ -135,6 +168,8 @@ struct ArrIndex
  *  loop can be cloned.
  *  LcArrIndexOptInfo is a jagged array optimization for which the loop
  *  can be cloned.
+ *  LcSpanOptInfo is a span (local length) optimization for which the loop
+ *  can be cloned.
  *
  *  So LcOptInfo represents any type of optimization opportunity that
  *  occurs in a loop and the metadata for the optimization is stored in
@@ -220,6 +255,21 @@ struct LcJaggedArrayOptInfo : public LcOptInfo
     }
 };
 
+/**
+ *
+ * Optimization info for a span or any other access checked against a local length.
+ */
+struct LcSpanOptInfo : public LcOptInfo
+{
+    SpanIndex    spanIndex; // SpanIndex representation of the access.
+    GenTreeStmt* stmt;      // "stmt" where the optimization opportunity occurs.
+
+    LcSpanOptInfo(const SpanIndex& spanIndex, GenTreeStmt* stmt)
+        : LcOptInfo(this, LcSpan), spanIndex(spanIndex), stmt(stmt)
+    {
+    }
+};
+
 /**
  *
  * Symbolic representation of a.length, or a[i][j].length or a[i,j].length and so on.
@@ -12,5 +12,6 @@
 // Types of Loop Cloning based optimizations.
 LC_OPT(LcMdArray)
 LC_OPT(LcJaggedArray)
+LC_OPT(LcSpan)
 
 #undef LC_OPT
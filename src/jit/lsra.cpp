@@ -4737,6 +4737,9 @@ void LinearScan::processBlockStartLocations(BasicBlock* currentBlock)
             // 2a. If the next RefPosition is marked as a copyReg, we need to retain the allocated register.  This is
             //     because the copyReg RefPosition will not have recorded the "home" register, yet downstream
             //     RefPositions rely on the correct "home" register.
+            // 2b. If the next RefPosition is marked reloadAtBlockEntry, the variable was already on the stack at the
+            //     end of predBB, but was given a register on entry to this block by allocateSpilledLiveIns(), and
+            //     resolution will load it on the incoming edge(s). We need to retain the allocated register.
             // 3. This variable was spilled before we reached the end of predBB.  In this case, both targetReg and
             //    predVarToRegMap[varIndex] will be REG_STK, and the next RefPosition will have been marked
             //    as reload during allocation time if necessary (note that by the time we actually reach the next
@@ -4752,6 +4755,10 @@ void LinearScan::processBlockStartLocations(BasicBlock* currentBlock)
                     assert(getVarReg(predVarToRegMap, varIndex) == targetReg ||
                            getLsraBlockBoundaryLocations() == LSRA_BLOCK_BOUNDARY_ROTATE);
                 }
+                else if (nextRefPosition->reloadAtBlockEntry && (nextRefPosition->bbNum == currentBlock->bbNum))
+                {
+                    // case #2b above - retain targetReg.
+                }
                 else if (!nextRefPosition->copyReg)
                 {
                     // case #2 above.
@@ -4906,6 +4913,145 @@ void LinearScan::processBlockStartLocations(BasicBlock* currentBlock)
         }
 #endif // _TARGET_ARM_
     }
+
+    if (!allocationPassComplete)
+    {
+        allocateSpilledLiveIns(currentBlock, inVarToRegMap, liveRegs);
+    }
+}
+
+//------------------------------------------------------------------------
+// allocateSpilledLiveIns: Give a register on entry to a loop header to spilled lclVars that are
+//                         used in that block.
+//
+// Arguments:
+//    currentBlock  - the BasicBlock we are about to allocate registers for
+//    inVarToRegMap - the live-in locations for currentBlock
+//    liveRegs      - the registers occupied by live-in lclVars
+//
+// Return Value:
+//    None
+//
+// Notes:
+//    The live-in locations of a block are taken from a single predecessor that has already been
+//    allocated. If a lclVar was spilled on that path (e.g. across a call on a cold path), it will be
+//    on the stack on entry to the block and is reloaded at its first use. If the block is a loop
+//    header, resolution must then store it again on the backedge, so that both the store and the
+//    reload end up inside the loop.
+//    When the block is hotter than the selected predecessor, and still has a predecessor that has
+//    not been allocated (i.e. a backedge), we instead give such lclVars a free register on entry.
+//    Resolution will then place the reload on the (colder) incoming edge from the selected predecessor.
+//    This is only done for a lclVar whose next reference is a use in this block, and only when a
+//    register is free up to that use. The interval is marked as split, so that resolution and the
+//    spill/copy bookkeeping used by codegen treat the new block start location like any other
+//    split point.
+//    This is off unless JitReloadSpilledLiveIns is set.
+//
+void LinearScan::allocateSpilledLiveIns(BasicBlock* currentBlock, VarToRegMap inVarToRegMap, regMaskTP liveRegs)
+{
+    assert(enregisterLocalVars && !allocationPassComplete);
+
+    if (JitConfig.JitReloadSpilledLiveIns() == 0)
+    {
+        return;
+    }
+
+#ifdef DEBUG
+    if (getLsraBlockBoundaryLocations() != LSRA_BLOCK_BOUNDARY_PRED)
+    {
+        return;
+    }
+#endif // DEBUG
+
+    unsigned predBBNum = blockInfo[currentBlock->bbNum].predBBNum;
+    if ((predBBNum == 0) || (blockInfo[currentBlock->bbNum].weight <= blockInfo[predBBNum].weight))
+    {
+        return;
+    }
+
+    bool hasUnallocatedPred = false;
+    for (flowList* pred = currentBlock->bbPreds; pred != nullptr; pred = pred->flNext)
+    {
+        if (!isBlockVisited(pred->flBlock))
+        {
+            hasUnallocatedPred = true;
+            break;
+        }
+    }
+    if (!hasUnallocatedPred)
+    {
+        return;
+    }
+
+    VarSetOps::Iter iter(compiler, currentLiveVars);
+    unsigned        varIndex = 0;
+    while (iter.NextElem(&varIndex))
+    {
+        unsigned varNum = compiler->lvaTrackedToVarNum[varIndex];
+        if (!compiler->lvaTable[varNum].lvLRACandidate || (getVarReg(inVarToRegMap, varIndex) != REG_STK))
+        {
+            continue;
+        }
+
+        Interval*    interval        = getIntervalForLocalVar(varIndex);
+        RefPosition* nextRefPosition = interval->getNextRefPosition();
+        if (interval->isActive || !interval->isSpilled || (interval->recentRefPosition == nullptr) ||
+            (nextRefPosition->refType != RefTypeUse) || (nextRefPosition->bbNum != currentBlock->bbNum) ||
+            nextRefPosition->isFixedRegRef || varTypeIsSIMD(interval->registerType))
+        {
+            continue;
+        }
+#ifdef _TARGET_ARM_
+        if (interval->registerType == TYP_DOUBLE)
+        {
+            continue;
+        }
+#endif // _TARGET_ARM_
+
+        // Find a register that is free up to the use, favoring the preferences of the interval.
+        regMaskTP candidates  = allRegs(interval->registerType) & ~liveRegs;
+        regMaskTP preferences = interval->registerPreferences & candidates;
+        regNumber foundReg    = REG_NA;
+        while (candidates != RBM_NONE)
+        {
+            regMaskTP candidateBit = genFindLowestBit(candidates);
+            candidates &= ~candidateBit;
+            RegRecord* physRegRecord = getRegisterRecord(genRegNumFromMask(candidateBit));
+            if ((physRegRecord->assignedInterval != nullptr) || physRegRecord->isBusyUntilNextKill ||
+                (physRegRecord->getNextRefLocation() <= nextRefPosition->nodeLocation))
+            {
+                continue;
+            }
+            if ((foundReg == REG_NA) || ((preferences & candidateBit) != RBM_NONE))
+            {
+                foundReg = physRegRecord->regNum;
+                if ((preferences & candidateBit) != RBM_NONE)
+                {
+                    break;
+                }
+            }
+        }
+        if (foundReg == REG_NA)
+        {
+            continue;
+        }
+
+        JITDUMP("  V%02u: allocated %s on entry to " FMT_BB ", reloaded on entry from " FMT_BB "\n", varNum,
+                getRegName(foundReg), currentBlock->bbNum, predBBNum);
+
+        // The interval now lives on the stack at the end of the predecessor and in a register at the
+        // start of this block, so it is split at this boundary just like a rotated block start location.
+        assignPhysReg(getRegisterRecord(foundReg), interval);
+        setIntervalAsSplit(interval);
+        setVarReg(inVarToRegMap, varIndex, foundReg);
+        liveRegs |= genRegMask(foundReg);
+        nextRefPosition->reloadAtBlockEntry = true;
+        if (!interval->recentRefPosition->copyReg &&
+            (interval->recentRefPosition->registerAssignment != genRegMask(foundReg)))
+        {
+            nextRefPosition->outOfOrder = true;
+        }
+    }
 }
 
 //------------------------------------------------------------------------
@@ -8873,6 +9019,10 @@ void RefPosition::dump()
     {
         printf(" outOfOrder");
     }
+    if (this->reloadAtBlockEntry)
+    {
+        printf(" blockEntryReload");
+    }
 
     if (this->RegOptional())
     {
@@ -969,6 +969,7 @@ private:
 
     // Record variable locations at start/end of block
     void processBlockStartLocations(BasicBlock* current);
+    void allocateSpilledLiveIns(BasicBlock* currentBlock, VarToRegMap inVarToRegMap, regMaskTP liveRegs);
     void processBlockEndLocations(BasicBlock* current);
 
 #ifdef _TARGET_ARM_
@@ -1989,6 +1990,12 @@ public:
     // register from a predecessor that is not the most recently allocated BasicBlock.
     unsigned char outOfOrder : 1;
 
+    // reloadAtBlockEntry is marked on the first (use) RefPosition of a spilled lclVar in a block
+    // when the lclVar was given a register on entry to that block, even though it is on the stack
+    // at the end of the predecessor. The load is then placed by resolution on the incoming edge(s)
+    // rather than at this RefPosition.
+    unsigned char reloadAtBlockEntry : 1;
+
 #ifdef DEBUG
     // Minimum number registers that needs to be ensured while
     // constraining candidates for this ref position under
@@ -2019,6 +2026,7 @@ public:
         , isLocalDefUse(false)
         , delayRegFree(false)
         , outOfOrder(false)
+        , reloadAtBlockEntry(false)
 #ifdef DEBUG
         , minRegCandidateCount(1)
         , rpNum(0)
@@ -3914,6 +3914,531 @@ void Compiler::optUnrollLoops()
 #pragma warning(pop)
 #endif
 
+// Maximum number of derived induction variables introduced for a single loop;
+// each one adds a register that is live across the whole loop.
+#define MAX_DERIVED_IVS_PER_LOOP 4
+
+struct optDerivedIV
+{
+    unsigned mulLcl;  // invariant local multiplier, or BAD_VAR_NUM if the multiplier is a constant
+    ssize_t  mulCns;  // constant multiplier, valid if "mulLcl" is BAD_VAR_NUM
+    unsigned tempLcl; // the temp holding "iv * multiplier"
+};
+
+struct optStrengthReduceDsc
+{
+    Compiler*                          pCompiler;
+    unsigned                           loopNum;
+    unsigned                           ivLclNum;
+    int                                stride;
+    JitExpandArrayStack<optDerivedIV>* derivedIVs;
+    unsigned                           arrLcl;   // the array bounding the loop, or BAD_VAR_NUM
+    unsigned                           ptrLcl;   // the byref temp holding "arr + iv * elemSize"
+    unsigned                           elemSize; // valid if "ptrLcl" is not BAD_VAR_NUM
+    unsigned                           replaced;
+};
+
+//------------------------------------------------------------------------
+// optStrengthReduceLoops: Replace multiplications of loop iterators by loop
+//      invariant values with new induction variables stepped by addition.
+//
+// Notes:
+//      For an iterator loop "for (i = init; i RELOP limit; i += stride)" the
+//      expression "i * m", where "m" is a constant or a local not assigned in
+//      the loop, is a derived induction variable that advances by "stride * m"
+//      on every iteration. For each such (i, m) pair we introduce a temp "t",
+//      set "t = i * m" at the end of the loop head, add "t = t + stride * m"
+//      right after the iterator is stepped, and replace every "i * m" in the
+//      loop body by "t". Since "t" is updated right next to the iterator, the
+//      relation "t == i * m" holds at every use in the loop.
+//
+//      Only TYP_INT multiplications without overflow checks are rewritten, so
+//      the wrapping arithmetic of "t" matches the original expression exactly.
+//      Multipliers that codegen already handles without a multiply (powers of
+//      two are morphed into shifts; 3, 5 and 9 become an LEA) are left alone.
+//
+//      Array walks "for (i = 0; i < a.Length; i += stride)" additionally get
+//      a pointer "p = a + i * elemSize" stepped by "stride * elemSize", and
+//      the element accesses "a[i]" address "p + elemOffset" instead of
+//      widening and scaling "i" on every iteration (see optStrengthReduceAddrCB).
+//
+//      The iterator itself stays: the bounds checks and the loop test still
+//      use it. Replacing the test by a pointer comparison would only pay off
+//      once range check elimination has removed the bounds checks, which runs
+//      later, so redundant iterators are not eliminated here.
+//
+//      This runs before local var ref counts are computed, so new temps and
+//      trees need no ref count updates.
+//
+void Compiler::optStrengthReduceLoops()
+{
+    JITDUMP("\n*************** In optStrengthReduceLoops()\n");
+
+    if ((optLoopCount == 0) || !optCanStrengthReduceLoops())
+    {
+        return;
+    }
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        optStrengthReduceLoop(lnum);
+    }
+}
+
+//------------------------------------------------------------------------
+// optCanStrengthReduceLoops: Use the environment flag to determine whether
+//      induction variable strength reduction is allowed to be performed.
+//
+// Return Value:
+//      Returns true unless COMPlus_JitStrengthReduceLoops is set to 0 in
+//      debug builds.
+//
+bool Compiler::optCanStrengthReduceLoops()
+{
+    unsigned strengthReduceFlag = 1;
+#ifdef DEBUG
+    strengthReduceFlag = JitConfig.JitStrengthReduceLoops();
+#endif
+    return (strengthReduceFlag != 0);
+}
+
+//------------------------------------------------------------------------
+// optStrengthReduceLoop: Strength reduce the derived induction variables of
+//      a single loop.
+//
+// Arguments:
+//      lnum - the loop to transform
+//
+void Compiler::optStrengthReduceLoop(unsigned lnum)
+{
+    LoopDsc* loop = &optLoopTable[lnum];
+
+    const unsigned requiredFlags = LPFLG_ITER | LPFLG_DO_WHILE;
+    if (((loop->lpFlags & requiredFlags) != requiredFlags) || ((loop->lpFlags & LPFLG_REMOVED) != 0))
+    {
+        return;
+    }
+
+    int stride;
+    switch (loop->lpIterOper())
+    {
+        case GT_ADD:
+            stride = loop->lpIterConst();
+            break;
+        case GT_SUB:
+            stride = -loop->lpIterConst();
+            break;
+        default:
+            return;
+    }
+
+    unsigned   ivLclNum = loop->lpIterVar();
+    LclVarDsc* ivVarDsc = &lvaTable[ivLclNum];
+    if ((ivVarDsc->lvType != TYP_INT) || ivVarDsc->lvAddrExposed || ((loop->lpIterTree->gtFlags & GTF_OVERFLOW) != 0))
+    {
+        return;
+    }
+
+    BasicBlock* head   = loop->lpHead;
+    BasicBlock* first  = loop->lpFirst;
+    BasicBlock* bottom = loop->lpBottom;
+    BasicBlock* entry  = loop->lpEntry;
+
+    // The initial values are computed at the end of the head, so it must be the only
+    // way into the loop.
+    for (flowList* pred = entry->bbPreds; pred != nullptr; pred = pred->flNext)
+    {
+        if ((pred->flBlock != head) && !loop->lpContains(pred->flBlock))
+        {
+            JITDUMP("L%02u: entry " FMT_BB " has a predecessor other than the head\n", lnum, entry->bbNum);
+            return;
+        }
+    }
+    if (!BasicBlock::sameEHRegion(head, entry))
+    {
+        return;
+    }
+
+    // The step must be the only definition of the iterator in the loop.
+    if (optIsVarAssigned(first, bottom, loop->lpIterTree, ivLclNum))
+    {
+        JITDUMP("L%02u: V%02u is assigned in the loop other than by its step\n", lnum, ivLclNum);
+        return;
+    }
+
+    // Find the statement stepping the iterator.
+    BasicBlock*  incrBlock = nullptr;
+    GenTreeStmt* incrStmt  = nullptr;
+    for (BasicBlock* block = first; (block != bottom->bbNext) && (incrStmt == nullptr); block = block->bbNext)
+    {
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt != nullptr; stmt = stmt->getNextStmt())
+        {
+            if (stmt->gtStmtExpr == loop->lpIterTree)
+            {
+                incrBlock = block;
+                incrStmt  = stmt;
+                break;
+            }
+        }
+    }
+    if (incrStmt == nullptr)
+    {
+        return;
+    }
+
+    JitExpandArrayStack<optDerivedIV> derivedIVs(getAllocator(CMK_LoopOpt));
+    optStrengthReduceDsc              desc;
+    desc.pCompiler  = this;
+    desc.loopNum    = lnum;
+    desc.ivLclNum   = ivLclNum;
+    desc.stride     = stride;
+    desc.derivedIVs = &derivedIVs;
+    desc.arrLcl     = BAD_VAR_NUM;
+    desc.ptrLcl     = BAD_VAR_NUM;
+    desc.elemSize   = 0;
+    desc.replaced   = 0;
+
+    // A pointer into the array is only kept in bounds if the iterator starts at zero and
+    // the loop exits as soon as it reaches the length of that same, unmodified array.
+    const unsigned arrayWalkFlags = LPFLG_CONST_INIT | LPFLG_ARRLEN_LIMIT;
+    ArrIndex       arrIndex(getAllocator(CMK_LoopOpt));
+    if ((stride > 0) && ((loop->lpFlags & arrayWalkFlags) == arrayWalkFlags) && (loop->lpConstInit == 0) &&
+        (loop->lpTestOper() == GT_LT) && loop->lpArrLenLimit(this, &arrIndex) && (arrIndex.rank == 0) &&
+        !lvaVarAddrExposed(arrIndex.arrLcl) && !optIsVarAssigned(first, bottom, nullptr, arrIndex.arrLcl))
+    {
+        desc.arrLcl = arrIndex.arrLcl;
+    }
+
+    for (BasicBlock* block = first; block != bottom->bbNext; block = block->bbNext)
+    {
+        for (GenTreeStmt* stmt = block->firstStmt(); stmt != nullptr; stmt = stmt->getNextStmt())
+        {
+            unsigned replacedBefore = desc.replaced;
+            fgWalkTreePre(&stmt->gtStmtExpr, optStrengthReduceCB, &desc);
+            if (desc.arrLcl != BAD_VAR_NUM)
+            {
+                fgWalkTreePre(&stmt->gtStmtExpr, optStrengthReduceAddrCB, &desc);
+            }
+            if (desc.replaced != replacedBefore)
+            {
+                gtSetStmtInfo(stmt);
+                if (fgStmtListThreaded)
+                {
+                    fgSetStmtSeq(stmt);
+                }
+            }
+        }
+    }
+
+    if ((derivedIVs.Size() == 0) && (desc.ptrLcl == BAD_VAR_NUM))
+    {
+        return;
+    }
+
+    // Initialize each derived IV at the end of the head, and step it right after the iterator.
+    GenTreeStmt* stepAfter = incrStmt;
+
+    if (desc.ptrLcl != BAD_VAR_NUM)
+    {
+        GenTree* index = gtNewLclvNode(ivLclNum, TYP_INT);
+#ifdef _TARGET_64BIT_
+        index = gtNewCastNode(TYP_I_IMPL, index, false, TYP_I_IMPL);
+#endif
+        GenTree* offset   = gtNewOperNode(GT_MUL, TYP_I_IMPL, index, gtNewIconNode(desc.elemSize, TYP_I_IMPL));
+        GenTree* initAddr = gtNewOperNode(GT_ADD, TYP_BYREF, gtNewLclvNode(desc.arrLcl, TYP_REF), offset);
+        GenTreeStmt* initStmt = fgNewStmtFromTree(gtNewTempAssign(desc.ptrLcl, initAddr));
+        fgInsertStmtNearEnd(head, initStmt);
+        gtSetStmtInfo(initStmt);
+        if (fgStmtListThreaded)
+        {
+            fgSetStmtSeq(initStmt);
+        }
+
+        GenTree*     step     = gtNewIconNode((ssize_t)stride * desc.elemSize, TYP_I_IMPL);
+        GenTree*     stepAdd  = gtNewOperNode(GT_ADD, TYP_BYREF, gtNewLclvNode(desc.ptrLcl, TYP_BYREF), step);
+        GenTreeStmt* stepStmt = fgNewStmtFromTree(gtNewTempAssign(desc.ptrLcl, stepAdd));
+        stepAfter             = fgInsertStmtAfter(incrBlock, stepAfter, stepStmt);
+        gtSetStmtInfo(stepStmt);
+        if (fgStmtListThreaded)
+        {
+            fgSetStmtSeq(stepStmt);
+        }
+
+        JITDUMP("L%02u: pointer IV V%02u walks V%02u with V%02u\n", lnum, desc.ptrLcl, desc.arrLcl, ivLclNum);
+    }
+    for (unsigned i = 0; i < derivedIVs.Size(); i++)
+    {
+        optDerivedIV& div = derivedIVs.GetRef(i);
+
+        GenTree* mul = (div.mulLcl == BAD_VAR_NUM) ? gtNewIconNode(div.mulCns) : gtNewLclvNode(div.mulLcl, TYP_INT);
+        GenTree* initMul = gtNewOperNode(GT_MUL, TYP_INT, gtNewLclvNode(ivLclNum, TYP_INT), mul);
+        GenTreeStmt* initStmt = fgNewStmtFromTree(gtNewTempAssign(div.tempLcl, initMul));
+        fgInsertStmtNearEnd(head, initStmt);
+        gtSetStmtInfo(initStmt);
+        if (fgStmtListThreaded)
+        {
+            fgSetStmtSeq(initStmt);
+        }
+
+        GenTree* step;
+        if (div.mulLcl == BAD_VAR_NUM)
+        {
+            // Compute the step in unsigned arithmetic; wrapping is intended here.
+            int stepCns = (int)((unsigned)stride * (unsigned)div.mulCns);
+            step        = gtNewIconNode(stepCns);
+        }
+        else if (stride == 1)
+        {
+            step = gtNewLclvNode(div.mulLcl, TYP_INT);
+        }
+        else
+        {
+            // The step is loop invariant; compute it once in the head.
+            unsigned stepLcl = lvaGrabTemp(false DEBUGARG("derived IV step"));
+            lvaTable[stepLcl].lvType = TYP_INT;
+
+            GenTree* stepMul = gtNewOperNode(GT_MUL, TYP_INT, gtNewLclvNode(div.mulLcl, TYP_INT), gtNewIconNode(stride));
+            GenTreeStmt* stepStmt = fgNewStmtFromTree(gtNewTempAssign(stepLcl, stepMul));
+            fgInsertStmtNearEnd(head, stepStmt);
+            gtSetStmtInfo(stepStmt);
+            if (fgStmtListThreaded)
+            {
+                fgSetStmtSeq(stepStmt);
+            }
+
+            step = gtNewLclvNode(stepLcl, TYP_INT);
+        }
+
+        GenTree*     stepAdd  = gtNewOperNode(GT_ADD, TYP_INT, gtNewLclvNode(div.tempLcl, TYP_INT), step);
+        GenTreeStmt* stepStmt = fgNewStmtFromTree(gtNewTempAssign(div.tempLcl, stepAdd));
+        stepAfter             = fgInsertStmtAfter(incrBlock, stepAfter, stepStmt);
+        gtSetStmtInfo(stepStmt);
+        if (fgStmtListThreaded)
+        {
+            fgSetStmtSeq(stepStmt);
+        }
+
+        JITDUMP("L%02u: derived IV V%02u of V%02u is stepped in " FMT_BB "\n", lnum, div.tempLcl, ivLclNum,
+                incrBlock->bbNum);
+    }
+
+    JITDUMP("L%02u: strength reduced %u multiplications of V%02u\n", lnum, desc.replaced, ivLclNum);
+}
+
+//------------------------------------------------------------------------
+// optStrengthReduceCB: Tree walk callback that replaces "iv * m" by the
+//      temp of the corresponding derived induction variable.
+//
+/* static */
+Compiler::fgWalkResult Compiler::optStrengthReduceCB(GenTree** pTree, fgWalkData* data)
+{
+    GenTree* tree = *pTree;
+    if (!tree->OperIs(GT_MUL) || (tree->TypeGet() != TYP_INT) || tree->gtOverflow())
+    {
+        return WALK_CONTINUE;
+    }
+
+    optStrengthReduceDsc* desc = (optStrengthReduceDsc*)data->pCallbackData;
+    Compiler*             comp = desc->pCompiler;
+
+    GenTree* op1 = tree->gtGetOp1();
+    GenTree* op2 = tree->gtGetOp2();
+    if (op2->OperIs(GT_LCL_VAR) && (op2->AsLclVarCommon()->GetLclNum() == desc->ivLclNum))
+    {
+        jitstd::swap(op1, op2);
+    }
+    if (!op1->OperIs(GT_LCL_VAR) || (op1->AsLclVarCommon()->GetLclNum() != desc->ivLclNum))
+    {
+        return WALK_CONTINUE;
+    }
+
+    unsigned mulLcl = BAD_VAR_NUM;
+    ssize_t  mulCns = 0;
+    if (op2->IsCnsIntOrI() && !op2->IsIconHandle() && (op2->TypeGet() == TYP_INT))
+    {
+        mulCns = op2->AsIntCon()->IconValue();
+        if (isPow2(mulCns) || (mulCns == 0) || (mulCns == 3) || (mulCns == 5) || (mulCns == 9))
+        {
+            return WALK_CONTINUE;
+        }
+    }
+    else if (op2->OperIs(GT_LCL_VAR) && (op2->TypeGet() == TYP_INT))
+    {
+        mulLcl = op2->AsLclVarCommon()->GetLclNum();
+        if (mulLcl == desc->ivLclNum)
+        {
+            return WALK_CONTINUE;
+        }
+    }
+    else
+    {
+        return WALK_CONTINUE;
+    }
+
+    JitExpandArrayStack<optDerivedIV>* derivedIVs = desc->derivedIVs;
+    unsigned                           tempLcl    = BAD_VAR_NUM;
+    for (unsigned i = 0; i < derivedIVs->Size(); i++)
+    {
+        optDerivedIV& div = derivedIVs->GetRef(i);
+        if ((div.mulLcl == mulLcl) && ((mulLcl != BAD_VAR_NUM) || (div.mulCns == mulCns)))
+        {
+            tempLcl = div.tempLcl;
+            break;
+        }
+    }
+
+    if (tempLcl == BAD_VAR_NUM)
+    {
+        unsigned ptrIVs = (desc->ptrLcl != BAD_VAR_NUM) ? 1 : 0;
+        if (derivedIVs->Size() + ptrIVs >= MAX_DERIVED_IVS_PER_LOOP)
+        {
+            return WALK_CONTINUE;
+        }
+
+        if (mulLcl != BAD_VAR_NUM)
+        {
+            LoopDsc* loop = &comp->optLoopTable[desc->loopNum];
+            if (comp->lvaVarAddrExposed(mulLcl) || comp->optIsVarAssigned(loop->lpFirst, loop->lpBottom, nullptr, mulLcl))
+            {
+                return WALK_CONTINUE;
+            }
+        }
+
+        tempLcl                        = comp->lvaGrabTemp(false DEBUGARG("derived IV"));
+        comp->lvaTable[tempLcl].lvType = TYP_INT;
+
+        optDerivedIV div;
+        div.mulLcl  = mulLcl;
+        div.mulCns  = mulCns;
+        div.tempLcl = tempLcl;
+        derivedIVs->Push(div);
+    }
+
+#ifdef DEBUG
+    if (comp->verbose)
+    {
+        printf("Replacing derived IV ");
+        comp->printTreeID(tree);
+        printf(" with V%02u\n", tempLcl);
+    }
+#endif
+
+    *pTree = comp->gtNewLclvNode(tempLcl, TYP_INT);
+    desc->replaced++;
+    return WALK_SKIP_SUBTREES;
+}
+
+//------------------------------------------------------------------------
+// optStrengthReduceAddrCB: Tree walk callback that makes the accesses to the
+//      element "arr[iv]" of the array bounding the loop address the pointer
+//      induction variable.
+//
+// Notes:
+//      The pointer "p = arr + iv * elemSize" leaves out the offset of the first
+//      element, so it stays inside the array object for 0 <= iv <= arr.Length.
+//      When the loop exits, "iv" is at most "arr.Length - 1 + stride", which
+//      keeps "p" inside the object as long as "(stride - 1) * elemSize" is less
+//      than that offset; the GC never sees a byref past the end of the array.
+//
+//      The bounds check in front of the access is left alone. The access is no
+//      longer recognizable as an array element, so it is dropped from the array
+//      info map, and value numbering treats it like any other byref indirection.
+//
+/* static */
+Compiler::fgWalkResult Compiler::optStrengthReduceAddrCB(GenTree** pTree, fgWalkData* data)
+{
+    GenTree* tree = *pTree;
+    if (!tree->OperIs(GT_IND) || ((tree->gtFlags & GTF_IND_ARR_INDEX) == 0) || varTypeIsGC(tree) ||
+        varTypeIsStruct(tree))
+    {
+        return WALK_CONTINUE;
+    }
+
+    optStrengthReduceDsc* desc = (optStrengthReduceDsc*)data->pCallbackData;
+    Compiler*             comp = desc->pCompiler;
+
+    ArrayInfo arrInfo;
+    if (!comp->GetArrayInfoMap()->Lookup(tree, &arrInfo))
+    {
+        return WALK_CONTINUE;
+    }
+
+    // Match "arr + (((native int)iv << log2(elemSize)) + elemOffset)", see fgMorphArrayIndex.
+    GenTree* addr = tree->gtGetOp1();
+    if (!addr->OperIs(GT_ADD) || (addr->TypeGet() != TYP_BYREF))
+    {
+        return WALK_CONTINUE;
+    }
+    GenTree* base = addr->gtGetOp1();
+    GenTree* sio  = addr->gtGetOp2();
+    if (!base->OperIs(GT_LCL_VAR) || (base->AsLclVarCommon()->GetLclNum() != desc->arrLcl) || !sio->OperIs(GT_ADD))
+    {
+        return WALK_CONTINUE;
+    }
+    GenTree* ofs   = sio->gtGetOp2();
+    GenTree* index = sio->gtGetOp1();
+    if (!ofs->IsCnsIntOrI() || (ofs->AsIntCon()->IconValue() != (ssize_t)arrInfo.m_elemOffset))
+    {
+        return WALK_CONTINUE;
+    }
+    if (index->OperIs(GT_LSH))
+    {
+        GenTree* shift = index->gtGetOp2();
+        if (!shift->IsCnsIntOrI() || (((size_t)1 << shift->AsIntCon()->IconValue()) != arrInfo.m_elemSize))
+        {
+            return WALK_CONTINUE;
+        }
+        index = index->gtGetOp1();
+    }
+    else if (arrInfo.m_elemSize != 1)
+    {
+        return WALK_CONTINUE;
+    }
+#ifdef _TARGET_64BIT_
+    if (!index->OperIs(GT_CAST) || index->gtOverflow() || index->IsUnsigned())
+    {
+        return WALK_CONTINUE;
+    }
+    index = index->gtGetOp1();
+#endif
+    if (!index->OperIs(GT_LCL_VAR) || (index->AsLclVarCommon()->GetLclNum() != desc->ivLclNum))
+    {
+        return WALK_CONTINUE;
+    }
+
+    if (desc->ptrLcl == BAD_VAR_NUM)
+    {
+        if (((unsigned)(desc->stride - 1) * arrInfo.m_elemSize >= arrInfo.m_elemOffset) ||
+            (desc->derivedIVs->Size() >= MAX_DERIVED_IVS_PER_LOOP))
+        {
+            return WALK_CONTINUE;
+        }
+
+        desc->ptrLcl                        = comp->lvaGrabTemp(false DEBUGARG("pointer IV"));
+        comp->lvaTable[desc->ptrLcl].lvType = TYP_BYREF;
+        desc->elemSize                      = arrInfo.m_elemSize;
+    }
+
+    // All elements of one array have the same size.
+    assert(desc->elemSize == arrInfo.m_elemSize);
+
+#ifdef DEBUG
+    if (comp->verbose)
+    {
+        printf("Addressing array element ");
+        comp->printTreeID(tree);
+        printf(" through V%02u\n", desc->ptrLcl);
+    }
+#endif
+
+    tree->gtOp.gtOp1 = comp->gtNewOperNode(GT_ADD, TYP_BYREF, comp->gtNewLclvNode(desc->ptrLcl, TYP_BYREF),
+                                           comp->gtNewIconNode(arrInfo.m_elemOffset, TYP_I_IMPL));
+    tree->gtFlags &= ~GTF_IND_ARR_INDEX;
+    comp->GetArrayInfoMap()->Remove(tree);
+    desc->replaced++;
+    return WALK_SKIP_SUBTREES;
+}
+
 /*****************************************************************************
  *
  *  Return false if there is a code path from 'topBB' to 'botBB' that might
@@ -4515,6 +5040,40 @@ void Compiler::optOptimizeLoops()
     }
 }
 
+//------------------------------------------------------------------------
+// optGetLoopCloningStride: Get the signed amount by which the iterator of
+//      an iterator loop changes on every iteration.
+//
+// Arguments:
+//     loop        -  the loop descriptor; must be an LPFLG_ITER loop.
+//     pStride     -  [out] the stride; positive for increasing loops and
+//                    negative for decreasing loops.
+//
+// Return Value:
+//     "false" if the iterator is not stepped by adding or subtracting a
+//     non-zero constant whose negation is representable, "true" otherwise.
+//
+bool Compiler::optGetLoopCloningStride(LoopDsc* loop, int* pStride)
+{
+    int iterInc = loop->lpIterConst();
+    if ((iterInc == 0) || (iterInc == INT_MIN))
+    {
+        return false;
+    }
+
+    switch (loop->lpIterOper())
+    {
+        case GT_ADD:
+            *pStride = iterInc;
+            return true;
+        case GT_SUB:
+            *pStride = -iterInc;
+            return true;
+        default:
+            return false;
+    }
+}
+
 //------------------------------------------------------------------------
 // optDeriveLoopCloningConditions: Derive loop cloning conditions.
 //
@@ -4529,11 +5088,18 @@ void Compiler::optOptimizeLoops()
 //
 // Operation:
 //     Inspect the loop cloning optimization candidates and populate the conditions necessary
-//     for each optimization candidate. Checks if the loop stride is "> 0" if the loop
-//     condition is "less than". If the initializer is "var" init then adds condition
-//     "var >= 0", and if the loop is var limit then, "var >= 0" and "var <= a.len"
-//     are added to "context". These conditions are checked in the pre-header block
-//     and the cloning choice is made.
+//     for each optimization candidate.
+//
+//     For increasing loops ("i < limit" or "i <= limit", stride > 0) the iterator is bounded
+//     below by its initial value and above by the limit: if the initializer is "var" init then
+//     adds condition "var >= 0", and if the loop is var limit then "var >= 0" and "var <= a.len"
+//     (or "var < a.len" for "i <= limit") are added to "context". For strides other than 1 the
+//     condition "limit <= INT_MAX - stride + 1" ensures the final step cannot overflow.
+//
+//     For decreasing loops ("i > limit" or "i >= limit", stride < 0) the roles are swapped:
+//     the limit must be non-negative and the initial value must satisfy "init < a.len".
+//
+//     These conditions are checked in the pre-header block and the cloning choice is made.
 //
 // Assumption:
 //      Callers should assume AND operation is used i.e., if all conditions are
@@ -4547,12 +5113,26 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
     LoopDsc*                         loop     = &optLoopTable[loopNum];
     JitExpandArrayStack<LcOptInfo*>* optInfos = context->GetLoopOptInfo(loopNum);
 
-    if (loop->lpTestOper() == GT_LT)
+    int stride;
+    if (!optGetLoopCloningStride(loop, &stride))
+    {
+        JITDUMP("> Stride is invalid\n");
+        return false;
+    }
+
+    genTreeOps testOper = loop->lpTestOper();
+
+    // Every candidate yields the condition "bound boundOper length", where "bound" is the
+    // largest value the iterator takes in the loop.
+    LC_Ident   bound;
+    genTreeOps boundOper;
+
+    if ((testOper == GT_LT) || (testOper == GT_LE))
     {
         // Stride conditions
-        if (loop->lpIterConst() <= 0)
+        if (stride <= 0)
         {
-            JITDUMP("> Stride %d is invalid\n", loop->lpIterConst());
+            JITDUMP("> Stride %d is invalid\n", stride);
             return false;
         }
 
@@ -4579,12 +5159,16 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
             return false;
         }
 
+        // The last value of the iterator that passes the test is at most "limit - 1" ("limit"
+        // for GT_LE), and adding the stride to it must not wrap around to a negative index.
+        int maxLimit = (testOper == GT_LT) ? (INT_MAX - stride + 1) : (INT_MAX - stride);
+
         // Limit Conditions
         LC_Ident ident;
         if (loop->lpFlags & LPFLG_CONST_LIMIT)
         {
             int limit = loop->lpConstLimit();
-            if (limit < 0)
+            if ((limit < 0) || (limit > maxLimit))
             {
                 JITDUMP("> limit %d is invalid\n", limit);
                 return false;
@@ -4620,49 +5204,134 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
             return false;
         }
 
-        for (unsigned i = 0; i < optInfos->Size(); ++i)
+        // For a unit stride "limit <= length" (or "limit < length") already implies this.
+        if ((stride > 1) && ((loop->lpFlags & LPFLG_CONST_LIMIT) == 0))
+        {
+            LC_Condition noOverflow(GT_LE, LC_Expr(ident),
+                                    LC_Expr(LC_Ident(static_cast<unsigned>(maxLimit), LC_Ident::Const)));
+            context->EnsureConditions(loopNum)->Push(noOverflow);
+        }
+
+        bound     = ident;
+        boundOper = (testOper == GT_LT) ? GT_LE : GT_LT;
+    }
+    else if ((testOper == GT_GT) || (testOper == GT_GE))
+    {
+        // Stride conditions
+        if (stride >= 0)
+        {
+            JITDUMP("> Stride %d is invalid\n", stride);
+            return false;
+        }
+
+        // An unsigned "i >= 0" never terminates the loop before the iterator wraps around.
+        if (loop->lpTestTree->IsUnsigned())
+        {
+            JITDUMP("> Unsigned test in decreasing loop\n");
+            return false;
+        }
+
+        // Limit conditions: the smallest value of the iterator that passes the test is
+        // "limit" ("limit + 1" for GT_GT), which must be a valid index.
+        if (loop->lpFlags & LPFLG_CONST_LIMIT)
         {
-            LcOptInfo* optInfo = optInfos->GetRef(i);
-            switch (optInfo->GetOptType())
+            int limit = loop->lpConstLimit();
+            if (limit < ((testOper == GT_GT) ? -1 : 0))
             {
-                case LcOptInfo::LcJaggedArray:
-                {
-                    // limit <= arrLen
-                    LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
-                    LC_Array arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
-                    LC_Ident arrLenIdent = LC_Ident(arrLen);
+                JITDUMP("> limit %d is invalid\n", limit);
+                return false;
+            }
+        }
+        else if (loop->lpFlags & LPFLG_VAR_LIMIT)
+        {
+            // limitVar >= 0
+            LC_Condition geZero(GT_GE, LC_Expr(LC_Ident(loop->lpVarLimit(), LC_Ident::Var)),
+                                LC_Expr(LC_Ident(0, LC_Ident::Const)));
+            context->EnsureConditions(loopNum)->Push(geZero);
+        }
+        else
+        {
+            JITDUMP("> Undetected limit\n");
+            return false;
+        }
+
+        // Init conditions: the initial value is the largest value of the iterator.
+        if (loop->lpFlags & LPFLG_CONST_INIT)
+        {
+            if (loop->lpConstInit < 0)
+            {
+                JITDUMP("> Init %d is invalid\n", loop->lpConstInit);
+                return false;
+            }
+            bound = LC_Ident(static_cast<unsigned>(loop->lpConstInit), LC_Ident::Const);
+        }
+        else if (loop->lpFlags & LPFLG_VAR_INIT)
+        {
+            bound = LC_Ident(loop->lpVarInit, LC_Ident::Var);
+        }
+        else
+        {
+            JITDUMP("> Not variable init\n");
+            return false;
+        }
 
-                    LC_Condition cond(GT_LE, LC_Expr(ident), LC_Expr(arrLenIdent));
-                    context->EnsureConditions(loopNum)->Push(cond);
+        boundOper = GT_LT;
+    }
+    else
+    {
+        return false;
+    }
 
-                    // Ensure that this array must be dereference-able, before executing the actual condition.
-                    LC_Array array(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::None);
-                    context->EnsureDerefs(loopNum)->Push(array);
-                }
-                break;
-                case LcOptInfo::LcMdArray:
-                {
-                    // limit <= mdArrLen
-                    LcMdArrayOptInfo* mdArrInfo = optInfo->AsLcMdArrayOptInfo();
-                    LC_Condition      cond(GT_LE, LC_Expr(ident),
-                                      LC_Expr(LC_Ident(LC_Array(LC_Array::MdArray,
-                                                                mdArrInfo->GetArrIndexForDim(getAllocator()),
-                                                                mdArrInfo->dim, LC_Array::None))));
-                    context->EnsureConditions(loopNum)->Push(cond);
-                }
-                break;
+    for (unsigned i = 0; i < optInfos->Size(); ++i)
+    {
+        LcOptInfo* optInfo = optInfos->GetRef(i);
+        switch (optInfo->GetOptType())
+        {
+            case LcOptInfo::LcJaggedArray:
+            {
+                // bound <= arrLen
+                LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
+                LC_Array arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
+                LC_Ident arrLenIdent = LC_Ident(arrLen);
 
-                default:
-                    JITDUMP("Unknown opt\n");
-                    return false;
+                LC_Condition cond(boundOper, LC_Expr(bound), LC_Expr(arrLenIdent));
+                context->EnsureConditions(loopNum)->Push(cond);
+
+                // Ensure that this array must be dereference-able, before executing the actual condition.
+                LC_Array array(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::None);
+                context->EnsureDerefs(loopNum)->Push(array);
             }
+            break;
+            case LcOptInfo::LcMdArray:
+            {
+                // bound <= mdArrLen
+                LcMdArrayOptInfo* mdArrInfo = optInfo->AsLcMdArrayOptInfo();
+                LC_Condition      cond(boundOper, LC_Expr(bound),
+                                  LC_Expr(LC_Ident(LC_Array(LC_Array::MdArray,
+                                                            mdArrInfo->GetArrIndexForDim(getAllocator()),
+                                                            mdArrInfo->dim, LC_Array::None))));
+                context->EnsureConditions(loopNum)->Push(cond);
+            }
+            break;
+            case LcOptInfo::LcSpan:
+            {
+                // bound <= spanLen; the length is a local so there is nothing to dereference.
+                LcSpanOptInfo* spanInfo = optInfo->AsLcSpanOptInfo();
+                LC_Condition   cond(boundOper, LC_Expr(bound),
+                                  LC_Expr(LC_Ident(spanInfo->spanIndex.lenLcl, LC_Ident::Var)));
+                context->EnsureConditions(loopNum)->Push(cond);
+            }
+            break;
+
+            default:
+                JITDUMP("Unknown opt\n");
+                return false;
         }
-        JITDUMP("Conditions: (");
-        DBEXEC(verbose, context->PrintConditions(loopNum));
-        JITDUMP(")\n");
-        return true;
     }
-    return false;
+    JITDUMP("Conditions: (");
+    DBEXEC(verbose, context->PrintConditions(loopNum));
+    JITDUMP(")\n");
+    return true;
 }
 
 //------------------------------------------------------------------------------------
@@ -4778,6 +5447,14 @@ bool Compiler::optComputeDerefConditions(unsigned loopNum, LoopCloneContext* con
     // Get the dereference-able arrays.
     JitExpandArrayStack<LC_Array>* deref = context->EnsureDerefs(loopNum);
 
+    // Loops whose candidates are all checked against local lengths (spans) need no
+    // dereference conditions; the cloning conditions alone choose the path.
+    if (deref->Size() == 0)
+    {
+        JITDUMP("No deref conditions needed\n");
+        return true;
+    }
+
     // For each array in the dereference list, construct a tree,
     // where the nodes are array and index variables and an edge 'u-v'
     // exists if a node 'v' indexes node 'u' directly as in u[v] or an edge
@@ -4921,6 +5598,14 @@ void Compiler::optPerformStaticOptimizations(unsigned loopNum, LoopCloneContext*
             case LcOptInfo::LcMdArray:
                 // TODO-CQ: CLONE: Implement.
                 break;
+            case LcOptInfo::LcSpan:
+            {
+                LcSpanOptInfo* spanInfo = optInfo->AsLcSpanOptInfo();
+                compCurBB               = spanInfo->spanIndex.useBlock;
+                optRemoveRangeCheck(spanInfo->spanIndex.bndsChk, spanInfo->stmt);
+                DBEXEC(dynamicPath, optDebugLogLoopCloning(spanInfo->spanIndex.useBlock, spanInfo->stmt));
+            }
+            break;
             default:
                 break;
         }
@@ -5314,8 +5999,8 @@ void Compiler::optCloneLoop(unsigned loopInd, LoopCloneContext* context)
     // !condn        -?> slow
     // h2/entry (fast)
     //
-    // We should always have block conditions, at the minimum, the array should be deref-able
-    assert(context->HasBlockConditions(loopInd));
+    // If there are no block conditions (only span candidates), "h" instead jumps around the
+    // slow head to a single block holding the cloning conditions.
 
     // Create a unique header for the slow path.
     BasicBlock* slowHead   = fgNewBBafter(BBJ_ALWAYS, h, true);
@@ -5370,13 +6055,34 @@ void Compiler::optCloneLoop(unsigned loopInd, LoopCloneContext* context)
 //
 //      Insert condition 0 in 'h' and create other condition blocks and insert conditions in them.
 //
+//      When there are no block conditions, 'h' jumps unconditionally to a single block
+//      holding the cloning conditions:
+//
+//      h             --> cond
+//      slowHead      --> e2 (slowHead) always
+//      !cond         -?> slowHead
+//      h2/entry (fast)
+//
 BasicBlock* Compiler::optInsertLoopChoiceConditions(LoopCloneContext* context,
                                                     unsigned          loopNum,
                                                     BasicBlock*       head,
                                                     BasicBlock*       slowHead)
 {
     JITDUMP("Inserting loop cloning conditions\n");
-    assert(context->HasBlockConditions(loopNum));
+
+    if (!context->HasBlockConditions(loopNum))
+    {
+        BasicBlock* condBlock = fgNewBBafter(BBJ_COND, slowHead, true);
+        condBlock->inheritWeight(head);
+        condBlock->bbNatLoopNum = head->bbNatLoopNum;
+
+        head->bbJumpKind = BBJ_ALWAYS;
+        head->bbJumpDest = condBlock;
+
+        JITDUMP("Created new " FMT_BB " for cloning conditions\n", condBlock->bbNum);
+        context->CondToStmtInBlock(this, *(context->GetConditions(loopNum)), condBlock, false);
+        return condBlock;
+    }
 
     BasicBlock*                                              curCond   = head;
     JitExpandArrayStack<JitExpandArrayStack<LC_Condition>*>* levelCond = context->GetBlockConditions(loopNum);
@@ -8058,8 +8764,8 @@ bool Compiler::optIdentifyLoopOptInfo(unsigned loopNum, LoopCloneContext* contex
         return false;
     }
 
-    // TODO-CQ: CLONE: Mark increasing or decreasing loops.
-    if ((pLoop->lpIterOper() != GT_ADD) || (pLoop->lpIterConst() != 1))
+    int stride;
+    if (!optGetLoopCloningStride(pLoop, &stride))
     {
         JITDUMP("> Loop iteration operator not matching\n");
         return false;
@@ -8072,11 +8778,11 @@ bool Compiler::optIdentifyLoopOptInfo(unsigned loopNum, LoopCloneContext* contex
         return false;
     }
 
-    if (!(((pLoop->lpTestOper() == GT_LT || pLoop->lpTestOper() == GT_LE) && (pLoop->lpIterOper() == GT_ADD)) ||
-          ((pLoop->lpTestOper() == GT_GT || pLoop->lpTestOper() == GT_GE) && (pLoop->lpIterOper() == GT_SUB))))
+    if (!(((pLoop->lpTestOper() == GT_LT || pLoop->lpTestOper() == GT_LE) && (stride > 0)) ||
+          ((pLoop->lpTestOper() == GT_GT || pLoop->lpTestOper() == GT_GE) && (stride < 0))))
     {
-        JITDUMP("> Loop test (%s) doesn't agree with the direction (%s) of the pLoop->\n",
-                GenTree::OpName(pLoop->lpTestOper()), GenTree::OpName(pLoop->lpIterOper()));
+        JITDUMP("> Loop test (%s) doesn't agree with the direction (stride %d) of the loop\n",
+                GenTree::OpName(pLoop->lpTestOper()), stride);
         return false;
     }
 
@@ -8329,6 +9035,59 @@ bool Compiler::optReconstructArrIndex(GenTree* tree, ArrIndex* result, unsigned
     return false;
 }
 
+//---------------------------------------------------------------------------------------------------------------
+//  optExtractSpanIndex: Try to extract a bounds checked access against a local length from "tree".
+//
+//  Arguments:
+//      tree        the tree to be checked if it is a span [] operation.
+//      result      the extracted access information is updated in result.
+//
+//  Return Value:
+//      Returns true if "tree" is a GT_COMMA whose first operand bounds checks a local index
+//      against a local length, else returns false.
+//
+//  Operation:
+//      The Span<T> and ReadOnlySpan<T> indexers are imported as a bounds check of the index
+//      against the "_length" field of the span, and once the span is promoted that field
+//      is a local of its own:
+//
+//  [000031] ---X--------              *  COMMA     byref
+//  [000027] ---X--------              +--*  ARR_BOUNDS_CHECK_Rng void
+//  [000025] ------------              |  +--*  LCL_VAR   int    V03 loc0
+//  [000026] ------------              |  \--*  LCL_VAR   int    V07 tmp2
+//  [000030] ------------              \--*  ADD       byref
+//
+//  Assumption:
+//      The method extracts only if both the index and the length are GT_LCL_VAR.
+//
+bool Compiler::optExtractSpanIndex(GenTree* tree, SpanIndex* result)
+{
+    if (tree->gtOper != GT_COMMA)
+    {
+        return false;
+    }
+    GenTree* before = tree->gtGetOp1();
+    if (before->gtOper != GT_ARR_BOUNDS_CHECK)
+    {
+        return false;
+    }
+    GenTreeBoundsChk* arrBndsChk = before->AsBoundsChk();
+    if (arrBndsChk->gtIndex->gtOper != GT_LCL_VAR || arrBndsChk->gtArrLen->gtOper != GT_LCL_VAR)
+    {
+        return false;
+    }
+    if (genActualType(arrBndsChk->gtArrLen->TypeGet()) != TYP_INT)
+    {
+        return false;
+    }
+
+    result->indLcl   = arrBndsChk->gtIndex->gtLclVarCommon.gtLclNum;
+    result->lenLcl   = arrBndsChk->gtArrLen->gtLclVarCommon.gtLclNum;
+    result->bndsChk  = tree;
+    result->useBlock = compCurBB;
+    return true;
+}
+
 /* static */
 Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloningVisitor(GenTree** pTree, Compiler::fgWalkData* data)
 {
@@ -8434,7 +9193,33 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTree* tree, Loop
         }
         return WALK_SKIP_SUBTREES;
     }
-    else if (tree->gtOper == GT_ARR_ELEM)
+
+    SpanIndex spanIndex;
+    if (optExtractSpanIndex(tree, &spanIndex))
+    {
+#ifdef DEBUG
+        if (verbose)
+        {
+            JITDUMP("Found SpanIndex at tree ");
+            printTreeID(tree);
+            printf(" which is equivalent to: ");
+            spanIndex.Print();
+            JITDUMP("\n");
+        }
+#endif
+        if ((spanIndex.indLcl == optLoopTable[info->loopNum].lpIterVar()) &&
+            optIsStackLocalInvariant(info->loopNum, spanIndex.lenLcl))
+        {
+            JITDUMP("Loop %d can be cloned for SpanIndex\n", info->loopNum);
+            info->context->EnsureLoopOptInfo(info->loopNum)
+                ->Push(new (this, CMK_LoopOpt) LcSpanOptInfo(spanIndex, info->stmt));
+        }
+
+        // The address computation may contain further candidates.
+        return WALK_CONTINUE;
+    }
+
+    if (tree->gtOper == GT_ARR_ELEM)
     {
         // TODO-CQ: CLONE: Implement.
         return WALK_SKIP_SUBTREES;
@@ -1618,6 +1618,73 @@ QueueUserAPC(
          IN HANDLE hThread,
          IN ULONG_PTR dwData);
 
+//
+// Wait ports multiplex waits on many events and semaphores onto a single
+// epoll loop, without the MAXIMUM_WAIT_OBJECTS limit. A port is waited on
+// by one thread; registrations are enabled and removed by that same thread
+// (e.g. from an APC queued to it and followed by PAL_WaitPortWake). Objects
+// may be added by any thread, disabled, so that running out of resources
+// can be handled by the thread that asked for the wait.
+//
+
+PALIMPORT
+PVOID
+PALAPI
+PAL_CreateWaitPort(VOID);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_CloseWaitPort(
+    IN PVOID pvWaitPort);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_WaitPortCanAdd(
+    IN HANDLE hObject);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_WaitPortAdd(
+    IN PVOID pvWaitPort,
+    IN HANDLE hObject,
+    IN PVOID pvContext,
+    IN BOOL bEnable,
+    OUT PVOID *ppvRegistration);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_WaitPortEnable(
+    IN PVOID pvWaitPort,
+    IN PVOID pvRegistration);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_WaitPortRemove(
+    IN PVOID pvWaitPort,
+    IN PVOID pvRegistration);
+
+PALIMPORT
+DWORD
+PALAPI
+PAL_WaitPortWait(
+    IN PVOID pvWaitPort,
+    IN DWORD dwMilliseconds,
+    IN BOOL bAlertable,
+    OUT PVOID *rgpvContexts,
+    IN DWORD dwMaxCount,
+    OUT LPDWORD pdwCount);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_WaitPortWake(
+    IN PVOID pvWaitPort);
+
 #ifdef _X86_
 
 //
@@ -81,6 +81,18 @@ check_function_exists(sysctlbyname HAVE_SYSCTLBYNAME)
 check_include_files(gnu/lib-names.h HAVE_GNU_LIBNAMES_H)
 
 check_function_exists(kqueue HAVE_KQUEUE)
+check_function_exists(epoll_create1 HAVE_EPOLL)
+check_function_exists(eventfd HAVE_EVENTFD)
+
+check_cxx_source_compiles("
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+int main()
+{
+  int word = 0;
+  return syscall(SYS_futex, &word, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}" HAVE_FUTEX)
 
 check_library_exists(c sched_getaffinity "" HAVE_SCHED_GETAFFINITY)
 check_library_exists(pthread pthread_create "" HAVE_LIBPTHREAD)
@@ -24,6 +24,8 @@ Abstract:
 #include "pal/malloc.hpp"
 #include "pal/dbgmsg.h"
 
+#include <sched.h>
+
 using namespace CorUnix;
 
 SET_DEFAULT_DEBUG_CHANNEL(HANDLE);
@@ -46,6 +48,22 @@ CSimpleHandleManager::Initialize(
     InternalInitializeCriticalSection(&m_csLock);
     m_fLockInitialized = TRUE;
 
+    InternalInitializeCriticalSection(&m_csReadersLock);
+    m_fReadersLockInitialized = TRUE;
+
+    /* align the reader stripes to a cache line, see READER_STRIPE */
+    m_pvReaderStripesAlloc = InternalMalloc(c_ReaderStripes * sizeof(READER_STRIPE) + c_CacheLineSize - 1);
+    if (NULL == m_pvReaderStripesAlloc)
+    {
+        ERROR("Unable to allocate the handle table reader counts");
+        palError = ERROR_OUTOFMEMORY;
+        goto InitializeExit;
+    }
+
+    m_rgReaderStripes = reinterpret_cast<READER_STRIPE*>(
+        ((UINT_PTR) m_pvReaderStripesAlloc + c_CacheLineSize - 1) & ~((UINT_PTR) c_CacheLineSize - 1));
+    memset(m_rgReaderStripes, 0, c_ReaderStripes * sizeof(READER_STRIPE));
+
     m_dwTableGrowthRate = c_BasicGrowthRate;
 
     /* initialize the handle table - the free list is stored in the 'object'
@@ -89,6 +107,7 @@ CSimpleHandleManager::AllocateHandle(
 {
     PAL_ERROR palError = NO_ERROR;
     DWORD dwIndex;
+    HANDLE_TABLE_ENTRY* rghteOldTable = NULL;
 
     Lock(pThread);
 
@@ -110,9 +129,10 @@ CSimpleHandleManager::AllocateHandle(
             goto AllocateHandleExit;
         }
 
-        /* grow handle table */
-        rghteTempTable = reinterpret_cast<HANDLE_TABLE_ENTRY*>(InternalRealloc(
-            m_rghteHandleTable,
+        /* grow handle table. Lookups may still be reading the current
+           table, so copy it instead of reallocating it in place, and free
+           it only once those lookups are done */
+        rghteTempTable = reinterpret_cast<HANDLE_TABLE_ENTRY*>(InternalMalloc(
             (m_dwTableSize + m_dwTableGrowthRate) * sizeof(HANDLE_TABLE_ENTRY)));
         
         if (NULL == rghteTempTable)
@@ -121,7 +141,7 @@ CSimpleHandleManager::AllocateHandle(
             palError = ERROR_OUTOFMEMORY;
             goto AllocateHandleExit;
         }
-        m_rghteHandleTable = rghteTempTable;
+        memcpy(rghteTempTable, m_rghteHandleTable, m_dwTableSize * sizeof(HANDLE_TABLE_ENTRY));
 
         /* update handle table and handle pool */
         for (DWORD dw = m_dwTableSize; dw < m_dwTableSize + m_dwTableGrowthRate; dw += 1)
@@ -130,15 +150,19 @@ CSimpleHandleManager::AllocateHandle(
             /* the last "old" handle was m_dwTableSize-1, so the new
                handles range from m_dwTableSize to
                m_dwTableSize+m_dwTableGrowthRate-1 */
-            m_rghteHandleTable[dw].u.hiNextIndex = dw + 1;
-            m_rghteHandleTable[dw].fEntryAllocated = FALSE;
+            rghteTempTable[dw].u.hiNextIndex = dw + 1;
+            rghteTempTable[dw].fEntryAllocated = FALSE;
         }
+        rghteTempTable[m_dwTableSize + m_dwTableGrowthRate - 1].u.hiNextIndex = (HANDLE_INDEX)-1;
+
+        /* publish the table before its size, so that a lookup that sees
+           the new size also sees the new table */
+        rghteOldTable = m_rghteHandleTable;
+        VolatileStore(&m_rghteHandleTable, rghteTempTable);
 
         m_hiFreeListStart = m_dwTableSize;
-        m_dwTableSize += m_dwTableGrowthRate;
-        m_rghteHandleTable[m_dwTableSize - 1].u.hiNextIndex = (HANDLE_INDEX)-1;
+        VolatileStore(&m_dwTableSize, m_dwTableSize + m_dwTableGrowthRate);
         m_hiFreeListEnd = m_dwTableSize - 1;
-        
     }
 
     /* take the next free handle */
@@ -160,12 +184,22 @@ CSimpleHandleManager::AllocateHandle(
     m_rghteHandleTable[dwIndex].u.pObject = pObject;
     m_rghteHandleTable[dwIndex].dwAccessRights = dwAccessRights;
     m_rghteHandleTable[dwIndex].fInheritable = fInheritable;
-    m_rghteHandleTable[dwIndex].fEntryAllocated = TRUE;
+
+    /* lookups check this flag before reading the rest of the entry */
+    VolatileStore(&m_rghteHandleTable[dwIndex].fEntryAllocated, true);
 
 AllocateHandleExit:
 
     Unlock(pThread);
 
+    /* no writer uses the old table anymore; free it once the lookups
+       that may still be reading it are done */
+    if (NULL != rghteOldTable)
+    {
+        WaitForReaders(pThread);
+        free(rghteOldTable);
+    }
+
     return palError;    
 }
 
@@ -178,26 +212,32 @@ CSimpleHandleManager::GetObjectFromHandle(
     )
 {
     PAL_ERROR palError = NO_ERROR;
-    HANDLE_INDEX hi;
+    HANDLE_TABLE_ENTRY *phte;
+    LONG lEpoch;
 
-    Lock(pThread);
+    //
+    // No lock is taken here. As long as this thread is registered as a
+    // reader, FreeHandle will neither reuse the entry nor release the
+    // handle's reference to the object, and AllocateHandle will not free
+    // the table the entry lives in.
+    //
+
+    lEpoch = EnterReader(pThread);
     
-    if (!ValidateHandle(h))
+    if (!ValidateHandle(h, &phte))
     {
         ERROR("Tried to dereference an invalid handle %p\n", h);
         palError = ERROR_INVALID_HANDLE;
         goto GetObjectFromHandleExit;
     }
-    
-    hi = HandleToHandleIndex(h);
 
-    *pdwRightsGranted = m_rghteHandleTable[hi].dwAccessRights;
-    *ppObject = m_rghteHandleTable[hi].u.pObject;
+    *pdwRightsGranted = phte->dwAccessRights;
+    *ppObject = phte->u.pObject;
     (*ppObject)->AddReference();
     
 GetObjectFromHandleExit:
 
-    Unlock(pThread);
+    LeaveReader(pThread, lEpoch);
 
     return palError;
 }
@@ -210,11 +250,12 @@ CSimpleHandleManager::FreeHandle(
 {
     PAL_ERROR palError = NO_ERROR;
     IPalObject *pobj = NULL;
+    HANDLE_TABLE_ENTRY *phte;
     HANDLE_INDEX hi = HandleToHandleIndex(h);
 
     Lock(pThread);
 
-    if (!ValidateHandle(h))
+    if (!ValidateHandle(h, &phte))
     {
         ERROR("Trying to free invalid handle %p.\n", h);
         palError = ERROR_INVALID_HANDLE;
@@ -228,8 +269,16 @@ CSimpleHandleManager::FreeHandle(
         goto FreeHandleExit;
     }
 
-    pobj = m_rghteHandleTable[hi].u.pObject;
-    m_rghteHandleTable[hi].fEntryAllocated = FALSE;
+    pobj = phte->u.pObject;
+    VolatileStore(&phte->fEntryAllocated, false);
+
+    /* lookups that found the entry allocated may still be reading it
+       and adding a reference to its object; let them finish before the
+       entry is linked into the free list. The entry is in neither the
+       free list nor use meanwhile, so the lock need not be held. */
+    Unlock(pThread);
+    WaitForReaders(pThread);
+    Lock(pThread);
 
     /* add handle to the free pool */
     if(m_hiFreeListEnd != c_hiInvalid)
@@ -256,6 +305,87 @@ FreeHandleExit:
     return palError;
 }
 
+/*++
+Function :
+    EnterReader
+
+    Registers the calling thread as a handle table reader. Returns the
+    epoch to pass to LeaveReader.
+--*/
+LONG
+CSimpleHandleManager::EnterReader(
+    CPalThread *pThread
+    )
+{
+    READER_STRIPE *pStripe = GetReaderStripe(pThread);
+    LONG lEpoch;
+
+    for (;;)
+    {
+        lEpoch = m_lReaderEpoch;
+        InterlockedIncrement(&pStripe->rglReaders[lEpoch & 1]);
+
+        //
+        // If the epoch did not move on while registering, any writer that
+        // moves it from now on will wait for this reader. Otherwise a
+        // writer may already have seen the count drained; register again
+        // with the current epoch.
+        //
+        if (lEpoch == m_lReaderEpoch)
+        {
+            return lEpoch;
+        }
+
+        InterlockedDecrement(&pStripe->rglReaders[lEpoch & 1]);
+    }
+}
+
+/*++
+Function :
+    LeaveReader
+
+    Unregisters a reader registered by EnterReader.
+--*/
+void
+CSimpleHandleManager::LeaveReader(
+    CPalThread *pThread,
+    LONG lEpoch
+    )
+{
+    InterlockedDecrement(&GetReaderStripe(pThread)->rglReaders[lEpoch & 1]);
+}
+
+/*++
+Function :
+    WaitForReaders
+
+    Waits until every lookup that may have observed the handle table
+    before this call has finished. Must not be called with the lock held.
+    The waits are serialized, which keeps writers from moving the epoch
+    while another writer waits for it to drain.
+--*/
+void
+CSimpleHandleManager::WaitForReaders(
+    CPalThread *pThread
+    )
+{
+    InternalEnterCriticalSection(pThread, &m_csReadersLock);
+
+    LONG lOldEpoch = InterlockedIncrement(&m_lReaderEpoch) - 1;
+
+    // Lookups only read a few fields and add a reference, so the wait is
+    // normally short; yield in case a reader got preempted
+    for (DWORD dw = 0; dw < c_ReaderStripes; dw += 1)
+    {
+        while (0 != m_rgReaderStripes[dw].rglReaders[lOldEpoch & 1])
+        {
+            sched_yield();
+        }
+    }
+
+    InternalLeaveCriticalSection(pThread, &m_csReadersLock);
+}
+
 /*++
 Function :
     ValidateHandle
@@ -264,15 +394,23 @@ Function :
 
 Parameters :
     HANDLE handle : handle to check.
+    HANDLE_TABLE_ENTRY **pphte : receives the handle's table entry if the
+                                 handle is valid
 
 Return Value :
     TRUE if valid, FALSE if invalid.
 --*/
-bool CSimpleHandleManager::ValidateHandle(HANDLE handle)
+bool CSimpleHandleManager::ValidateHandle(HANDLE handle, HANDLE_TABLE_ENTRY **pphte)
 {
+    HANDLE_TABLE_ENTRY *rghteTable;
+    DWORD dwTableSize;
     DWORD dwIndex;
     
-    if (NULL == m_rghteHandleTable)
+    /* read the size before the table, see AllocateHandle */
+    dwTableSize = VolatileLoad(&m_dwTableSize);
+    rghteTable = VolatileLoad(&m_rghteHandleTable);
+
+    if (NULL == rghteTable)
     {
         ASSERT("Handle Manager is not initialized!\n");
         return FALSE;
@@ -300,18 +438,19 @@ bool CSimpleHandleManager::ValidateHandle(HANDLE handle)
 
     dwIndex = HandleToHandleIndex(handle);
 
-    if (dwIndex >= m_dwTableSize)
+    if (dwIndex >= dwTableSize)
     {
         WARN( "The handle value(%p) is out of the bounds for the handle table.\n", handle );
         return FALSE;
     }
 
-    if (!m_rghteHandleTable[dwIndex].fEntryAllocated)
+    if (!VolatileLoad(&rghteTable[dwIndex].fEntryAllocated))
     {
         WARN("The handle value (%p) has not been allocated\n", handle);
         return FALSE;
     }
 
+    *pphte = &rghteTable[dwIndex];
     return TRUE;
 }
 
@@ -1212,6 +1212,20 @@ namespace CorUnix
             ISynchStateController *rgControllers[]
             ) = 0;
 
+        //
+        // Returns in *piSignalFd a new file descriptor, owned by the caller,
+        // that polls readable for as long as the object is signaled. Used by
+        // wait ports; only local events and semaphores are supported.
+        //
+
+        virtual
+        PAL_ERROR
+        GetObjectSignalFd(
+            CPalThread *pThread,
+            IPalObject *pObject,
+            int *piSignalFd                     // OUT
+            ) = 0;
+
         //
         // These following routines are meant for use only by IPalObject
         // implementations. The first two routines are used to
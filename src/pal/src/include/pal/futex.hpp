@@ -0,0 +1,77 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+/*++
+
+
+
+Module Name:
+
+    include/pal/futex.hpp
+
+Abstract:
+    Thin wrappers around the Linux futex system call, used to block
+    threads on a 32-bit word of process private memory without going
+    through a pthread mutex/condition pair
+
+
+
+--*/
+
+#ifndef _PAL_FUTEX_HPP_
+#define _PAL_FUTEX_HPP_
+
+#include "config.h"
+
+#if HAVE_FUTEX
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+namespace CorUnix
+{
+    /*++
+    Function:
+      PALFutexWait
+
+    Blocks the calling thread as long as *piWord equals iExpected and no
+    PALFutexWake call on piWord wakes it up. ptsAbsTimeout, if not NULL,
+    is an absolute CLOCK_MONOTONIC timeout.
+
+    Returns 0 when woken up, EAGAIN if *piWord did not hold iExpected,
+    ETIMEDOUT on timeout and EINTR if interrupted by a signal. Wake ups
+    may be spurious, so callers must always recheck the word.
+    --*/
+    inline int PALFutexWait(int * piWord, int iExpected, const struct timespec * ptsAbsTimeout)
+    {
+        // FUTEX_WAIT_BITSET takes an absolute timeout, measured against
+        // CLOCK_MONOTONIC unless FUTEX_CLOCK_REALTIME is specified
+        long lRet = syscall(SYS_futex, piWord, FUTEX_WAIT_BITSET_PRIVATE, iExpected,
+                            ptsAbsTimeout, NULL, FUTEX_BITSET_MATCH_ANY);
+
+        return (0 == lRet) ? 0 : errno;
+    }
+
+    /*++
+    Function:
+      PALFutexWake
+
+    Wakes up to iCount threads blocked in PALFutexWait on piWord.
+    Returns 0 on success or the error reported by the system call.
+    --*/
+    inline int PALFutexWake(int * piWord, int iCount)
+    {
+        long lRet = syscall(SYS_futex, piWord, FUTEX_WAKE_PRIVATE, iCount,
+                            NULL, NULL, 0);
+
+        return (0 <= lRet) ? 0 : errno;
+    }
+}
+
+#endif // HAVE_FUTEX
+
+#endif // _PAL_FUTEX_HPP_
@@ -40,6 +40,8 @@ namespace CorUnix
     private:
         enum { c_BasicGrowthRate = 1024 };
         enum { c_MaxIndex = 0x3FFFFFFE };
+        enum { c_ReaderStripes = 16 };
+        enum { c_CacheLineSize = 64 };
 
         typedef UINT_PTR HANDLE_INDEX;
         static const HANDLE_INDEX c_hiInvalid = (HANDLE_INDEX) -1;
@@ -70,6 +72,17 @@ namespace CorUnix
             bool fEntryAllocated;
         } HANDLE_TABLE_ENTRY;
 
+        //
+        // Each stripe holds the two reader counts of the threads hashed to
+        // it, in a cache line of its own, so that lookups on different
+        // threads do not contend on a single counter
+        //
+        typedef struct _READER_STRIPE
+        {
+            Volatile<LONG> rglReaders[2];
+            BYTE rgbPadding[c_CacheLineSize - 2 * sizeof(LONG)];
+        } READER_STRIPE;
+
         HANDLE_INDEX m_hiFreeListStart;
         HANDLE_INDEX m_hiFreeListEnd;
         
@@ -77,10 +90,68 @@ namespace CorUnix
         DWORD m_dwTableGrowthRate;
         HANDLE_TABLE_ENTRY* m_rghteHandleTable;
 
+        //
+        // m_csLock serializes handle allocation and release. Handle lookups
+        // do not take it: a lookup registers itself in its stripe's reader
+        // count selected by m_lReaderEpoch for as long as it is looking at
+        // the table. Before reusing a released entry or freeing a replaced
+        // table, writers call WaitForReaders, which moves new lookups to
+        // the other counts and waits for the current ones to drain. The
+        // wait happens outside m_csLock, so that handle allocation and
+        // release do not stall behind a preempted lookup; m_csReadersLock
+        // serializes the waits instead.
+        //
         CRITICAL_SECTION m_csLock;
         bool m_fLockInitialized;
 
-        bool ValidateHandle(HANDLE h);
+        CRITICAL_SECTION m_csReadersLock;
+        bool m_fReadersLockInitialized;
+
+        Volatile<LONG> m_lReaderEpoch;
+        READER_STRIPE *m_rgReaderStripes;
+        void *m_pvReaderStripesAlloc;
+
+        bool ValidateHandle(HANDLE h, HANDLE_TABLE_ENTRY **pphte);
+
+        READER_STRIPE *
+        GetReaderStripe(
+            CPalThread *pThread
+            )
+        {
+            return &m_rgReaderStripes[pThread->GetThreadId() % c_ReaderStripes];
+        };
+
+        LONG
+        EnterReader(
+            CPalThread *pThread
+            );
+
+        void
+        LeaveReader(
+            CPalThread *pThread,
+            LONG lEpoch
+            );
+
+        void
+        WaitForReaders(
+            CPalThread *pThread
+            );
+
+        void
+        Lock(
+            CPalThread *pThread
+            )
+        {
+            InternalEnterCriticalSection(pThread, &m_csLock);
+        };
+
+        void
+        Unlock(
+            CPalThread *pThread
+            )
+        {
+            InternalLeaveCriticalSection(pThread, &m_csLock);
+        };
 
     public:
 
@@ -91,7 +162,11 @@ namespace CorUnix
             m_dwTableSize(0),
             m_dwTableGrowthRate(c_BasicGrowthRate),
             m_rghteHandleTable(NULL),
-            m_fLockInitialized(FALSE)
+            m_fLockInitialized(FALSE),
+            m_fReadersLockInitialized(FALSE),
+            m_lReaderEpoch(0),
+            m_rgReaderStripes(NULL),
+            m_pvReaderStripesAlloc(NULL)
         {
         };
 
@@ -103,6 +178,16 @@ namespace CorUnix
                 DeleteCriticalSection(&m_csLock);
             }
 
+            if (m_fReadersLockInitialized)
+            {
+                DeleteCriticalSection(&m_csReadersLock);
+            }
+
+            if (NULL != m_pvReaderStripesAlloc)
+            {
+                free(m_pvReaderStripesAlloc);
+            }
+
             if (NULL != m_rghteHandleTable)
             {
                 free(m_rghteHandleTable);
@@ -125,6 +210,8 @@ namespace CorUnix
 
         //
         // On success this will add a reference to the returned object.
+        // Does not block: it can run concurrently with any other handle
+        // manager operation.
         //
 
         PAL_ERROR
@@ -140,22 +227,6 @@ namespace CorUnix
             CPalThread *pThread,
             HANDLE h
             );
-
-        void
-        Lock(
-            CPalThread *pThread
-            )
-        {
-            InternalEnterCriticalSection(pThread, &m_csLock);
-        };
-
-        void
-        Unlock(
-            CPalThread *pThread
-            )
-        {
-            InternalLeaveCriticalSection(pThread, &m_csLock);
-        };
     };
 
     bool
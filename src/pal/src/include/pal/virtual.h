@@ -30,6 +30,10 @@ typedef struct _CMI {
     struct _CMI * pNext;        /* Link to the next entry. */
     struct _CMI * pPrevious;    /* Link to the previous entry. */
 
+    struct _CMI * pLeft;        /* Lower addressed subtree of the region tree. */
+    struct _CMI * pRight;       /* Higher addressed subtree of the region tree. */
+    int treeHeight;             /* Height of the subtree rooted at this entry. */
+
     UINT_PTR startBoundary;     /* Starting location of the region. */
     SIZE_T   memSize;           /* Size of the entire region.. */
 
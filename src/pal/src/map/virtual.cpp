@@ -47,11 +47,20 @@ SET_DEFAULT_DEBUG_CHANNEL(VIRTUAL); // some headers have code with asserts, so d
 
 using namespace CorUnix;
 
-CRITICAL_SECTION virtual_critsec;
+// Protects the region bookkeeping below and the executable memory allocator.
+// Lookups that only read the bookkeeping (VirtualQuery) take it shared, so they
+// do not serialize behind each other; anything that adds, removes or changes a
+// region takes it exclusive.
+static pthread_rwlock_t virtual_lock;
 
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The root of the AVL tree that indexes the same blocks by start address, so
+// that looking up the block containing an address does not have to walk the
+// list. The list is kept for in-order traversal.
+static PCMI pVirtualMemoryTree;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -151,11 +160,29 @@ namespace VirtualMemoryLogging
     }
 }
 
+static void VIRTUALEnterReadLock()
+{
+    int st = pthread_rwlock_rdlock(&virtual_lock);
+    _ASSERT_MSG(st == 0, "pthread_rwlock_rdlock failed with error %d\n", st);
+}
+
+static void VIRTUALEnterWriteLock()
+{
+    int st = pthread_rwlock_wrlock(&virtual_lock);
+    _ASSERT_MSG(st == 0, "pthread_rwlock_wrlock failed with error %d\n", st);
+}
+
+static void VIRTUALLeaveLock()
+{
+    int st = pthread_rwlock_unlock(&virtual_lock);
+    _ASSERT_MSG(st == 0, "pthread_rwlock_unlock failed with error %d\n", st);
+}
+
 /*++
 Function:
     VIRTUALInitialize()
 
-    Initializes this section's critical section.
+    Initializes this section's lock.
 
 Return value:
     TRUE  if initialization succeeded
@@ -168,11 +195,17 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
 {
     s_virtualPageSize = getpagesize();
 
-    TRACE("Initializing the Virtual Critical Sections. \n");
+    TRACE("Initializing the Virtual Lock. \n");
 
-    InternalInitializeCriticalSection(&virtual_critsec);
+    int st = pthread_rwlock_init(&virtual_lock, NULL);
+    if (st != 0)
+    {
+        ERROR("pthread_rwlock_init failed with error %d\n", st);
+        return FALSE;
+    }
 
     pVirtualMemory = NULL;
+    pVirtualMemoryTree = NULL;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -185,7 +218,7 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
 /***
  *
  * VIRTUALCleanup()
- *      Deletes this section's critical section.
+ *      Deletes this section's lock.
  *
  */
 extern "C"
@@ -193,9 +226,8 @@ void VIRTUALCleanup()
 {
     PCMI pEntry;
     PCMI pTempEntry;
-    CPalThread * pthrCurrent = InternalGetCurrentThread();
 
-    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALEnterWriteLock();
 
     // Clean up the allocated memory.
     pEntry = pVirtualMemory;
@@ -210,11 +242,12 @@ void VIRTUALCleanup()
         free(pTempEntry );
     }
     pVirtualMemory = NULL;
+    pVirtualMemoryTree = NULL;
 
-    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALLeaveLock();
 
-    TRACE( "Deleting the Virtual Critical Sections. \n" );
-    DeleteCriticalSection( &virtual_critsec );
+    TRACE( "Deleting the Virtual Lock. \n" );
+    pthread_rwlock_destroy( &virtual_lock );
 }
 
 /***
@@ -466,6 +499,168 @@ static BOOL VIRTUALSetAllocState( UINT nAction, SIZE_T nStartingBit,
                               nNumberOfBits, pInformation->pAllocState);
 }
 
+/****
+ *
+ * Helpers that maintain the AVL tree of allocated blocks. The blocks never
+ * overlap, so ordering them by their start address is enough to find the
+ * block containing any address.
+ *
+ * NOTE: The caller must own the lock exclusively.
+ */
+static inline int VIRTUALTreeHeight( PCMI pEntry )
+{
+    return pEntry ? pEntry->treeHeight : 0;
+}
+
+static inline void VIRTUALTreeUpdateHeight( PCMI pEntry )
+{
+    int leftHeight = VIRTUALTreeHeight( pEntry->pLeft );
+    int rightHeight = VIRTUALTreeHeight( pEntry->pRight );
+
+    pEntry->treeHeight = 1 + ( leftHeight > rightHeight ? leftHeight : rightHeight );
+}
+
+static PCMI VIRTUALTreeRotateLeft( PCMI pEntry )
+{
+    PCMI pNewRoot = pEntry->pRight;
+
+    pEntry->pRight = pNewRoot->pLeft;
+    pNewRoot->pLeft = pEntry;
+
+    VIRTUALTreeUpdateHeight( pEntry );
+    VIRTUALTreeUpdateHeight( pNewRoot );
+    return pNewRoot;
+}
+
+static PCMI VIRTUALTreeRotateRight( PCMI pEntry )
+{
+    PCMI pNewRoot = pEntry->pLeft;
+
+    pEntry->pLeft = pNewRoot->pRight;
+    pNewRoot->pRight = pEntry;
+
+    VIRTUALTreeUpdateHeight( pEntry );
+    VIRTUALTreeUpdateHeight( pNewRoot );
+    return pNewRoot;
+}
+
+/* Restores the AVL invariant at pEntry and returns the new subtree root. */
+static PCMI VIRTUALTreeBalance( PCMI pEntry )
+{
+    int balance;
+
+    VIRTUALTreeUpdateHeight( pEntry );
+    balance = VIRTUALTreeHeight( pEntry->pLeft ) - VIRTUALTreeHeight( pEntry->pRight );
+
+    if ( balance > 1 )
+    {
+        if ( VIRTUALTreeHeight( pEntry->pLeft->pLeft ) < VIRTUALTreeHeight( pEntry->pLeft->pRight ) )
+        {
+            pEntry->pLeft = VIRTUALTreeRotateLeft( pEntry->pLeft );
+        }
+        return VIRTUALTreeRotateRight( pEntry );
+    }
+
+    if ( balance < -1 )
+    {
+        if ( VIRTUALTreeHeight( pEntry->pRight->pRight ) < VIRTUALTreeHeight( pEntry->pRight->pLeft ) )
+        {
+            pEntry->pRight = VIRTUALTreeRotateRight( pEntry->pRight );
+        }
+        return VIRTUALTreeRotateLeft( pEntry );
+    }
+
+    return pEntry;
+}
+
+/*
+ * Inserts pNewEntry into the subtree rooted at pRoot and returns the new
+ * subtree root. *ppPrevious is set to the entry with the highest start address
+ * below pNewEntry's, if the subtree has one.
+ */
+static PCMI VIRTUALTreeInsert( PCMI pRoot, PCMI pNewEntry, PCMI * ppPrevious )
+{
+    if ( !pRoot )
+    {
+        pNewEntry->pLeft = NULL;
+        pNewEntry->pRight = NULL;
+        pNewEntry->treeHeight = 1;
+        return pNewEntry;
+    }
+
+    _ASSERTE( pNewEntry->startBoundary != pRoot->startBoundary );
+
+    if ( pNewEntry->startBoundary < pRoot->startBoundary )
+    {
+        pRoot->pLeft = VIRTUALTreeInsert( pRoot->pLeft, pNewEntry, ppPrevious );
+    }
+    else
+    {
+        *ppPrevious = pRoot;
+        pRoot->pRight = VIRTUALTreeInsert( pRoot->pRight, pNewEntry, ppPrevious );
+    }
+
+    return VIRTUALTreeBalance( pRoot );
+}
+
+/*
+ * Unlinks the lowest addressed entry of the subtree rooted at pRoot, returns
+ * it in *ppMinimum and returns the new subtree root.
+ */
+static PCMI VIRTUALTreeRemoveMinimum( PCMI pRoot, PCMI * ppMinimum )
+{
+    if ( !pRoot->pLeft )
+    {
+        *ppMinimum = pRoot;
+        return pRoot->pRight;
+    }
+
+    pRoot->pLeft = VIRTUALTreeRemoveMinimum( pRoot->pLeft, ppMinimum );
+    return VIRTUALTreeBalance( pRoot );
+}
+
+/*
+ * Unlinks pEntry from the subtree rooted at pRoot and returns the new subtree
+ * root.
+ */
+static PCMI VIRTUALTreeRemove( PCMI pRoot, PCMI pEntry )
+{
+    _ASSERTE( pRoot );
+
+    if ( pEntry->startBoundary < pRoot->startBoundary )
+    {
+        pRoot->pLeft = VIRTUALTreeRemove( pRoot->pLeft, pEntry );
+    }
+    else if ( pEntry->startBoundary > pRoot->startBoundary )
+    {
+        pRoot->pRight = VIRTUALTreeRemove( pRoot->pRight, pEntry );
+    }
+    else
+    {
+        PCMI pSuccessor = NULL;
+        PCMI pRight;
+
+        _ASSERTE( pRoot == pEntry );
+
+        if ( !pEntry->pLeft )
+        {
+            return pEntry->pRight;
+        }
+        if ( !pEntry->pRight )
+        {
+            return pEntry->pLeft;
+        }
+
+        /* Put the next entry in the removed entry's place. */
+        pRight = VIRTUALTreeRemoveMinimum( pEntry->pRight, &pSuccessor );
+        pSuccessor->pRight = pRight;
+        pSuccessor->pLeft = pEntry->pLeft;
+        pRoot = pSuccessor;
+    }
+
+    return VIRTUALTreeBalance( pRoot );
+}
+
 /****
  *
  * VIRTUALFindRegionInformation( )
@@ -480,22 +675,22 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
-    pEntry = pVirtualMemory;
+    pEntry = pVirtualMemoryTree;
 
     while( pEntry )
     {
         if ( pEntry->startBoundary > address )
         {
-            /* Gone past the possible location in the list. */
-            pEntry = NULL;
-            break;
+            pEntry = pEntry->pLeft;
         }
-        if ( pEntry->startBoundary + pEntry->memSize > address )
+        else if ( pEntry->startBoundary + pEntry->memSize > address )
         {
             break;
         }
-
-        pEntry = pEntry->pNext;
+        else
+        {
+            pEntry = pEntry->pRight;
+        }
     }
     return pEntry;
 }
@@ -505,7 +700,7 @@ Function :
 
     VIRTUALReleaseMemory
 
-    Removes a PCMI entry from the list.
+    Removes a PCMI entry from the list and the tree.
 
     Returns true on success. FALSE otherwise.
 --*/
@@ -519,6 +714,8 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    pVirtualMemoryTree = VIRTUALTreeRemove( pVirtualMemoryTree, pMemoryToBeReleased );
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -648,9 +845,8 @@ static void VIRTUALDisplayList( void  )
     PCMI p;
     SIZE_T count;
     SIZE_T index;
-    CPalThread * pthrCurrent = InternalGetCurrentThread();
 
-    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALEnterReadLock();
 
     p = pVirtualMemory;
     count = 0;
@@ -680,7 +876,7 @@ static void VIRTUALDisplayList( void  )
         p = p->pNext;
     }
 
-    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALLeaveLock();
 }
 #endif
 
@@ -711,8 +907,8 @@ void VerifyLeftEntry(PCMI pEntry)
 /****
  *  VIRTUALStoreAllocationInfo()
  *
- *      Stores the allocation information in the linked list.
- *      NOTE: The caller must own the critical section.
+ *      Stores the allocation information in the linked list and the tree.
+ *      NOTE: The caller must own the lock exclusively.
  */
 static BOOL VIRTUALStoreAllocationInfo(
             IN UINT_PTR startBoundary,  /* Start of the region. */
@@ -774,17 +970,11 @@ static BOOL VIRTUALStoreAllocationInfo(
         return FALSE;
     }
 
-    pMemInfo = pVirtualMemory;
+    /* The tree finds the entry to link the new one after in the list. */
+    pVirtualMemoryTree = VIRTUALTreeInsert(pVirtualMemoryTree, pNewEntry, &pMemInfo);
 
-    if (pMemInfo && pMemInfo->startBoundary < startBoundary)
+    if (pMemInfo)
     {
-        /* Look for the correct insert point */
-        TRACE("Looking for the correct insert location.\n");
-        while (pMemInfo->pNext && (pMemInfo->pNext->startBoundary < startBoundary))
-        {
-            pMemInfo = pMemInfo->pNext;
-        }
-
         pNewEntry->pNext = pMemInfo->pNext;
         pNewEntry->pPrevious = pMemInfo;
 
@@ -798,7 +988,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     else
     {
         /* This is the first entry in the list. */
-        pNewEntry->pNext = pMemInfo;
+        pNewEntry->pNext = pVirtualMemory;
         pNewEntry->pPrevious = nullptr;
 
         if (pNewEntry->pNext)
@@ -1271,8 +1461,7 @@ PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange(
     // ExecutableMemoryAllocator::AllocateMemory() for the reason why it is done
     SIZE_T reservationSize = ALIGN_UP(dwSize, VIRTUAL_64KB);
 
-    CPalThread *currentThread = InternalGetCurrentThread();
-    InternalEnterCriticalSection(currentThread, &virtual_critsec);
+    VIRTUALEnterWriteLock();
 
     void *address = g_executableMemoryAllocator.AllocateMemoryWithinRange(lpBeginAddress, lpEndAddress, reservationSize);
     if (address != nullptr)
@@ -1295,7 +1484,7 @@ PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange(
         address,
         TRUE);
 
-    InternalLeaveCriticalSection(currentThread, &virtual_critsec);
+    VIRTUALLeaveLock();
 
     LOGEXIT("PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange returning %p\n", address);
     PERF_EXIT(PAL_VirtualReserveFromExecutableMemoryAllocatorWithinRange);
@@ -1379,9 +1568,9 @@ VirtualAlloc(
             goto done;
         }
 
-        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        VIRTUALEnterWriteLock();
         pRetVal = VIRTUALResetMemory( pthrCurrent, lpAddress, dwSize );
-        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+        VIRTUALLeaveLock();
 
         if ( !pRetVal )
         {
@@ -1392,9 +1581,9 @@ VirtualAlloc(
 
     if ( flAllocationType & MEM_RESERVE )
     {
-        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        VIRTUALEnterWriteLock();
         pRetVal = VIRTUALReserveMemory( pthrCurrent, lpAddress, dwSize, flAllocationType, flProtect );
-        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+        VIRTUALLeaveLock();
 
         if ( !pRetVal )
         {
@@ -1405,7 +1594,7 @@ VirtualAlloc(
 
     if ( flAllocationType & MEM_COMMIT )
     {
-        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        VIRTUALEnterWriteLock();
         if ( pRetVal != NULL )
         {
             /* We are reserving and committing. */
@@ -1418,7 +1607,7 @@ VirtualAlloc(
             pRetVal = VIRTUALCommitMemory( pthrCurrent, lpAddress, dwSize,
                                     flAllocationType, flProtect );
         }
-        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+        VIRTUALLeaveLock();
     }
 
 done:
@@ -1451,7 +1640,7 @@ VirtualFree(
           lpAddress, dwSize, dwFreeType);
 
     pthrCurrent = InternalGetCurrentThread();
-    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALEnterWriteLock();
 
     /* Sanity Checks. */
     if ( !lpAddress )
@@ -1606,7 +1795,7 @@ VirtualFreeExit:
         NULL,
         bRetVal);
 
-    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALLeaveLock();
     LOGEXIT( "VirtualFree returning %s.\n", bRetVal == TRUE ? "TRUE" : "FALSE" );
     PERF_EXIT(VirtualFree);
     return bRetVal;
@@ -1642,7 +1831,7 @@ VirtualProtect(
           lpAddress, dwSize, flNewProtect, lpflOldProtect);
 
     pthrCurrent = InternalGetCurrentThread();
-    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALEnterWriteLock();
 
     StartBoundary = (UINT_PTR) ALIGN_DOWN(lpAddress, GetVirtualPageSize());
     MemSize = ALIGN_UP((UINT_PTR)lpAddress + dwSize, GetVirtualPageSize()) - StartBoundary;
@@ -1724,7 +1913,7 @@ VirtualProtect(
         }
     }
 ExitVirtualProtect:
-    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALLeaveLock();
 
 #if defined _DEBUG
     VIRTUALDisplayList();
@@ -1897,7 +2086,7 @@ VirtualQuery(
           lpAddress, lpBuffer, dwLength);
 
     pthrCurrent = InternalGetCurrentThread();
-    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALEnterReadLock();
 
     if ( !lpBuffer)
     {
@@ -2000,7 +2189,7 @@ VirtualQuery(
 
 ExitVirtualQuery:
 
-    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+    VIRTUALLeaveLock();
 
     LOGEXIT( "VirtualQuery returning %d.\n", sizeof( *lpBuffer ) );
     PERF_EXIT(VirtualQuery);
@@ -2066,9 +2255,9 @@ Function :
 void* ReserveMemoryFromExecutableAllocator(CPalThread* pThread, SIZE_T allocationSize)
 {
 #ifdef BIT64
-    InternalEnterCriticalSection(pThread, &virtual_critsec);
+    VIRTUALEnterWriteLock();
     void* mem = g_executableMemoryAllocator.AllocateMemory(allocationSize);
-    InternalLeaveCriticalSection(pThread, &virtual_critsec);
+    VIRTUALLeaveLock();
 
     return mem;
 #else // !BIT64
@@ -2205,7 +2394,7 @@ Function:
     address space. The function will return null if the allocation request cannot
     be satisfied by the memory that is currently available in the allocator.
 
-    Note: This function MUST be called with the virtual_critsec lock held.
+    Note: This function MUST be called with the virtual_lock held exclusively.
 
 --*/
 void* ExecutableMemoryAllocator::AllocateMemory(SIZE_T allocationSize)
@@ -2220,7 +2409,7 @@ void* ExecutableMemoryAllocator::AllocateMemory(SIZE_T allocationSize)
     // would fail in VIRTUALReserveMemory.
     _ASSERTE(IS_ALIGNED(allocationSize, VIRTUAL_64KB));
 
-    // The code below assumes that the caller owns the virtual_critsec lock.
+    // The code below assumes that the caller owns the virtual_lock exclusively.
     // So the calculations are not done in thread-safe manner.
     if ((allocationSize > 0) && (allocationSize <= (SIZE_T)m_remainingReservedMemory))
     {
@@ -2244,7 +2433,7 @@ Function:
     null if the allocation request cannot satisfied by the memory that is currently available in
     the allocator.
 
-    Note: This function MUST be called with the virtual_critsec lock held.
+    Note: This function MUST be called with the virtual_lock held exclusively.
 --*/
 void *ExecutableMemoryAllocator::AllocateMemoryWithinRange(const void *beginAddress, const void *endAddress, SIZE_T allocationSize)
 {
@@ -2255,7 +2444,7 @@ void *ExecutableMemoryAllocator::AllocateMemoryWithinRange(const void *beginAddr
     // AllocateMemory() for the reason why it is necessary
     _ASSERTE(IS_ALIGNED(allocationSize, VIRTUAL_64KB));
 
-    // The code below assumes that the caller owns the virtual_critsec lock.
+    // The code below assumes that the caller owns the virtual_lock exclusively.
     // So the calculations are not done in thread-safe manner.
 
     if (allocationSize == 0 || allocationSize > (SIZE_T)m_remainingReservedMemory)
@@ -953,8 +953,6 @@ CSharedMemoryObjectManager::ReferenceMultipleObjectsByHandleArray(
         rgpobjs
         );
 
-    m_HandleManager.Lock(pthr);
-
     for (dw = 0; dw < dwHandleCount; dw += 1)
     {        
         palError = m_HandleManager.GetObjectFromHandle(
@@ -990,15 +988,6 @@ CSharedMemoryObjectManager::ReferenceMultipleObjectsByHandleArray(
         }
     }
 
-    //
-    // The handle manager lock must be released before releasing
-    // any object references, as ReleaseReference will acquire
-    // the object manager list lock (which needs to be acquired before
-    // the handle manager lock)
-    //
-
-    m_HandleManager.Unlock(pthr);
-
     if (NO_ERROR != palError)
     {
         //
@@ -19,6 +19,7 @@
 #include "pal/dbgmsg.h"
 #include "pal/init.h"
 #include "pal/process.h"
+#include "pal/futex.hpp"
 
 #include <sched.h>
 #include <pthread.h>
@@ -1235,6 +1236,27 @@ namespace CorUnix
 
         CS_TRACE("Trying to go to sleep [CS=%p]\n", pPalCriticalSection);
 
+#if HAVE_FUTEX
+        // The predicate is the futex word: sleep until a waker sets it to 1
+        // and consume the wake up by setting it back to 0
+        CS_TRACE("Actually Going to sleep [CS=%p]\n", pPalCriticalSection);
+
+        while (1 != InterlockedCompareExchange(
+                   (LONG *)&pPalCriticalSection->csndNativeData.iPredicate, 0, 1))
+        {
+            iRet = PALFutexWait(&pPalCriticalSection->csndNativeData.iPredicate, 0, NULL);
+
+            CS_TRACE("Woken up on futex [pred=%d]!\n",
+                     pPalCriticalSection->csndNativeData.iPredicate);
+            if (0 != iRet && EAGAIN != iRet && EINTR != iRet)
+            {
+                ASSERT("Failed waiting on futex in CS %p [err=%d]\n",
+                       pPalCriticalSection, iRet);
+                palErr = ERROR_INTERNAL_ERROR;
+                goto PCDAW_exit;
+            }
+        }
+#else // HAVE_FUTEX
         // Lock the mutex
         iRet = pthread_mutex_lock(&pPalCriticalSection->csndNativeData.mutex);
         if (0 != iRet)
@@ -1274,6 +1296,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             goto PCDAW_exit;
         }
+#endif // HAVE_FUTEX
         
     PCDAW_exit:
         
@@ -1296,6 +1319,24 @@ namespace CorUnix
         _ASSERT_MSG(PalCsFullyInitialized == pPalCriticalSection->cisInitState,
                     "Trying to wake up a waiter on CS not fully initialized\n");
 
+#if HAVE_FUTEX
+        // Set the predicate and wake up one of the threads sleeping on it.
+        // At most one wake up is outstanding at any time (the awakened
+        // waiter bit in LockCount guarantees it), so there is no count to
+        // keep here
+        InterlockedExchange((LONG *)&pPalCriticalSection->csndNativeData.iPredicate, 1);
+
+        CS_TRACE("Waking up futex waiter [pred=%d]!\n",
+                 pPalCriticalSection->csndNativeData.iPredicate);
+
+        iRet = PALFutexWake(&pPalCriticalSection->csndNativeData.iPredicate, 1);
+        if (0 != iRet)
+        {
+            ASSERT("Failed waking futex waiter in CS %p [ret=%d]\n",
+                   pPalCriticalSection, iRet);
+            palErr = ERROR_INTERNAL_ERROR;
+        }
+#else // HAVE_FUTEX
         // Lock the mutex
         iRet = pthread_mutex_lock(&pPalCriticalSection->csndNativeData.mutex);
         if (0 != iRet)
@@ -1328,6 +1369,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             goto PCWUW_exit;
         }
+#endif // HAVE_FUTEX
 
     PCWUW_exit:
         return palErr;
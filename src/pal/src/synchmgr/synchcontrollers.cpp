@@ -831,6 +831,9 @@ namespace CorUnix
             }
             else
             {
+#if HAVE_EVENTFD
+                CloseSignalFd();
+#endif // HAVE_EVENTFD
                 pSynchManager->CacheAddLocalSynchData(pthrCurrent, this);
             }            
         }
@@ -838,6 +841,96 @@ namespace CorUnix
         return lCount;
     }
 
+    /*++
+    Method:
+      CSynchData::GetSignalFd
+
+    Returns an eventfd that is readable for as long as the object's signal
+    count is greater than zero, creating it on first use. The descriptor is
+    owned by the SynchData and stays valid until its final release.
+
+    Note: this method must be called while holding the local process synch 
+          lock, and only for local objects.
+    --*/
+    PAL_ERROR CSynchData::GetSignalFd(int * piSignalFd)
+    {
+        VALIDATEOBJECT(this);
+
+        _ASSERT_MSG(ProcessLocalObject == m_odObjectDomain,
+                    "Signal fd requested for a shared object\n");
+
+#if HAVE_EVENTFD
+        if (-1 == m_iSignalFd)
+        {
+            int iFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (-1 == iFd)
+            {
+                ERROR("eventfd() failed [errno=%d (%s)]\n", errno, strerror(errno));
+                return (EMFILE == errno || ENFILE == errno) ? 
+                    ERROR_TOO_MANY_OPEN_FILES : ERROR_NOT_ENOUGH_MEMORY;
+            }
+
+            m_iSignalFd = iFd;
+            m_fSignalFdSet = false;
+            UpdateSignalFd();
+        }
+
+        *piSignalFd = m_iSignalFd;
+        return NO_ERROR;
+#else // HAVE_EVENTFD
+        return ERROR_NOT_SUPPORTED;
+#endif // HAVE_EVENTFD
+    }
+
+#if HAVE_EVENTFD
+    /*++
+    Method:
+      CSynchData::SetSignalFdState
+
+    Makes the signal fd readable (fSignaled == true) or drains it. Called
+    by UpdateSignalFd whenever the signal count moves to or from zero.
+    --*/
+    void CSynchData::SetSignalFdState(bool fSignaled)
+    {
+        uint64_t u64Value = 1;
+        ssize_t sszRet;
+
+        _ASSERTE(-1 != m_iSignalFd);
+
+        do
+        {
+            sszRet = fSignaled ?
+                write(m_iSignalFd, &u64Value, sizeof(u64Value)) :
+                read(m_iSignalFd, &u64Value, sizeof(u64Value));
+        } while (-1 == sszRet && EINTR == errno);
+
+        // The counter only ever toggles between 0 and 1, so neither call
+        // can fail with EAGAIN
+        _ASSERT_MSG(sizeof(u64Value) == sszRet,
+                    "Unable to update signal fd %d [errno=%d]\n", 
+                    m_iSignalFd, errno);
+
+        m_fSignalFdSet = fSignaled;
+    }
+
+    /*++
+    Method:
+      CSynchData::CloseSignalFd
+
+    Closes the signal fd, if any. Wait ports hold their own duplicate of
+    the descriptor, so they are not affected.
+    --*/
+    void CSynchData::CloseSignalFd(void)
+    {
+        if (-1 != m_iSignalFd)
+        {
+            close(m_iSignalFd);
+            m_iSignalFd = -1;
+            m_fSignalFdSet = false;
+        }
+    }
+#endif // HAVE_EVENTFD
+
     /*++
     Method:
       CSynchData::ReleaseWaiterWithoutBlocking
@@ -1054,6 +1147,8 @@ namespace CorUnix
         _ASSERT_MSG(otiMutex != m_otiObjectTypeId || m_lSignalCount <= 1,
                     "Mutex with invalid singal count\n");
 
+        UpdateSignalFd();
+
         return;
     }
 
@@ -23,6 +23,7 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 
 #include "synchmanager.hpp"
 #include "pal/file.hpp"
+#include "pal/futex.hpp"
 
 #include <sys/types.h>
 #include <sys/time.h>
@@ -474,6 +475,26 @@ namespace CorUnix
 
         while (FALSE == ptnwdNativeWaitData->iPred)
         {
+#if HAVE_FUTEX
+            // Sleep on the predicate itself rather than on the condition.
+            // The mutex still has to be held while checking and resetting
+            // the predicate, since thread suspension relies on it
+            iRet = pthread_mutex_unlock(&ptnwdNativeWaitData->mutex);
+            _ASSERT_MSG(0 == iRet, "Cannot unlock mutex [err=%d]\n", iRet);
+
+            iWaitRet = PALFutexWait(&ptnwdNativeWaitData->iPred, FALSE,
+                                    (INFINITE == dwTimeout) ? NULL : &tsAbsTmo);
+
+            iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
+            _ASSERT_MSG(0 == iRet, "Cannot lock mutex [err=%d]\n", iRet);
+
+            if (EAGAIN == iWaitRet || EINTR == iWaitRet)
+            {
+                // The predicate changed before going to sleep, or the
+                // sleep was interrupted: just check it again
+                iWaitRet = 0;
+            }
+#else // HAVE_FUTEX
             if (INFINITE == dwTimeout)
             {
                 iWaitRet = pthread_cond_wait(&ptnwdNativeWaitData->cond,
@@ -485,6 +506,7 @@ namespace CorUnix
                                                   &ptnwdNativeWaitData->mutex,
                                                   &tsAbsTmo);
             }
+#endif // HAVE_FUTEX
 
             if (ETIMEDOUT == iWaitRet)
             {
@@ -494,8 +516,8 @@ namespace CorUnix
             }
             else if (0 != iWaitRet)
             {
-                ERROR("pthread_cond_%swait returned %d [errno=%d (%s)]\n",
-                       (INFINITE == dwTimeout) ? "" : "timed",
+                ERROR("Native %swait returned %d [errno=%d (%s)]\n",
+                       (INFINITE == dwTimeout) ? "" : "timed ",
                        iWaitRet, errno, strerror(errno));
                 palErr = ERROR_INTERNAL_ERROR;
                 break;
@@ -935,6 +957,65 @@ namespace CorUnix
         return palErr;
     }
 
+    /*++
+    Method:
+      CPalSynchronizationManager::GetObjectSignalFd
+
+    Returns a duplicate of the signal fd of the given object (see 
+    CSynchData::GetSignalFd). The caller owns the returned descriptor.
+    --*/
+    PAL_ERROR CPalSynchronizationManager::GetObjectSignalFd(
+        CPalThread *pthrCurrent,
+        IPalObject *pObject,
+        int *piSignalFd)
+    {
+        PAL_ERROR palErr = NO_ERROR;
+        CSynchData * psdSynchData;
+        int iSignalFd;
+        PalObjectTypeId otiObjectTypeId = pObject->GetObjectType()->GetId();
+
+        if (otiAutoResetEvent != otiObjectTypeId &&
+            otiManualResetEvent != otiObjectTypeId &&
+            otiSemaphore != otiObjectTypeId)
+        {
+            return ERROR_NOT_SUPPORTED;
+        }
+
+        AcquireLocalSynchLock(pthrCurrent);
+
+        if (ProcessLocalObject != pObject->GetObjectDomain())
+        {
+            palErr = ERROR_NOT_SUPPORTED;
+            goto GOSF_exit;
+        }
+
+        palErr = pObject->GetObjectSynchData((void **)&psdSynchData);
+        if (NO_ERROR != palErr)
+        {
+            goto GOSF_exit;
+        }
+
+        VALIDATEOBJECT(psdSynchData);
+
+        palErr = psdSynchData->GetSignalFd(&iSignalFd);
+        if (NO_ERROR != palErr)
+        {
+            goto GOSF_exit;
+        }
+
+        *piSignalFd = fcntl(iSignalFd, F_DUPFD_CLOEXEC, 0);
+        if (-1 == *piSignalFd)
+        {
+            ERROR("Unable to duplicate signal fd %d [errno=%d (%s)]\n", 
+                  iSignalFd, errno, strerror(errno));
+            palErr = ERROR_TOO_MANY_OPEN_FILES;
+        }
+
+    GOSF_exit:
+        ReleaseLocalSynchLock(pthrCurrent);
+        return palErr;
+    }
+
     /*++
     Method:
       CPalSynchronizationManager::AllocateObjectSynchData
@@ -2468,6 +2549,19 @@ namespace CorUnix
         // Set the predicate
         ptnwdNativeWaitData->iPred = TRUE;
 
+#if HAVE_FUTEX
+        // Wake up the target thread while still holding the mutex: the
+        // target cannot leave ThreadNativeWait before the mutex is released,
+        // which keeps its native wait data alive across the wake up
+        iRet = PALFutexWake(&ptnwdNativeWaitData->iPred, 1);
+        if (0 != iRet)
+        {
+            ERROR("Failed to wake up thread: futex wake returned %d (%s)\n",
+                  iRet, strerror(iRet));
+            palErr = ERROR_INTERNAL_ERROR;
+            // Continue in order to unlock the mutex anyway
+        }
+#else // HAVE_FUTEX
         // Signal the condition
         iRet = pthread_cond_signal(&ptnwdNativeWaitData->cond);
         if (0 != iRet)
@@ -2478,6 +2572,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             // Continue in order to unlock the mutex anyway
         }
+#endif // HAVE_FUTEX
 
         // Unlock the mutex
         iRet = pthread_mutex_unlock(&ptnwdNativeWaitData->mutex);
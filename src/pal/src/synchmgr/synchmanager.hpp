@@ -34,6 +34,9 @@ Abstract:
 #if HAVE_KQUEUE
 #include <sys/event.h>
 #endif // HAVE_KQUEUE
+#if HAVE_EVENTFD
+#include <sys/eventfd.h>
+#endif // HAVE_EVENTFD
 #include "pal/dbgmsg.h"
 
 #ifdef _DEBUG
@@ -165,6 +168,13 @@ namespace CorUnix
         OwnedObjectsListNode * m_poolnOwnedObjectListNode;
         bool m_fAbandoned;
 
+#if HAVE_EVENTFD
+        // Eventfd mirroring the signaled state of the object for wait
+        // ports (see waitport.cpp); created on demand, local objects only
+        int m_iSignalFd;
+        bool m_fSignalFdSet;
+#endif // HAVE_EVENTFD
+
 #ifdef SYNCH_STATISTICS
         ULONG m_lStatWaitCount;
         ULONG m_lStatContentionCount;
@@ -176,6 +186,9 @@ namespace CorUnix
               m_lSignalCount(0), m_lOwnershipCount(0), m_dwOwnerPid(0),
               m_dwOwnerTid(0), m_pOwnerThread(NULL), 
               m_poolnOwnedObjectListNode(NULL), m_fAbandoned(false)
+#if HAVE_EVENTFD
+              , m_iSignalFd(-1), m_fSignalFdSet(false)
+#endif // HAVE_EVENTFD
         { 
             // m_ptrWTLHead, m_ptrWTLTail, m_odObjectDomain 
             // and m_otiObjectTypeId are initialized by
@@ -274,12 +287,31 @@ namespace CorUnix
             _ASSERTE(m_lSignalCount >= 0);
             _ASSERTE(lSignalCount >= 0);
             m_lSignalCount = lSignalCount; 
+            UpdateSignalFd();
         }
         LONG DecrementSignalCount(void) 
         {
             _ASSERTE(m_lSignalCount > 0);
-            return --m_lSignalCount; 
+            LONG lCount = --m_lSignalCount; 
+            UpdateSignalFd();
+            return lCount;
+        }
+
+        // Signal fd accessor methods. The local synch lock must be held.
+        PAL_ERROR GetSignalFd(int * piSignalFd);
+        void UpdateSignalFd(void)
+        {
+#if HAVE_EVENTFD
+            if (-1 != m_iSignalFd && (m_lSignalCount > 0) != m_fSignalFdSet)
+            {
+                SetSignalFdState(m_lSignalCount > 0);
+            }
+#endif // HAVE_EVENTFD
         }
+#if HAVE_EVENTFD
+        void SetSignalFdState(bool fSignaled);
+        void CloseSignalFd(void);
+#endif // HAVE_EVENTFD
 
         // Object ownership accessor methods
         void SetOwner(CPalThread * pOwnerThread);
@@ -841,6 +873,11 @@ namespace CorUnix
             DWORD dwObjectCount,
             ISynchStateController *rgControllers[]);
 
+        virtual PAL_ERROR GetObjectSignalFd(
+            CPalThread *pthrCurrent,
+            IPalObject *pObject,
+            int *piSignalFd);
+
         virtual PAL_ERROR AllocateObjectSynchData(
             CObjectType *potObjectType,
             ObjectDomain odObjectDomain,
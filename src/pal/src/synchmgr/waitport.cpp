@@ -0,0 +1,599 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+/*++
+
+
+
+Module Name:
+
+    waitport.cpp
+
+Abstract:
+
+    Implementation of wait ports: waits on many events and semaphores
+    multiplexed onto a single epoll descriptor.
+
+    A waitable object added to a port is represented by a duplicate of its
+    signal fd (see CSynchData::GetSignalFd), an eventfd that the
+    synchronization manager keeps readable for as long as the object is
+    signaled. When epoll reports the fd readable the port acquires the
+    object with a zero timeout wait, which also takes care of the object
+    type's release semantics (auto-reset, semaphore count), so that
+    signaling an object never has to wake a thread blocked in the
+    synchronization manager.
+
+Revision History:
+
+
+
+--*/
+
+#include "pal/thread.hpp"
+#include "pal/synchobjects.hpp"
+#include "pal/handlemgr.hpp"
+#include "pal/event.hpp"
+#include "pal/semaphore.hpp"
+#include "pal/malloc.hpp"
+#include "pal/dbgmsg.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#if HAVE_EPOLL
+#include <sys/epoll.h>
+#endif // HAVE_EPOLL
+#if HAVE_EVENTFD
+#include <sys/eventfd.h>
+#endif // HAVE_EVENTFD
+
+SET_DEFAULT_DEBUG_CHANNEL(SYNC);
+
+using namespace CorUnix;
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+
+#define WAITPORT_MAX_EVENTS 64
+
+static PalObjectTypeId sg_rgWaitPortObjectIds[] =
+{
+    otiAutoResetEvent,
+    otiManualResetEvent,
+    otiSemaphore
+};
+static CAllowedObjectTypes sg_aotWaitPortObject(sg_rgWaitPortObjectIds, _countof(sg_rgWaitPortObjectIds));
+
+namespace
+{
+    struct WaitPort
+    {
+        int iEpollFd;
+        int iWakeFd;    // registered with a NULL registration pointer
+    };
+
+    struct WaitPortRegistration
+    {
+        HANDLE hObject;
+        PVOID pvContext;
+        int iSignalFd;
+    };
+
+    PAL_ERROR ErrnoToPalError(int iErrno)
+    {
+        switch (iErrno)
+        {
+        case EMFILE:
+        case ENFILE:
+            return ERROR_TOO_MANY_OPEN_FILES;
+        case ENOMEM:
+        case ENOSPC:
+            return ERROR_NOT_ENOUGH_MEMORY;
+        default:
+            return ERROR_INTERNAL_ERROR;
+        }
+    }
+
+    void DrainEventFd(int iFd)
+    {
+        uint64_t u64Value;
+        ssize_t sszRet;
+
+        do
+        {
+            sszRet = read(iFd, &u64Value, sizeof(u64Value));
+        } while (-1 == sszRet && EINTR == errno);
+    }
+}
+
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+/*++
+Function:
+  PAL_CreateWaitPort
+
+Creates a new wait port. Returns NULL with ERROR_NOT_SUPPORTED on
+platforms without epoll and eventfd.
+--*/
+PVOID
+PALAPI
+PAL_CreateWaitPort(VOID)
+{
+    PVOID pvRet = NULL;
+    CPalThread * pThread;
+
+    PERF_ENTRY(PAL_CreateWaitPort);
+    ENTRY("PAL_CreateWaitPort()\n");
+
+    pThread = InternalGetCurrentThread();
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = InternalNew<WaitPort>();
+    if (NULL == pPort)
+    {
+        pThread->SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+        goto PAL_CreateWaitPortExit;
+    }
+
+    pPort->iEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    pPort->iWakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (-1 == pPort->iEpollFd || -1 == pPort->iWakeFd)
+    {
+        ERROR("Unable to create wait port descriptors [errno=%d (%s)]\n",
+              errno, strerror(errno));
+        pThread->SetLastError(ErrnoToPalError(errno));
+        goto PAL_CreateWaitPortError;
+    }
+
+    {
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = NULL;
+        if (-1 == epoll_ctl(pPort->iEpollFd, EPOLL_CTL_ADD, pPort->iWakeFd, &ev))
+        {
+            ERROR("Unable to register wait port wake fd [errno=%d (%s)]\n",
+                  errno, strerror(errno));
+            pThread->SetLastError(ErrnoToPalError(errno));
+            goto PAL_CreateWaitPortError;
+        }
+    }
+
+    pvRet = pPort;
+    goto PAL_CreateWaitPortExit;
+
+PAL_CreateWaitPortError:
+    if (-1 != pPort->iEpollFd)
+    {
+        close(pPort->iEpollFd);
+    }
+    if (-1 != pPort->iWakeFd)
+    {
+        close(pPort->iWakeFd);
+    }
+    InternalDelete(pPort);
+
+PAL_CreateWaitPortExit:
+#else // HAVE_EPOLL && HAVE_EVENTFD
+    pThread->SetLastError(ERROR_NOT_SUPPORTED);
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_CreateWaitPort returns PVOID %p\n", pvRet);
+    PERF_EXIT(PAL_CreateWaitPort);
+    return pvRet;
+}
+
+/*++
+Function:
+  PAL_CloseWaitPort
+
+Closes a wait port. Every object must have been removed from it.
+--*/
+VOID
+PALAPI
+PAL_CloseWaitPort(
+    IN PVOID pvWaitPort)
+{
+    PERF_ENTRY(PAL_CloseWaitPort);
+    ENTRY("PAL_CloseWaitPort(pvWaitPort=%p)\n", pvWaitPort);
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = static_cast<WaitPort *>(pvWaitPort);
+    if (NULL != pPort)
+    {
+        close(pPort->iEpollFd);
+        close(pPort->iWakeFd);
+        InternalDelete(pPort);
+    }
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_CloseWaitPort returns VOID\n");
+    PERF_EXIT(PAL_CloseWaitPort);
+}
+
+/*++
+Function:
+  PAL_WaitPortCanAdd
+
+Returns TRUE if hObject is of a type that can be added to a wait port
+(events and semaphores). PAL_WaitPortAdd may still fail for lack of
+resources.
+--*/
+BOOL
+PALAPI
+PAL_WaitPortCanAdd(
+    IN HANDLE hObject)
+{
+    BOOL fRet = FALSE;
+
+    PERF_ENTRY(PAL_WaitPortCanAdd);
+    ENTRY("PAL_WaitPortCanAdd(hObject=%p)\n", hObject);
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    CPalThread * pThread = InternalGetCurrentThread();
+    IPalObject * pObject = NULL;
+
+    PAL_ERROR palErr = g_pObjectManager->ReferenceObjectByHandle(pThread,
+                                                                 hObject,
+                                                                 &sg_aotWaitPortObject,
+                                                                 SYNCHRONIZE,
+                                                                 &pObject);
+    if (NO_ERROR == palErr)
+    {
+        fRet = TRUE;
+        pObject->ReleaseReference(pThread);
+    }
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_WaitPortCanAdd returns BOOL %d\n", fRet);
+    PERF_EXIT(PAL_WaitPortCanAdd);
+    return fRet;
+}
+
+/*++
+Function:
+  PAL_WaitPortAdd
+
+Adds hObject to the port. pvContext is returned by PAL_WaitPortWait each
+time the port acquires the object; *ppvRegistration identifies the
+registration for PAL_WaitPortEnable and PAL_WaitPortRemove. The same
+object may be added more than once.
+
+If bEnable is FALSE the port does not acquire the object until the
+registration is enabled with PAL_WaitPortEnable. A disabled registration
+may be added and removed by any thread, since the port never reports it.
+--*/
+BOOL
+PALAPI
+PAL_WaitPortAdd(
+    IN PVOID pvWaitPort,
+    IN HANDLE hObject,
+    IN PVOID pvContext,
+    IN BOOL bEnable,
+    OUT PVOID *ppvRegistration)
+{
+    BOOL fRet = FALSE;
+
+    PERF_ENTRY(PAL_WaitPortAdd);
+    ENTRY("PAL_WaitPortAdd(pvWaitPort=%p, hObject=%p, pvContext=%p, bEnable=%d, ppvRegistration=%p)\n",
+          pvWaitPort, hObject, pvContext, bEnable, ppvRegistration);
+
+    CPalThread * pThread = InternalGetCurrentThread();
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = static_cast<WaitPort *>(pvWaitPort);
+    IPalObject * pObject = NULL;
+    WaitPortRegistration * pReg = NULL;
+    int iSignalFd = -1;
+    struct epoll_event ev;
+
+    PAL_ERROR palErr = g_pObjectManager->ReferenceObjectByHandle(pThread,
+                                                                 hObject,
+                                                                 &sg_aotWaitPortObject,
+                                                                 SYNCHRONIZE,
+                                                                 &pObject);
+    if (NO_ERROR != palErr)
+    {
+        ERROR("Unable to add handle %p to a wait port [error=%u]\n", hObject, palErr);
+        pThread->SetLastError(ERROR_INVALID_HANDLE == palErr ? ERROR_INVALID_HANDLE : ERROR_NOT_SUPPORTED);
+        goto PAL_WaitPortAddExit;
+    }
+
+    palErr = g_pSynchronizationManager->GetObjectSignalFd(pThread, pObject, &iSignalFd);
+    pObject->ReleaseReference(pThread);
+    if (NO_ERROR != palErr)
+    {
+        pThread->SetLastError(palErr);
+        goto PAL_WaitPortAddExit;
+    }
+
+    pReg = InternalNew<WaitPortRegistration>();
+    if (NULL == pReg)
+    {
+        close(iSignalFd);
+        pThread->SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+        goto PAL_WaitPortAddExit;
+    }
+
+    pReg->hObject = hObject;
+    pReg->pvContext = pvContext;
+    pReg->iSignalFd = iSignalFd;
+
+    // An eventfd never reports EPOLLERR or EPOLLHUP, so a registration
+    // without EPOLLIN is never returned by epoll_wait
+    ev.events = bEnable ? EPOLLIN : 0;
+    ev.data.ptr = pReg;
+    if (-1 == epoll_ctl(pPort->iEpollFd, EPOLL_CTL_ADD, iSignalFd, &ev))
+    {
+        ERROR("epoll_ctl(EPOLL_CTL_ADD) failed [errno=%d (%s)]\n", errno, strerror(errno));
+        pThread->SetLastError(ErrnoToPalError(errno));
+        close(iSignalFd);
+        InternalDelete(pReg);
+        goto PAL_WaitPortAddExit;
+    }
+
+    *ppvRegistration = pReg;
+    fRet = TRUE;
+
+PAL_WaitPortAddExit:
+#else // HAVE_EPOLL && HAVE_EVENTFD
+    pThread->SetLastError(ERROR_NOT_SUPPORTED);
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_WaitPortAdd returns BOOL %d\n", fRet);
+    PERF_EXIT(PAL_WaitPortAdd);
+    return fRet;
+}
+
+/*++
+Function:
+  PAL_WaitPortEnable
+
+Enables a registration added with bEnable set to FALSE. Must not run
+concurrently with PAL_WaitPortWait on the same port. Modifying an existing
+epoll registration does not allocate, so this cannot fail for a valid
+registration.
+--*/
+VOID
+PALAPI
+PAL_WaitPortEnable(
+    IN PVOID pvWaitPort,
+    IN PVOID pvRegistration)
+{
+    PERF_ENTRY(PAL_WaitPortEnable);
+    ENTRY("PAL_WaitPortEnable(pvWaitPort=%p, pvRegistration=%p)\n",
+          pvWaitPort, pvRegistration);
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = static_cast<WaitPort *>(pvWaitPort);
+    WaitPortRegistration * pReg = static_cast<WaitPortRegistration *>(pvRegistration);
+    struct epoll_event ev;
+
+    ev.events = EPOLLIN;
+    ev.data.ptr = pReg;
+    if (-1 == epoll_ctl(pPort->iEpollFd, EPOLL_CTL_MOD, pReg->iSignalFd, &ev))
+    {
+        ASSERT("epoll_ctl(EPOLL_CTL_MOD) failed [errno=%d (%s)]\n", errno, strerror(errno));
+    }
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_WaitPortEnable returns VOID\n");
+    PERF_EXIT(PAL_WaitPortEnable);
+}
+
+/*++
+Function:
+  PAL_WaitPortRemove
+
+Removes a registration made by PAL_WaitPortAdd. Must not run concurrently
+with PAL_WaitPortWait on the same port, unless the registration was never
+enabled.
+--*/
+VOID
+PALAPI
+PAL_WaitPortRemove(
+    IN PVOID pvWaitPort,
+    IN PVOID pvRegistration)
+{
+    PERF_ENTRY(PAL_WaitPortRemove);
+    ENTRY("PAL_WaitPortRemove(pvWaitPort=%p, pvRegistration=%p)\n",
+          pvWaitPort, pvRegistration);
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = static_cast<WaitPort *>(pvWaitPort);
+    WaitPortRegistration * pReg = static_cast<WaitPortRegistration *>(pvRegistration);
+
+    // Closing the fd would remove it from the epoll set as well, but only
+    // once every duplicate of the underlying eventfd is closed
+    epoll_ctl(pPort->iEpollFd, EPOLL_CTL_DEL, pReg->iSignalFd, NULL);
+    close(pReg->iSignalFd);
+    InternalDelete(pReg);
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_WaitPortRemove returns VOID\n");
+    PERF_EXIT(PAL_WaitPortRemove);
+}
+
+/*++
+Function:
+  PAL_WaitPortWait
+
+Waits until at least one object added to the port can be acquired, the
+port is woken, or the timeout expires. Returns:
+  WAIT_OBJECT_0      - *pdwCount objects were acquired; their contexts
+                       are in rgpvContexts
+  WAIT_IO_COMPLETION - the port was woken by PAL_WaitPortWake; if
+                       bAlertable, pending APCs have been run
+  WAIT_TIMEOUT       - the timeout expired
+  WAIT_FAILED        - an object could not be waited on, e.g. because its
+                       handle was closed; see GetLastError
+
+As with alertable waits, pending APCs run before the port is waited on,
+and after the objects that were found signaled have been acquired.
+--*/
+DWORD
+PALAPI
+PAL_WaitPortWait(
+    IN PVOID pvWaitPort,
+    IN DWORD dwMilliseconds,
+    IN BOOL bAlertable,
+    OUT PVOID *rgpvContexts,
+    IN DWORD dwMaxCount,
+    OUT LPDWORD pdwCount)
+{
+    DWORD dwRet = WAIT_FAILED;
+
+    PERF_ENTRY(PAL_WaitPortWait);
+    ENTRY("PAL_WaitPortWait(pvWaitPort=%p, dwMilliseconds=%u, bAlertable=%d, "
+          "rgpvContexts=%p, dwMaxCount=%u, pdwCount=%p)\n",
+          pvWaitPort, dwMilliseconds, bAlertable, rgpvContexts, dwMaxCount, pdwCount);
+
+    CPalThread * pThread = InternalGetCurrentThread();
+
+    *pdwCount = 0;
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = static_cast<WaitPort *>(pvWaitPort);
+    struct epoll_event rgEvents[WAITPORT_MAX_EVENTS];
+    int iMaxEvents = (int)std::min(dwMaxCount, (DWORD)WAITPORT_MAX_EVENTS);
+    DWORD dwStart = GetTickCount();
+    DWORD dwCount = 0;
+    bool fWoken = false;
+    bool fFailed = false;
+
+    if (bAlertable &&
+        NO_ERROR == g_pSynchronizationManager->DispatchPendingAPCs(pThread))
+    {
+        // Consume the wake that came with the APCs, so that it does not cut
+        // the next wait short. An APC queued in between is run by the next
+        // alertable wait before it blocks.
+        DrainEventFd(pPort->iWakeFd);
+        dwRet = WAIT_IO_COMPLETION;
+        goto PAL_WaitPortWaitExit;
+    }
+
+    while (dwCount == 0 && !fWoken && !fFailed)
+    {
+        int iTimeout = -1;
+        if (INFINITE != dwMilliseconds)
+        {
+            DWORD dwElapsed = GetTickCount() - dwStart;
+            DWORD dwRemaining = (dwElapsed < dwMilliseconds) ? dwMilliseconds - dwElapsed : 0;
+            iTimeout = (int)std::min(dwRemaining, (DWORD)INT_MAX);
+        }
+
+        int iEvents = epoll_wait(pPort->iEpollFd, rgEvents, iMaxEvents, iTimeout);
+        if (-1 == iEvents)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            ERROR("epoll_wait failed [errno=%d (%s)]\n", errno, strerror(errno));
+            pThread->SetLastError(ERROR_INTERNAL_ERROR);
+            goto PAL_WaitPortWaitExit;
+        }
+
+        if (0 == iEvents)
+        {
+            dwRet = WAIT_TIMEOUT;
+            goto PAL_WaitPortWaitExit;
+        }
+
+        for (int i = 0; i < iEvents; i++)
+        {
+            WaitPortRegistration * pReg = static_cast<WaitPortRegistration *>(rgEvents[i].data.ptr);
+
+            if (NULL == pReg)
+            {
+                DrainEventFd(pPort->iWakeFd);
+                fWoken = true;
+                continue;
+            }
+
+            // The object may have been acquired by another thread since the
+            // fd was reported readable; the zero timeout wait sorts that out
+            DWORD dwWaitRet = InternalWaitForMultipleObjectsEx(pThread, 1, &pReg->hObject,
+                                                               FALSE, 0, FALSE);
+            if (WAIT_OBJECT_0 == dwWaitRet)
+            {
+                rgpvContexts[dwCount++] = pReg->pvContext;
+            }
+            else if (WAIT_FAILED == dwWaitRet)
+            {
+                fFailed = true;
+            }
+        }
+    }
+
+    if (dwCount > 0)
+    {
+        dwRet = WAIT_OBJECT_0;
+    }
+    else if (fWoken)
+    {
+        dwRet = WAIT_IO_COMPLETION;
+    }
+    // else WAIT_FAILED, with the last error set by the failed wait
+
+    // Registrations may be removed by the APCs, so they run only once the
+    // events above have been consumed
+    if (fWoken && bAlertable)
+    {
+        g_pSynchronizationManager->DispatchPendingAPCs(pThread);
+    }
+
+    *pdwCount = dwCount;
+
+PAL_WaitPortWaitExit:
+#else // HAVE_EPOLL && HAVE_EVENTFD
+    pThread->SetLastError(ERROR_NOT_SUPPORTED);
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_WaitPortWait returns DWORD %u\n", dwRet);
+    PERF_EXIT(PAL_WaitPortWait);
+    return dwRet;
+}
+
+/*++
+Function:
+  PAL_WaitPortWake
+
+Makes the current or next PAL_WaitPortWait on the port return
+WAIT_IO_COMPLETION. Used after queueing an APC to the waiting thread.
+--*/
+BOOL
+PALAPI
+PAL_WaitPortWake(
+    IN PVOID pvWaitPort)
+{
+    BOOL fRet = FALSE;
+
+    PERF_ENTRY(PAL_WaitPortWake);
+    ENTRY("PAL_WaitPortWake(pvWaitPort=%p)\n", pvWaitPort);
+
+#if HAVE_EPOLL && HAVE_EVENTFD
+    WaitPort * pPort = static_cast<WaitPort *>(pvWaitPort);
+    uint64_t u64Value = 1;
+    ssize_t sszRet;
+
+    do
+    {
+        sszRet = write(pPort->iWakeFd, &u64Value, sizeof(u64Value));
+    } while (-1 == sszRet && EINTR == errno);
+
+    fRet = (sizeof(u64Value) == sszRet);
+    if (!fRet)
+    {
+        ERROR("Unable to wake wait port %p [errno=%d (%s)]\n", pvWaitPort, errno, strerror(errno));
+        InternalGetCurrentThread()->SetLastError(ERROR_INTERNAL_ERROR);
+    }
+#else // HAVE_EPOLL && HAVE_EVENTFD
+    InternalGetCurrentThread()->SetLastError(ERROR_NOT_SUPPORTED);
+#endif // HAVE_EPOLL && HAVE_EVENTFD
+
+    LOGEXIT("PAL_WaitPortWake returns BOOL %d\n", fRet);
+    PERF_EXIT(PAL_WaitPortWake);
+    return fRet;
+}
@@ -0,0 +1,327 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+/*============================================================
+**
+** Source: waitlatency.cpp
+**
+** Purpose: Measures the latency of PAL critical sections, events
+**          and semaphores, uncontended and contended.
+**
+**    Benchmarks:
+**      cs_uncontended      Enter/Leave a critical section nobody else uses
+**      cs_contended        THREAD_COUNT threads Enter/Leave the same
+**                          critical section; time per Enter/Leave pair
+**      event_signaled      SetEvent + WaitForSingleObject on an event
+**                          that is signaled, so the wait never blocks
+**      event_pingpong      Two threads wake each other up through a pair
+**                          of auto-reset events; time per round trip
+**      semaphore_pingpong  Same as event_pingpong with two semaphores
+**
+** Dependencies:
+**      CreateThread
+**      InitializeCriticalSection
+**      EnterCriticalSection
+**      LeaveCriticalSection
+**      DeleteCriticalSection
+**      CreateEvent
+**      SetEvent
+**      CreateSemaphoreW
+**      ReleaseSemaphore
+**      WaitForSingleObject
+**      WaitForMultipleObjects
+**      QueryPerformanceCounter
+**
+**=========================================================*/
+
+#include <palsuite.h>
+
+#define MAX_THREAD_COUNT 64
+
+unsigned int THREAD_COUNT = 4;
+unsigned int REPEAT_COUNT = 1000000;
+
+CRITICAL_SECTION g_cs;
+HANDLE g_hStartEvent;
+volatile LONG g_lCounter;
+
+/* The pair of objects the ping-pong threads signal each other with */
+HANDLE g_hPing;
+HANDLE g_hPong;
+BOOL g_fSemaphores;
+
+LARGE_INTEGER g_liFrequency;
+
+/*
+ * Returns the current time in nanoseconds
+ */
+double
+GetNanoseconds(VOID)
+{
+    LARGE_INTEGER liNow;
+
+    QueryPerformanceCounter(&liNow);
+    return (double)liNow.QuadPart * 1e9 / (double)g_liFrequency.QuadPart;
+}
+
+VOID
+Report(const char *pszName, unsigned int uOperations, double dStart)
+{
+    double dElapsed = GetNanoseconds() - dStart;
+
+    printf("%s,%u,%.1f\n", pszName, uOperations, dElapsed / uOperations);
+}
+
+VOID
+Signal(HANDLE hObject)
+{
+    BOOL fRet = g_fSemaphores ? ReleaseSemaphore(hObject, 1, NULL) : SetEvent(hObject);
+
+    if (!fRet)
+    {
+        Fail("Failed to signal %p. GetLastError returned %d\n", hObject, GetLastError());
+    }
+}
+
+VOID
+Wait(HANDLE hObject)
+{
+    if (WAIT_OBJECT_0 != WaitForSingleObject(hObject, INFINITE))
+    {
+        Fail("Failed to wait on %p. GetLastError returned %d\n", hObject, GetLastError());
+    }
+}
+
+DWORD
+PALAPI
+ContendCriticalSection(LPVOID lpParam)
+{
+    unsigned int i;
+
+    Wait(g_hStartEvent);
+
+    for (i = 0; i < REPEAT_COUNT; i++)
+    {
+        EnterCriticalSection(&g_cs);
+        g_lCounter++;
+        LeaveCriticalSection(&g_cs);
+    }
+
+    return 0;
+}
+
+DWORD
+PALAPI
+PongThread(LPVOID lpParam)
+{
+    unsigned int uRoundTrips = (unsigned int)(SIZE_T)lpParam;
+    unsigned int i;
+
+    for (i = 0; i < uRoundTrips; i++)
+    {
+        Wait(g_hPing);
+        Signal(g_hPong);
+    }
+
+    return 0;
+}
+
+VOID
+RunCriticalSectionBenchmarks(VOID)
+{
+    HANDLE hThreads[MAX_THREAD_COUNT];
+    DWORD dwThreadId;
+    unsigned int i;
+    double dStart;
+
+    InitializeCriticalSection(&g_cs);
+
+    dStart = GetNanoseconds();
+    for (i = 0; i < REPEAT_COUNT; i++)
+    {
+        EnterCriticalSection(&g_cs);
+        g_lCounter++;
+        LeaveCriticalSection(&g_cs);
+    }
+    Report("cs_uncontended", REPEAT_COUNT, dStart);
+
+    g_lCounter = 0;
+    for (i = 0; i < THREAD_COUNT; i++)
+    {
+        hThreads[i] = CreateThread(NULL, 0, ContendCriticalSection, NULL, 0, &dwThreadId);
+        if (NULL == hThreads[i])
+        {
+            Fail("CreateThread failed. GetLastError returned %d\n", GetLastError());
+        }
+    }
+
+    dStart = GetNanoseconds();
+    if (!SetEvent(g_hStartEvent))
+    {
+        Fail("SetEvent failed. GetLastError returned %d\n", GetLastError());
+    }
+    if (WAIT_OBJECT_0 != WaitForMultipleObjects(THREAD_COUNT, hThreads, TRUE, INFINITE))
+    {
+        Fail("WaitForMultipleObjects failed. GetLastError returned %d\n", GetLastError());
+    }
+    Report("cs_contended", THREAD_COUNT * REPEAT_COUNT, dStart);
+
+    if ((unsigned int)g_lCounter != THREAD_COUNT * REPEAT_COUNT)
+    {
+        Fail("The critical section did not provide mutual exclusion: counted %d "
+             "instead of %u\n", g_lCounter, THREAD_COUNT * REPEAT_COUNT);
+    }
+
+    for (i = 0; i < THREAD_COUNT; i++)
+    {
+        CloseHandle(hThreads[i]);
+    }
+    DeleteCriticalSection(&g_cs);
+}
+
+VOID
+RunPingPong(const char *pszName, BOOL fSemaphores)
+{
+    unsigned int uRoundTrips = REPEAT_COUNT / 10;
+    HANDLE hThread;
+    DWORD dwThreadId;
+    unsigned int i;
+    double dStart;
+
+    if (0 == uRoundTrips)
+    {
+        uRoundTrips = 1;
+    }
+
+    g_fSemaphores = fSemaphores;
+    if (fSemaphores)
+    {
+        g_hPing = CreateSemaphoreW(NULL, 0, 1, NULL);
+        g_hPong = CreateSemaphoreW(NULL, 0, 1, NULL);
+    }
+    else
+    {
+        g_hPing = CreateEvent(NULL, FALSE, FALSE, NULL);
+        g_hPong = CreateEvent(NULL, FALSE, FALSE, NULL);
+    }
+    if (NULL == g_hPing || NULL == g_hPong)
+    {
+        Fail("Failed to create the %s objects. GetLastError returned %d\n",
+             pszName, GetLastError());
+    }
+
+    hThread = CreateThread(NULL, 0, PongThread, (LPVOID)(SIZE_T)uRoundTrips, 0, &dwThreadId);
+    if (NULL == hThread)
+    {
+        Fail("CreateThread failed. GetLastError returned %d\n", GetLastError());
+    }
+
+    dStart = GetNanoseconds();
+    for (i = 0; i < uRoundTrips; i++)
+    {
+        Signal(g_hPing);
+        Wait(g_hPong);
+    }
+    Report(pszName, uRoundTrips, dStart);
+
+    Wait(hThread);
+    CloseHandle(hThread);
+    CloseHandle(g_hPing);
+    CloseHandle(g_hPong);
+}
+
+VOID
+RunEventBenchmarks(VOID)
+{
+    HANDLE hEvent;
+    unsigned int i;
+    double dStart;
+
+    hEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (NULL == hEvent)
+    {
+        Fail("CreateEvent failed. GetLastError returned %d\n", GetLastError());
+    }
+
+    g_fSemaphores = FALSE;
+    dStart = GetNanoseconds();
+    for (i = 0; i < REPEAT_COUNT; i++)
+    {
+        Signal(hEvent);
+        Wait(hEvent);
+    }
+    Report("event_signaled", REPEAT_COUNT, dStart);
+
+    CloseHandle(hEvent);
+
+    RunPingPong("event_pingpong", FALSE);
+}
+
+int GetParameters(int argc, char **argv)
+{
+    if (argc > 3 || (argc > 1 && (!strcmp(argv[1], "/?") || !strcmp(argv[1], "/h") || !strcmp(argv[1], "/H"))))
+    {
+        printf("PAL -Composite Wait Latency Test\n");
+        printf("Usage:\n");
+        printf("\t[THREAD_COUNT] Greater than or Equal to 1 and Less than or Equal to %d\n", MAX_THREAD_COUNT);
+        printf("\t[REPEAT_COUNT] Greater than or Equal to 1\n");
+        return -1;
+    }
+
+    if (argc > 1)
+    {
+        THREAD_COUNT = atoi(argv[1]);
+        if (THREAD_COUNT < 1 || THREAD_COUNT > MAX_THREAD_COUNT)
+        {
+            printf("\nTHREAD_COUNT to be greater than or equal to 1 or less than or equal to %d\n",
+                   MAX_THREAD_COUNT);
+            return -1;
+        }
+    }
+
+    if (argc > 2)
+    {
+        REPEAT_COUNT = atoi(argv[2]);
+        if (REPEAT_COUNT < 1)
+        {
+            printf("\nREPEAT_COUNT to be greater than or equal to 1\n");
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int __cdecl main(int argc, char **argv)
+{
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    if (GetParameters(argc, argv))
+    {
+        Fail("Error in obtaining the parameters\n");
+    }
+
+    if (!QueryPerformanceFrequency(&g_liFrequency))
+    {
+        Fail("QueryPerformanceFrequency failed. GetLastError returned %d\n", GetLastError());
+    }
+
+    g_hStartEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (NULL == g_hStartEvent)
+    {
+        Fail("CreateEvent failed. GetLastError returned %d\n", GetLastError());
+    }
+
+    RunCriticalSectionBenchmarks();
+    RunEventBenchmarks();
+    RunPingPong("semaphore_pingpong", TRUE);
+
+    CloseHandle(g_hStartEvent);
+
+    PAL_Terminate();
+    return PASS;
+}
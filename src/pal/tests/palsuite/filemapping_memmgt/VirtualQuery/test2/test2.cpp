@@ -0,0 +1,122 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+/*=============================================================
+**
+** Source:  test2.cpp
+**
+** Purpose: Reserve a large number of regions, commit a page in
+**          some of them and release others in a scattered order,
+**          then check that VirtualQuery still finds the region
+**          containing each queried address and reports its state.
+**
+**
+**============================================================*/
+#include <palsuite.h>
+
+#define REGION_COUNT 2048
+#define REGION_SIZE  0x20000
+
+static LPVOID rgpvRegions[REGION_COUNT];
+
+static BOOL IsReleased(int i)
+{
+    return (i % 3) == 0;
+}
+
+static BOOL IsCommitted(int i)
+{
+    return (i % 2) == 0;
+}
+
+int __cdecl main(int argc, char *argv[])
+{
+    MEMORY_BASIC_INFORMATION PageInfo;
+    SYSTEM_INFO SystemInfo;
+    SIZE_T PageSize;
+    int i;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    GetSystemInfo(&SystemInfo);
+    PageSize = SystemInfo.dwPageSize;
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        rgpvRegions[i] = VirtualAlloc(NULL, REGION_SIZE, MEM_RESERVE, PAGE_NOACCESS);
+        if (rgpvRegions[i] == NULL)
+        {
+            Fail("ERROR: VirtualAlloc failed to reserve region %d (error %u)\n", i, GetLastError());
+        }
+    }
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        // Commit the second page of every other region
+        if (IsCommitted(i) &&
+            VirtualAlloc((BYTE*)rgpvRegions[i] + PageSize, PageSize, MEM_COMMIT, PAGE_READWRITE) == NULL)
+        {
+            Fail("ERROR: VirtualAlloc failed to commit region %d (error %u)\n", i, GetLastError());
+        }
+    }
+
+    // Release every third region, visiting them out of address order
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        int j = (i * 7) % REGION_COUNT;
+        if (IsReleased(j) && !VirtualFree(rgpvRegions[j], 0, MEM_RELEASE))
+        {
+            Fail("ERROR: VirtualFree failed to release region %d (error %u)\n", j, GetLastError());
+        }
+    }
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        BYTE *pbPage = (BYTE*)rgpvRegions[i] + PageSize;
+
+        if (IsReleased(i))
+        {
+            continue;
+        }
+
+        if (VirtualQuery(pbPage + 1, &PageInfo, sizeof(PageInfo)) != sizeof(PageInfo))
+        {
+            Fail("ERROR: VirtualQuery failed for region %d\n", i);
+        }
+
+        if (PageInfo.BaseAddress != pbPage || PageInfo.AllocationProtect != PAGE_NOACCESS)
+        {
+            Fail("ERROR: VirtualQuery returned base %p and allocation protection %#x for region %d, "
+                 "expected %p and PAGE_NOACCESS\n",
+                 PageInfo.BaseAddress, PageInfo.AllocationProtect, i, pbPage);
+        }
+
+        if (IsCommitted(i))
+        {
+            if (PageInfo.State != MEM_COMMIT || PageInfo.Protect != PAGE_READWRITE ||
+                PageInfo.RegionSize != PageSize)
+            {
+                Fail("ERROR: VirtualQuery did not report the committed page of region %d\n", i);
+            }
+        }
+        else if (PageInfo.State != MEM_RESERVE || PageInfo.RegionSize != REGION_SIZE - PageSize)
+        {
+            Fail("ERROR: VirtualQuery did not report the reserved pages of region %d\n", i);
+        }
+    }
+
+    for (i = 0; i < REGION_COUNT; i++)
+    {
+        if (!IsReleased(i) && !VirtualFree(rgpvRegions[i], 0, MEM_RELEASE))
+        {
+            Fail("ERROR: VirtualFree failed to release region %d (error %u)\n", i, GetLastError());
+        }
+    }
+
+    PAL_Terminate();
+    return PASS;
+}
@@ -0,0 +1,198 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+/*=====================================================================
+**
+** Source:  test1.cpp
+**
+** Purpose: Tests that a wait port acquires signaled events and
+**          semaphores with the release semantics of each object type,
+**          that objects it does not support are rejected, that disabled
+**          registrations are only reported once enabled, and that
+**          PAL_WaitPortWake makes an alertable wait run pending APCs.
+**
+**
+**===================================================================*/
+
+#include <palsuite.h>
+
+#define CONTEXT_AUTO_EVENT   ((PVOID)1)
+#define CONTEXT_MANUAL_EVENT ((PVOID)2)
+#define CONTEXT_SEMAPHORE    ((PVOID)3)
+
+static BOOL bAPCRan = FALSE;
+
+VOID PALAPI APCFunc(ULONG_PTR dwParam)
+{
+    bAPCRan = TRUE;
+}
+
+static void ExpectTimeout(PVOID pvPort)
+{
+    PVOID rgpvContexts[4];
+    DWORD dwCount;
+    DWORD dwRet = PAL_WaitPortWait(pvPort, 0, FALSE, rgpvContexts, 4, &dwCount);
+
+    if (dwRet != WAIT_TIMEOUT)
+    {
+        Fail("ERROR: PAL_WaitPortWait returned %u with %u objects, "
+             "expected WAIT_TIMEOUT\n", dwRet, dwCount);
+    }
+}
+
+static void ExpectSignaled(PVOID pvPort, PVOID pvExpectedContext)
+{
+    PVOID rgpvContexts[4];
+    DWORD dwCount;
+    DWORD dwRet = PAL_WaitPortWait(pvPort, 5000, FALSE, rgpvContexts, 4, &dwCount);
+
+    if (dwRet != WAIT_OBJECT_0 || dwCount != 1 || rgpvContexts[0] != pvExpectedContext)
+    {
+        Fail("ERROR: PAL_WaitPortWait returned %u with %u objects, expected "
+             "WAIT_OBJECT_0 with the single context %p\n",
+             dwRet, dwCount, pvExpectedContext);
+    }
+}
+
+int __cdecl main(int argc, char **argv)
+{
+    HANDLE hAutoEvent;
+    HANDLE hManualEvent;
+    HANDLE hSemaphore;
+    HANDLE hMutex;
+    PVOID pvPort;
+    PVOID pvAutoEventReg;
+    PVOID pvManualEventReg;
+    PVOID pvSemaphoreReg;
+    PVOID rgpvContexts[4];
+    DWORD dwCount;
+    DWORD dwRet;
+
+    if (0 != PAL_Initialize(argc, argv))
+    {
+        return FAIL;
+    }
+
+    pvPort = PAL_CreateWaitPort();
+    if (pvPort == NULL)
+    {
+        if (GetLastError() == ERROR_NOT_SUPPORTED)
+        {
+            // Wait ports are only available on platforms with epoll
+            PAL_Terminate();
+            return PASS;
+        }
+        Fail("ERROR: PAL_CreateWaitPort failed with error %u\n", GetLastError());
+    }
+
+    hAutoEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    hManualEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    hSemaphore = CreateSemaphoreW(NULL, 0, 10, NULL);
+    hMutex = CreateMutex(NULL, FALSE, NULL);
+    if (hAutoEvent == NULL || hManualEvent == NULL || hSemaphore == NULL || hMutex == NULL)
+    {
+        Fail("ERROR: unable to create the test objects (error %u)\n", GetLastError());
+    }
+
+    if (PAL_WaitPortCanAdd(hMutex) || !PAL_WaitPortCanAdd(hAutoEvent))
+    {
+        Fail("ERROR: PAL_WaitPortCanAdd accepted a mutex or rejected an event\n");
+    }
+
+    if (!PAL_WaitPortAdd(pvPort, hAutoEvent, CONTEXT_AUTO_EVENT, TRUE, &pvAutoEventReg) ||
+        !PAL_WaitPortAdd(pvPort, hManualEvent, CONTEXT_MANUAL_EVENT, FALSE, &pvManualEventReg) ||
+        !PAL_WaitPortAdd(pvPort, hSemaphore, CONTEXT_SEMAPHORE, TRUE, &pvSemaphoreReg))
+    {
+        Fail("ERROR: PAL_WaitPortAdd failed with error %u\n", GetLastError());
+    }
+
+    ExpectTimeout(pvPort);
+
+    // A disabled registration is not reported until it is enabled
+    if (!SetEvent(hManualEvent))
+    {
+        Fail("ERROR: SetEvent failed with error %u\n", GetLastError());
+    }
+    ExpectTimeout(pvPort);
+    PAL_WaitPortEnable(pvPort, pvManualEventReg);
+    ExpectSignaled(pvPort, CONTEXT_MANUAL_EVENT);
+    if (!ResetEvent(hManualEvent))
+    {
+        Fail("ERROR: ResetEvent failed with error %u\n", GetLastError());
+    }
+    ExpectTimeout(pvPort);
+
+    // An auto-reset event is reset by the port that acquires it
+    if (!SetEvent(hAutoEvent))
+    {
+        Fail("ERROR: SetEvent failed with error %u\n", GetLastError());
+    }
+    ExpectSignaled(pvPort, CONTEXT_AUTO_EVENT);
+    ExpectTimeout(pvPort);
+    if (WaitForSingleObject(hAutoEvent, 0) != WAIT_TIMEOUT)
+    {
+        Fail("ERROR: the auto-reset event is still signaled after the port acquired it\n");
+    }
+
+    // Each semaphore count is acquired separately
+    if (!ReleaseSemaphore(hSemaphore, 2, NULL))
+    {
+        Fail("ERROR: ReleaseSemaphore failed with error %u\n", GetLastError());
+    }
+    ExpectSignaled(pvPort, CONTEXT_SEMAPHORE);
+    ExpectSignaled(pvPort, CONTEXT_SEMAPHORE);
+    ExpectTimeout(pvPort);
+
+    // A manual-reset event stays signaled until it is reset
+    if (!SetEvent(hManualEvent))
+    {
+        Fail("ERROR: SetEvent failed with error %u\n", GetLastError());
+    }
+    ExpectSignaled(pvPort, CONTEXT_MANUAL_EVENT);
+    ExpectSignaled(pvPort, CONTEXT_MANUAL_EVENT);
+    if (!ResetEvent(hManualEvent))
+    {
+        Fail("ERROR: ResetEvent failed with error %u\n", GetLastError());
+    }
+    ExpectTimeout(pvPort);
+
+    // An object signaled by a regular wait is not reported
+    if (!SetEvent(hAutoEvent) || WaitForSingleObject(hAutoEvent, 0) != WAIT_OBJECT_0)
+    {
+        Fail("ERROR: unable to signal and acquire the auto-reset event\n");
+    }
+    ExpectTimeout(pvPort);
+
+    // Waking the port runs the APCs queued to the waiting thread
+    if (QueueUserAPC(APCFunc, GetCurrentThread(), 0) == 0 || !PAL_WaitPortWake(pvPort))
+    {
+        Fail("ERROR: unable to queue an APC and wake the port (error %u)\n", GetLastError());
+    }
+    dwRet = PAL_WaitPortWait(pvPort, 5000, TRUE, rgpvContexts, 4, &dwCount);
+    if (dwRet != WAIT_IO_COMPLETION || !bAPCRan)
+    {
+        Fail("ERROR: PAL_WaitPortWait returned %u after a wake, expected "
+             "WAIT_IO_COMPLETION and the APC to have run\n", dwRet);
+    }
+
+    // Removed objects are no longer reported
+    PAL_WaitPortRemove(pvPort, pvAutoEventReg);
+    if (!SetEvent(hAutoEvent))
+    {
+        Fail("ERROR: SetEvent failed with error %u\n", GetLastError());
+    }
+    ExpectTimeout(pvPort);
+
+    PAL_WaitPortRemove(pvPort, pvManualEventReg);
+    PAL_WaitPortRemove(pvPort, pvSemaphoreReg);
+    PAL_CloseWaitPort(pvPort);
+
+    CloseHandle(hAutoEvent);
+    CloseHandle(hManualEvent);
+    CloseHandle(hSemaphore);
+    CloseHandle(hMutex);
+
+    PAL_Terminate();
+    return PASS;
+}
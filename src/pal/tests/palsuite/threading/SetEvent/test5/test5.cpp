@@ -0,0 +1,241 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+/*=============================================================================
+**
+** Source: test5.cpp
+**
+** Dependencies: PAL_Initialize
+**               PAL_Terminate
+**               CreateEvent
+**               CloseHandle
+**               CreateThread
+**               WaitForSingleObject
+**               WaitForMultipleObjects
+**               ResetEvent
+**
+** Purpose:
+**
+** Test to ensure proper operation of the SetEvent() and
+** WaitForSingleObject() APIs while other threads close and
+** create event handles. The churn threads create enough events
+** at a time to grow the handle table, and close them again so
+** that their handle values get reused.
+**
+** Every lookup thread owns an event that stays open for the whole
+** test, so its lookups must always succeed. It also looks up
+** handles that the churn threads are closing, which must either
+** succeed or fail with ERROR_INVALID_HANDLE. A churned handle
+** value may already refer to another object by then, so those
+** lookups only wait with a zero timeout.
+**
+**===========================================================================*/
+#include <palsuite.h>
+
+#define NUM_LOOKUP_THREADS  4
+#define NUM_CHURN_THREADS   2
+#define LOOKUP_ITERATIONS   200000
+#define CHURN_BATCH         1500
+#define NUM_SHARED_SLOTS    64
+
+/* handles published by the churn threads, possibly already closed */
+HANDLE g_rghShared[NUM_SHARED_SLOTS];
+
+volatile LONG g_lLookupsRunning = NUM_LOOKUP_THREADS;
+volatile LONG g_lFailed = FALSE;
+
+DWORD PALAPI LookupThread( LPVOID lpParam )
+{
+    HANDLE  hOwnEvent = NULL;
+    HANDLE  hShared;
+    DWORD   dwRet;
+    DWORD   dwError;
+    int     i;
+
+    UNREFERENCED_PARAMETER(lpParam);
+
+    hOwnEvent = CreateEvent( NULL, TRUE, FALSE, NULL );
+    if( hOwnEvent == NULL )
+    {
+        Trace( "ERROR:%lu:CreateEvent() call failed\n", GetLastError() );
+        InterlockedExchange( &g_lFailed, TRUE );
+        goto done;
+    }
+
+    for( i = 0; i < LOOKUP_ITERATIONS && !g_lFailed; i++ )
+    {
+        /* lookups of a handle that stays open must always succeed */
+        if( ! SetEvent( hOwnEvent ) )
+        {
+            Trace( "ERROR:%lu:SetEvent() call failed on an open handle\n",
+                   GetLastError() );
+            InterlockedExchange( &g_lFailed, TRUE );
+            break;
+        }
+
+        dwRet = WaitForSingleObject( hOwnEvent, 0 );
+        if( dwRet != WAIT_OBJECT_0 )
+        {
+            Trace( "ERROR:WaitForSingleObject() call returned %lu, "
+                   "expected WAIT_OBJECT_0\n", dwRet );
+            InterlockedExchange( &g_lFailed, TRUE );
+            break;
+        }
+
+        if( ! ResetEvent( hOwnEvent ) )
+        {
+            Trace( "ERROR:%lu:ResetEvent() call failed on an open handle\n",
+                   GetLastError() );
+            InterlockedExchange( &g_lFailed, TRUE );
+            break;
+        }
+
+        /* lookups of a handle being closed may fail, but only as an
+           invalid handle */
+        hShared = g_rghShared[i % NUM_SHARED_SLOTS];
+        if( hShared == NULL )
+        {
+            continue;
+        }
+
+        if( ! SetEvent( hShared ) )
+        {
+            dwError = GetLastError();
+            if( dwError != ERROR_INVALID_HANDLE )
+            {
+                Trace( "ERROR:SetEvent() call failed with %lu, "
+                       "expected ERROR_INVALID_HANDLE\n", dwError );
+                InterlockedExchange( &g_lFailed, TRUE );
+                break;
+            }
+        }
+
+        dwRet = WaitForSingleObject( hShared, 0 );
+        if( dwRet == WAIT_FAILED )
+        {
+            dwError = GetLastError();
+            if( dwError != ERROR_INVALID_HANDLE )
+            {
+                Trace( "ERROR:WaitForSingleObject() call failed with %lu, "
+                       "expected ERROR_INVALID_HANDLE\n", dwError );
+                InterlockedExchange( &g_lFailed, TRUE );
+                break;
+            }
+        }
+        else if( dwRet != WAIT_OBJECT_0 && dwRet != WAIT_TIMEOUT )
+        {
+            Trace( "ERROR:WaitForSingleObject() call returned %lu\n", dwRet );
+            InterlockedExchange( &g_lFailed, TRUE );
+            break;
+        }
+    }
+
+    if( ! CloseHandle( hOwnEvent ) )
+    {
+        Trace( "ERROR:%lu:CloseHandle() call failed\n", GetLastError() );
+        InterlockedExchange( &g_lFailed, TRUE );
+    }
+
+done:
+    InterlockedDecrement( &g_lLookupsRunning );
+    return 0;
+}
+
+DWORD PALAPI ChurnThread( LPVOID lpParam )
+{
+    HANDLE  rghEvents[CHURN_BATCH];
+    int     iSlotBase = (int)(SIZE_T)lpParam * (NUM_SHARED_SLOTS / NUM_CHURN_THREADS);
+    int     i;
+
+    while( g_lLookupsRunning != 0 && !g_lFailed )
+    {
+        for( i = 0; i < CHURN_BATCH; i++ )
+        {
+            rghEvents[i] = CreateEvent( NULL, TRUE, FALSE, NULL );
+            if( rghEvents[i] == NULL )
+            {
+                Trace( "ERROR:%lu:CreateEvent() call failed\n", GetLastError() );
+                InterlockedExchange( &g_lFailed, TRUE );
+                while( --i >= 0 )
+                {
+                    CloseHandle( rghEvents[i] );
+                }
+                return 0;
+            }
+        }
+
+        /* publish some of the handles to the lookup threads */
+        for( i = 0; i < NUM_SHARED_SLOTS / NUM_CHURN_THREADS; i++ )
+        {
+            g_rghShared[iSlotBase + i] = rghEvents[i * (CHURN_BATCH / NUM_SHARED_SLOTS)];
+        }
+
+        for( i = 0; i < CHURN_BATCH; i++ )
+        {
+            if( ! CloseHandle( rghEvents[i] ) )
+            {
+                Trace( "ERROR:%lu:CloseHandle() call failed\n", GetLastError() );
+                InterlockedExchange( &g_lFailed, TRUE );
+            }
+        }
+    }
+
+    return 0;
+}
+
+int __cdecl main( int argc, char **argv )
+{
+    HANDLE  rghThreads[NUM_LOOKUP_THREADS + NUM_CHURN_THREADS];
+    DWORD   dwThreadId;
+    DWORD   dwRet;
+    int     i;
+
+    /* PAL initialization */
+    if( (PAL_Initialize(argc, argv)) != 0 )
+    {
+        return( FAIL );
+    }
+
+    for( i = 0; i < NUM_CHURN_THREADS; i++ )
+    {
+        rghThreads[i] = CreateThread( NULL, 0, ChurnThread, (LPVOID)(SIZE_T)i, 0, &dwThreadId );
+        if( rghThreads[i] == NULL )
+        {
+            Fail( "ERROR:%lu:CreateThread() call failed\n", GetLastError() );
+        }
+    }
+
+    for( i = NUM_CHURN_THREADS; i < NUM_CHURN_THREADS + NUM_LOOKUP_THREADS; i++ )
+    {
+        rghThreads[i] = CreateThread( NULL, 0, LookupThread, NULL, 0, &dwThreadId );
+        if( rghThreads[i] == NULL )
+        {
+            Fail( "ERROR:%lu:CreateThread() call failed\n", GetLastError() );
+        }
+    }
+
+    dwRet = WaitForMultipleObjects( NUM_CHURN_THREADS + NUM_LOOKUP_THREADS,
+                                    rghThreads, TRUE, INFINITE );
+    if( dwRet != WAIT_OBJECT_0 )
+    {
+        Fail( "ERROR:WaitForMultipleObjects() call returned %lu, "
+              "expected WAIT_OBJECT_0\n", dwRet );
+    }
+
+    for( i = 0; i < NUM_CHURN_THREADS + NUM_LOOKUP_THREADS; i++ )
+    {
+        CloseHandle( rghThreads[i] );
+    }
+
+    if( g_lFailed )
+    {
+        Fail( "Test failed\n" );
+    }
+
+    /* PAL termination */
+    PAL_Terminate();
+
+    /* return success */
+    return PASS;
+}
@@ -0,0 +1,27 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//
+// simenv.h
+//
+// Minimal stand-ins for the VM definitions used by latencycontroller.cpp, so
+// that it can be built into the simulator without the rest of the runtime.
+//
+
+#ifndef _SIMENV_H
+#define _SIMENV_H
+
+#include <assert.h>
+#include <algorithm>
+
+typedef unsigned int DWORD;
+typedef int LONG;
+
+#define LIMITED_METHOD_CONTRACT
+#define _ASSERTE(expr) assert(expr)
+
+using std::min;
+using std::max;
+
+#endif
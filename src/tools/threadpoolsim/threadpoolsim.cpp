@@ -0,0 +1,484 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//
+// threadpoolsim.cpp
+//
+// Replays a recorded workload against the thread pool's LatencyController and
+// reports how long work items waited and how many threads it took.
+//
+// The worker pool is simulated in 1ms steps. Each work item runs for half of
+// its CPU time, optionally blocks in a reported wait, then runs for the rest.
+// Running threads share the simulated processors evenly. The pool follows the
+// same rules as ThreadpoolMgr: a thread may only pick up work while fewer than
+// MaxWorking threads are working, at most one thread is injected at a time,
+// and threads retire once there are more active threads than MaxWorking.
+//
+// Workload files are CSV lines of
+//
+//     time_ms,count,cpu_ms,blocked_ms
+//
+// meaning that at time_ms, count items arrive that each need cpu_ms of CPU and
+// block for blocked_ms. Lines starting with '#' are ignored. Without a file a
+// built-in workload is used: CPU bound work keeping 3 of 4 processors busy,
+// with a burst of blocking items in the middle.
+//
+// Usage: threadpoolsim [-procs N] [-target ms] [-retire ms] [-interval ms]
+//                      [-fixed N] [-report ms] [workload.csv]
+//
+// -fixed N disables the controller and runs with N threads, as a baseline.
+//
+
+#include "simenv.h"
+#include "latencycontroller.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <deque>
+#include <vector>
+
+struct Arrival
+{
+    int Time;
+    int Count;
+    double CpuMs;
+    int BlockedMs;
+};
+
+struct WorkItem
+{
+    int EnqueueTime;
+    double CpuBeforeBlock;
+    double CpuAfterBlock;
+    int BlockedMs;
+};
+
+enum SimThreadState
+{
+    SimThread_Idle,
+    SimThread_Running,
+    SimThread_Blocked,
+};
+
+struct SimThread
+{
+    SimThreadState State;
+    WorkItem Item;
+    bool Blocked;       // the current item has been through its blocking wait
+};
+
+struct SimOptions
+{
+    int Processors;
+    DWORD TargetQueueWaitMs;
+    DWORD RetireDelayMs;
+    int SampleIntervalMs;
+    int FixedThreads;
+    int ReportIntervalMs;
+    const char* WorkloadPath;
+};
+
+static bool ReadWorkload(const char* path, std::vector<Arrival>* pArrivals)
+{
+    FILE* f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        lineNumber++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            continue;
+
+        Arrival arrival;
+        if (sscanf(line, "%d,%d,%lf,%d", &arrival.Time, &arrival.Count, &arrival.CpuMs, &arrival.BlockedMs) != 4 ||
+            arrival.Time < 0 || arrival.Count < 0 || arrival.CpuMs < 0 || arrival.BlockedMs < 0)
+        {
+            fprintf(stderr, "%s(%d): expected time_ms,count,cpu_ms,blocked_ms\n", path, lineNumber);
+            fclose(f);
+            return false;
+        }
+
+        pArrivals->push_back(arrival);
+    }
+
+    fclose(f);
+    return true;
+}
+
+static void BuiltInWorkload(std::vector<Arrival>* pArrivals)
+{
+    // 5 seconds of 1ms CPU bound items, 3 per millisecond
+    for (int t = 0; t < 5000; t++)
+    {
+        Arrival arrival = { t, 3, 1.0, 0 };
+        pArrivals->push_back(arrival);
+    }
+
+    // From 1 to 2 seconds, add items that block for 200ms, like synchronous I/O
+    for (int t = 1000; t < 2000; t += 5)
+    {
+        Arrival arrival = { t, 1, 0.5, 200 };
+        pArrivals->push_back(arrival);
+    }
+}
+
+static bool ParseOptions(int argc, char* argv[], SimOptions* pOptions)
+{
+    pOptions->Processors = 4;
+    pOptions->TargetQueueWaitMs = 20;
+    pOptions->RetireDelayMs = 500;
+    pOptions->SampleIntervalMs = 10;
+    pOptions->FixedThreads = 0;
+    pOptions->ReportIntervalMs = 100;
+    pOptions->WorkloadPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        if (arg[0] != '-')
+        {
+            pOptions->WorkloadPath = arg;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return false;
+
+        int value = atoi(argv[++i]);
+        if (value < 0)
+            return false;
+
+        if (strcmp(arg, "-procs") == 0)
+            pOptions->Processors = value;
+        else if (strcmp(arg, "-target") == 0)
+            pOptions->TargetQueueWaitMs = (DWORD)value;
+        else if (strcmp(arg, "-retire") == 0)
+            pOptions->RetireDelayMs = (DWORD)value;
+        else if (strcmp(arg, "-interval") == 0)
+            pOptions->SampleIntervalMs = value;
+        else if (strcmp(arg, "-fixed") == 0)
+            pOptions->FixedThreads = value;
+        else if (strcmp(arg, "-report") == 0)
+            pOptions->ReportIntervalMs = value;
+        else
+            return false;
+    }
+
+    return pOptions->Processors > 0 && pOptions->SampleIntervalMs > 0 && pOptions->ReportIntervalMs > 0;
+}
+
+class PoolSimulator
+{
+public:
+    PoolSimulator(const SimOptions& options)
+        : m_options(options)
+    {
+        LatencyControllerSettings settings;
+        settings.TargetQueueWaitMs = options.TargetQueueWaitMs;
+        settings.RetireDelayMs = options.RetireDelayMs;
+        settings.MaxInjectionPerSample = options.Processors;
+        settings.NumProcessors = options.Processors;
+        settings.CpuUtilizationHigh = 95;
+        m_controller.Initialize(settings);
+
+        m_minThreads = options.FixedThreads > 0 ? options.FixedThreads : options.Processors;
+        m_maxThreads = options.FixedThreads > 0 ? options.FixedThreads : 32767;
+        m_maxWorking = m_minThreads;
+        m_starvedSince = -1;
+        m_numBlocked = 0;
+        m_now = 0;
+    }
+
+    void Run(const std::vector<Arrival>& arrivals)
+    {
+        size_t nextArrival = 0;
+        int lastArrivalTime = 0;
+        for (size_t i = 0; i < arrivals.size(); i++)
+            lastArrivalTime = max(lastArrivalTime, arrivals[i].Time);
+
+        long long threadMs = 0;
+        int peakThreads = 0;
+        int windowCompletions = 0;
+        double windowWait = 0;
+
+        printf("%8s %6s %6s %6s %6s %7s %6s %9s\n", "time_ms", "max", "active", "run", "block", "queue", "done", "wait_ms");
+
+        for (m_now = 0; nextArrival < arrivals.size() || !m_queue.empty() || AnyBusy(); m_now++)
+        {
+            while (nextArrival < arrivals.size() && arrivals[nextArrival].Time <= m_now)
+            {
+                Enqueue(arrivals[nextArrival]);
+                nextArrival++;
+            }
+
+            Dispatch(&windowCompletions, &windowWait);
+            Advance();
+
+            if (m_options.FixedThreads == 0 && m_now % m_options.SampleIntervalMs == 0)
+                Sample((DWORD)m_options.SampleIntervalMs);
+
+            threadMs += (long long)m_threads.size();
+            peakThreads = max(peakThreads, (int)m_threads.size());
+
+            if (m_now % m_options.ReportIntervalMs == 0)
+            {
+                printf("%8d %6d %6d %6d %6d %7d %6d %9.1f\n",
+                    m_now, m_maxWorking, (int)m_threads.size(), CountState(SimThread_Running), m_numBlocked,
+                    (int)m_queue.size(), windowCompletions, windowCompletions > 0 ? windowWait / windowCompletions : 0.0);
+                windowCompletions = 0;
+                windowWait = 0;
+            }
+
+            if (m_now > lastArrivalTime + 600000)
+            {
+                fprintf(stderr, "Workload did not drain within 10 minutes of the last arrival\n");
+                break;
+            }
+        }
+
+        PrintSummary(threadMs, peakThreads);
+    }
+
+private:
+    void Enqueue(const Arrival& arrival)
+    {
+        for (int i = 0; i < arrival.Count; i++)
+        {
+            WorkItem item;
+            item.EnqueueTime = arrival.Time;
+            item.CpuBeforeBlock = arrival.CpuMs / 2;
+            item.CpuAfterBlock = arrival.CpuMs - item.CpuBeforeBlock;
+            item.BlockedMs = arrival.BlockedMs;
+            m_queue.push_back(item);
+        }
+    }
+
+    int CountState(SimThreadState state)
+    {
+        int count = 0;
+        for (size_t i = 0; i < m_threads.size(); i++)
+        {
+            if (m_threads[i].State == state)
+                count++;
+        }
+        return count;
+    }
+
+    bool AnyBusy()
+    {
+        return CountState(SimThread_Idle) != (int)m_threads.size();
+    }
+
+    int NumWorking()
+    {
+        return (int)m_threads.size() - CountState(SimThread_Idle);
+    }
+
+    void StartItem(SimThread* pThread, double* pWindowWait)
+    {
+        pThread->Item = m_queue.front();
+        pThread->State = SimThread_Running;
+        pThread->Blocked = false;
+        m_queue.pop_front();
+
+        int wait = m_now - pThread->Item.EnqueueTime;
+        m_waits.push_back(wait);
+        *pWindowWait += wait;
+    }
+
+    void Dispatch(int* pWindowCompletions, double* pWindowWait)
+    {
+        // Threads that finished their item last step pick up the next one, or retire
+        for (size_t i = 0; i < m_threads.size(); )
+        {
+            SimThread* pThread = &m_threads[i];
+            if (pThread->State == SimThread_Running && pThread->Item.CpuBeforeBlock <= 0 && pThread->Blocked &&
+                pThread->Item.CpuAfterBlock <= 0)
+            {
+                (*pWindowCompletions)++;
+                pThread->State = SimThread_Idle;
+            }
+
+            if (pThread->State == SimThread_Idle && (int)m_threads.size() > m_maxWorking)
+            {
+                m_threads.erase(m_threads.begin() + i);
+                continue;
+            }
+
+            i++;
+        }
+
+        // Idle threads are released while fewer than MaxWorking threads are working
+        for (size_t i = 0; i < m_threads.size() && !m_queue.empty(); i++)
+        {
+            if (m_threads[i].State == SimThread_Idle && NumWorking() < m_maxWorking)
+                StartItem(&m_threads[i], pWindowWait);
+        }
+
+        if (m_queue.empty())
+        {
+            // Someone is going idle, nothing is waiting for a worker
+            m_starvedSince = -1;
+            return;
+        }
+
+        // Inject a single thread, like MaybeAddWorkingWorker
+        if (NumWorking() < m_maxWorking)
+        {
+            SimThread thread;
+            thread.State = SimThread_Idle;
+            thread.Blocked = false;
+            m_threads.push_back(thread);
+            StartItem(&m_threads.back(), pWindowWait);
+        }
+        else if (m_starvedSince < 0)
+        {
+            m_starvedSince = m_now;
+        }
+    }
+
+    void Advance()
+    {
+        int running = CountState(SimThread_Running);
+        double progress = running > m_options.Processors ? (double)m_options.Processors / running : 1.0;
+
+        for (size_t i = 0; i < m_threads.size(); i++)
+        {
+            SimThread* pThread = &m_threads[i];
+            if (pThread->State == SimThread_Running)
+            {
+                double budget = progress;
+
+                if (pThread->Item.CpuBeforeBlock > 0)
+                {
+                    double used = min(budget, pThread->Item.CpuBeforeBlock);
+                    pThread->Item.CpuBeforeBlock -= used;
+                    budget -= used;
+                }
+
+                if (pThread->Item.CpuBeforeBlock <= 0 && !pThread->Blocked)
+                {
+                    pThread->Blocked = true;
+                    if (pThread->Item.BlockedMs > 0)
+                    {
+                        pThread->State = SimThread_Blocked;
+                        m_numBlocked++;
+                        if (!m_queue.empty())
+                            Sample(0);
+                        continue;
+                    }
+                }
+
+                if (pThread->Blocked)
+                    pThread->Item.CpuAfterBlock -= budget;
+            }
+            else if (pThread->State == SimThread_Blocked)
+            {
+                if (--pThread->Item.BlockedMs <= 0)
+                {
+                    pThread->State = SimThread_Running;
+                    m_numBlocked--;
+                    Sample(0);
+                }
+            }
+        }
+    }
+
+    void Sample(DWORD elapsedMs)
+    {
+        if (m_options.FixedThreads > 0)
+            return;
+
+        LatencyControllerSample sample;
+        sample.MaxWorking = m_maxWorking;
+        sample.NumActive = (int)m_threads.size();
+        sample.NumWorking = NumWorking();
+        sample.NumBlocked = m_numBlocked;
+        sample.MinThreads = m_minThreads;
+        sample.MaxThreads = m_maxThreads;
+        sample.RequestsPending = !m_queue.empty();
+        sample.QueueWaitMs = m_starvedSince >= 0 ? (DWORD)(m_now - m_starvedSince) : 0;
+        sample.ElapsedMs = elapsedMs;
+        sample.CpuUtilization = min(CountState(SimThread_Running), m_options.Processors) * 100 / m_options.Processors;
+
+        LatencyControllerReason reason;
+        m_maxWorking = m_controller.Update(sample, &reason);
+
+        if (reason == LatencyReason_QueueLatency && m_starvedSince >= 0)
+            m_starvedSince = m_now;
+    }
+
+    void PrintSummary(long long threadMs, int peakThreads)
+    {
+        if (m_waits.empty())
+        {
+            printf("\nNo work items\n");
+            return;
+        }
+
+        std::vector<int> waits(m_waits);
+        std::sort(waits.begin(), waits.end());
+
+        double total = 0;
+        for (size_t i = 0; i < waits.size(); i++)
+            total += waits[i];
+
+        printf("\nitems %d, wait mean %.2f ms, p50 %d ms, p99 %d ms, max %d ms\n",
+            (int)waits.size(), total / waits.size(), waits[waits.size() / 2], waits[waits.size() * 99 / 100], waits.back());
+        printf("elapsed %d ms, peak threads %d, mean threads %.2f\n",
+            m_now, peakThreads, m_now > 0 ? (double)threadMs / m_now : 0.0);
+    }
+
+    const SimOptions& m_options;
+    LatencyController m_controller;
+    std::deque<WorkItem> m_queue;
+    std::vector<SimThread> m_threads;
+    std::vector<int> m_waits;
+    int m_minThreads;
+    int m_maxThreads;
+    int m_maxWorking;
+    int m_starvedSince;
+    int m_numBlocked;
+    int m_now;
+};
+
+static bool CompareArrivals(const Arrival& a, const Arrival& b)
+{
+    return a.Time < b.Time;
+}
+
+int main(int argc, char* argv[])
+{
+    SimOptions options;
+    if (!ParseOptions(argc, argv, &options))
+    {
+        fprintf(stderr, "Usage: threadpoolsim [-procs N] [-target ms] [-retire ms] [-interval ms] [-fixed N] [-report ms] [workload.csv]\n");
+        return 1;
+    }
+
+    std::vector<Arrival> arrivals;
+    if (options.WorkloadPath != NULL)
+    {
+        if (!ReadWorkload(options.WorkloadPath, &arrivals))
+            return 1;
+    }
+    else
+    {
+        BuiltInWorkload(&arrivals);
+    }
+
+    std::stable_sort(arrivals.begin(), arrivals.end(), CompareArrivals);
+
+    PoolSimulator simulator(options);
+    simulator.Run(arrivals);
+
+    return 0;
+}
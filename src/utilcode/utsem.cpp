@@ -80,7 +80,8 @@ SpinConstants g_SpinConstants = {
     40000,     // dwMaximumDuration - ideally (20000 * max(2, numProc)) ... updated in code:InitializeSpinConstants_NoHost
     3,         // dwBackoffFactor
     10,        // dwRepetitions
-    0          // dwMonitorSpinCount
+    0,         // dwMonitorSpinCount
+    0          // dwMonitorThinLockYieldCount
 };
 
 inline void InitializeSpinConstants_NoHost()
@@ -31,11 +31,26 @@ CallCounter::CallCounter()
 {
     LIMITED_METHOD_CONTRACT;
 
-    m_lock.Init(LOCK_TYPE_DEFAULT);
+    for (UINT32 i = 0; i < PartitionCount; ++i)
+    {
+        m_partitions[i].m_lock.Init(LOCK_TYPE_DEFAULT);
+    }
 }
 
 #endif // !DACCESS_COMPILE
 
+CallCounter::Partition* CallCounter::GetPartition(PTR_MethodDesc pMethodDesc)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    _ASSERTE(pMethodDesc != PTR_NULL);
+
+    // MethodDescs are at least pointer-aligned, and neighboring MethodDescs are typically in the same chunk, so fold in
+    // some higher bits as well
+    TADDR address = dac_cast<TADDR>(pMethodDesc);
+    UINT32 hash = (UINT32)((address >> 3) ^ (address >> 9));
+    return &m_partitions[hash % PartitionCount];
+}
+
 bool CallCounter::IsEligibleForCallCounting(PTR_MethodDesc pMethodDesc)
 {
     WRAPPER_NO_CONTRACT;
@@ -52,12 +67,13 @@ bool CallCounter::IsCallCountingEnabled(PTR_MethodDesc pMethodDesc)
     _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
     _ASSERTE(IsEligibleForCallCounting(pMethodDesc));
 
+    Partition* partition = GetPartition(pMethodDesc);
 #ifndef DACCESS_COMPILE
-    SpinLockHolder holder(&m_lock);
+    SpinLockHolder holder(&partition->m_lock);
 #endif
 
     PTR_CallCounterEntry entry =
-        (PTR_CallCounterEntry)const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        (PTR_CallCounterEntry)const_cast<CallCounterEntry *>(partition->m_methodToCallCount.LookupPtr(pMethodDesc));
     return entry == PTR_NULL || entry->IsCallCountingEnabled();
 }
 
@@ -77,9 +93,11 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
     // called yet (if the entry does not yet exist in the hash table), if necessary that could be a different function like
     // TryDisable...() that would fail to disable call counting if the method has already been called.
 
-    SpinLockHolder holder(&m_lock);
+    Partition* partition = GetPartition(pMethodDesc);
+    SpinLockHolder holder(&partition->m_lock);
 
-    CallCounterEntry *existingEntry = const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+    CallCounterEntry *existingEntry =
+        const_cast<CallCounterEntry *>(partition->m_methodToCallCount.LookupPtr(pMethodDesc));
     if (existingEntry != nullptr)
     {
         existingEntry->DisableCallCounting();
@@ -88,16 +106,17 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
 
     // Typically, the entry would already exist because OnMethodCalled() would have been called before this function on the same
     // thread. With multi-core JIT, a function may be jitted before it is called, in which case the entry would not exist.
-    m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
+    partition->m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
 }
 
 bool CallCounter::WasCalledAtMostOnce(MethodDesc* pMethodDesc)
 {
     WRAPPER_NO_CONTRACT;
 
-    SpinLockHolder holder(&m_lock);
+    Partition* partition = GetPartition(pMethodDesc);
+    SpinLockHolder holder(&partition->m_lock);
 
-    const CallCounterEntry *existingEntry = m_methodToCallCount.LookupPtr(pMethodDesc);
+    const CallCounterEntry *existingEntry = partition->m_methodToCallCount.LookupPtr(pMethodDesc);
     return
         existingEntry == nullptr ||
         existingEntry->callCountLimit >= (int)g_pConfig->TieredCompilation_CallCountThreshold() - 1;
@@ -127,7 +146,8 @@ void CallCounter::OnMethodCalled(
     // PERF: This as a simple to implement, but not so performant, call counter
     // Currently this is only called until we reach a fixed call count and then
     // disabled. Its likely we'll want to improve this at some point but
-    // its not as bad as you might expect. Allocating a counter inline in the
+    // its not as bad as you might expect. The table is partitioned to limit lock
+    // contention between threads calling different methods. Allocating a counter inline in the
     // MethodDesc or at some location computable from the MethodDesc should
     // eliminate 1 pointer per-method (the MethodDesc* key) and the CPU
     // overhead to acquire the lock/search the dictionary. Depending on where it
@@ -146,14 +166,15 @@ void CallCounter::OnMethodCalled(
         //but TieredCompilationManager::OnMethodCalled() doesn't expect multiple calls
         //each claiming to be exactly the threshhold call count needed to trigger
         //optimization.
-        SpinLockHolder holder(&m_lock);
-        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        Partition* partition = GetPartition(pMethodDesc);
+        SpinLockHolder holder(&partition->m_lock);
+        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(partition->m_methodToCallCount.LookupPtr(pMethodDesc));
         if (pEntry == NULL)
         {
             isFirstCall = true;
             callCountLimit = (int)g_pConfig->TieredCompilation_CallCountThreshold() - 1;
             _ASSERTE(callCountLimit >= 0);
-            m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit));
+            partition->m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit));
         }
         else if (pEntry->IsCallCountingEnabled())
         {
@@ -81,6 +81,10 @@ typedef SHash<NoRemoveSHashTraits<CallCounterHashTraits>> CallCounterHash;
 // Each method invocation should trigger a call to OnMethodCalled (until it is disabled per-method)
 // and the CallCounter will forward the call to the TieredCompilationManager including the
 // current call count.
+//
+// The cache is split into a fixed number of partitions selected by the MethodDesc, each with its
+// own lock, so that threads concurrently running different tier 0 methods rarely contend on the
+// same lock. Calls are still counted through the prestub; there are no call counting stubs.
 class CallCounter
 {
 public:
@@ -100,10 +104,21 @@ public:
     void OnMethodCalled(MethodDesc* pMethodDesc, TieredCompilationManager *pTieredCompilationManager, BOOL* shouldStopCountingCallsRef, BOOL* wasPromotedToNextTierRef);
 
 private:
+    static const UINT32 PartitionCount = 16;
+
+    struct Partition
+    {
+        // fields protected by lock
+        SpinLock m_lock;
+        CallCounterHash m_methodToCallCount;
+
+        // padding to keep the next partition's lock and table off this partition's cache lines
+        BYTE m_padding[MAX_CACHE_LINE_SIZE];
+    };
+
+    Partition* GetPartition(PTR_MethodDesc pMethodDesc);
 
-    // fields protected by lock
-    SpinLock m_lock;
-    CallCounterHash m_methodToCallCount;
+    Partition m_partitions[PartitionCount];
 };
 
 #endif // FEATURE_TIERED_COMPILATION
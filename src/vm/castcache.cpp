@@ -0,0 +1,114 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: CastCache.CPP
+//
+// ===========================================================================
+
+#include "common.h"
+#include "castcache.h"
+
+#ifndef DACCESS_COMPILE
+
+CastCache::Entry CastCache::s_table[CastCache::TableSize];
+
+DWORD CastCache::GetBucket(TADDR source, TADDR target)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // MethodTables and TypeHandles are at least pointer aligned, so drop the
+    // low bits before mixing. The multiplicative step spreads the combined
+    // bits so that the top bits select the bucket.
+    UINT32 hash = (UINT32)(source >> 3) ^ _rotl((UINT32)(target >> 3), 16);
+#ifdef _WIN64
+    hash ^= (UINT32)(source >> 32) ^ (UINT32)(target >> 32);
+#endif
+    return (hash * 0x9E3779B1) >> (32 - TableSizeBits);
+}
+
+bool CastCache::IsCacheable(MethodTable *pSourceMT, TypeHandle target)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    // Entries are never invalidated, so neither side may be unloaded
+    if (pSourceMT->Collectible() || target.GetLoaderAllocator()->IsCollectible())
+        return false;
+
+    // The answer for these depends on the object instance rather than its type
+    if (pSourceMT->IsComObjectType() || pSourceMT->IsICastable())
+        return false;
+
+    return true;
+}
+
+TypeHandle::CastResult CastCache::TryGet(MethodTable *pSourceMT, TypeHandle target)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    TADDR source = dac_cast<TADDR>(pSourceMT);
+    TADDR targetAddr = target.AsTAddr();
+    Entry *pEntry = &s_table[GetBucket(source, targetAddr)];
+
+    LONG version = VolatileLoad(&pEntry->Version);
+    if (version & 1)
+        return TypeHandle::MaybeCast;
+
+    TADDR entrySource = VolatileLoad(&pEntry->Source);
+    TADDR entryTarget = VolatileLoad(&pEntry->Target);
+    DWORD result = VolatileLoad(&pEntry->Result);
+
+    // A writer got in between; the fields we read may be torn
+    if (VolatileLoad(&pEntry->Version) != version)
+        return TypeHandle::MaybeCast;
+
+    if (entrySource != source || entryTarget != targetAddr)
+        return TypeHandle::MaybeCast;
+
+    return (TypeHandle::CastResult)result;
+}
+
+void CastCache::TrySet(MethodTable *pSourceMT, TypeHandle target, BOOL canCast)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!IsCacheable(pSourceMT, target))
+        return;
+
+    TADDR source = dac_cast<TADDR>(pSourceMT);
+    TADDR targetAddr = target.AsTAddr();
+    Entry *pEntry = &s_table[GetBucket(source, targetAddr)];
+
+    LONG version = VolatileLoad(&pEntry->Version);
+    if (version & 1)
+        return;
+
+    // Another thread is racing to fill the same entry; let it win
+    if (InterlockedCompareExchange(&pEntry->Version, version + 1, version) != version)
+        return;
+
+    VolatileStore(&pEntry->Source, source);
+    VolatileStore(&pEntry->Target, targetAddr);
+    VolatileStore(&pEntry->Result, (DWORD)(canCast ? TypeHandle::CanCast : TypeHandle::CannotCast));
+    VolatileStore(&pEntry->Version, version + 2);
+}
+
+#endif // !DACCESS_COMPILE
@@ -0,0 +1,56 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+// ===========================================================================
+// File: CastCache.h
+//
+// ===========================================================================
+
+#ifndef CAST_CACHE_H
+#define CAST_CACHE_H
+
+#ifndef DACCESS_COMPILE
+
+// CastCache is a small, fixed size, process wide cache of cast results keyed
+// by (source MethodTable, target TypeHandle). It sits in front of the framed
+// casting helpers so that casts that the non-framed helpers cannot decide
+// (variance, generic interfaces over arrays, types that are not fully loaded
+// yet, etc.) only pay for the full type system walk once.
+//
+// Each entry is protected by its own sequence number. Readers never block and
+// never write; they simply treat a concurrent update as a miss. Writers claim
+// an entry with an interlocked operation and give up if another writer owns
+// it, so the cache is lossy by design. Only results that cannot change for
+// the lifetime of the process are stored: casts involving collectible types,
+// COM objects or ICastable implementations are never cached.
+class CastCache
+{
+public:
+    // Returns CanCast or CannotCast on a hit, MaybeCast on a miss.
+    static TypeHandle::CastResult TryGet(MethodTable *pSourceMT, TypeHandle target);
+
+    // Records the result of a cast that was fully resolved by the slow path.
+    static void TrySet(MethodTable *pSourceMT, TypeHandle target, BOOL canCast);
+
+private:
+    static const DWORD TableSizeBits = 11;
+    static const DWORD TableSize = 1 << TableSizeBits;
+
+    struct Entry
+    {
+        // Odd while a writer is updating the entry
+        LONG Version;
+        DWORD Result;
+        TADDR Source;
+        TADDR Target;
+    };
+
+    static DWORD GetBucket(TADDR source, TADDR target);
+    static bool IsCacheable(MethodTable *pSourceMT, TypeHandle target);
+
+    static Entry s_table[TableSize];
+};
+
+#endif // !DACCESS_COMPILE
+
+#endif // CAST_CACHE_H
@@ -1810,7 +1810,7 @@ public:
         SUPPORTS_DAC;
         WRAPPER_NO_CONTRACT;
         _ASSERTE(HasOptionalFields());
-        GetOptionalFields()->m_pDictLayout = pLayout;
+        *EnsureWritablePages(&GetOptionalFields()->m_pDictLayout) = pLayout;
     }
 
 #ifndef DACCESS_COMPILE
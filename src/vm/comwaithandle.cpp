@@ -16,6 +16,7 @@
 #include "field.h"
 #include "excep.h"
 #include "comwaithandle.h"
+#include "win32threadpool.h"
 
 FCIMPL2(INT32, WaitHandleNative::CorWaitOneNative, HANDLE handle, INT32 timeout)
 {
@@ -29,7 +30,10 @@ FCIMPL2(INT32, WaitHandleNative::CorWaitOneNative, HANDLE handle, INT32 timeout)
 
     Thread* pThread = GET_THREAD();
 
-    retVal = pThread->DoAppropriateWait(1, &handle, TRUE, timeout, (WaitMode)(WaitMode_Alertable | WaitMode_IgnoreSyncCtx));
+    {
+        ThreadpoolMgr::BlockingWaitHolder blockingWait(timeout);
+        retVal = pThread->DoAppropriateWait(1, &handle, TRUE, timeout, (WaitMode)(WaitMode_Alertable | WaitMode_IgnoreSyncCtx));
+    }
 
     HELPER_METHOD_FRAME_END();
     return retVal;
@@ -54,7 +58,10 @@ FCIMPL4(INT32, WaitHandleNative::CorWaitMultipleNative, HANDLE *handleArray, INT
     }
 #endif // FEATURE_COMINTEROP_APARTMENT_SUPPORT
 
-    ret = pThread->DoAppropriateWait(numHandles, handleArray, waitForAll, timeout, (WaitMode)(WaitMode_Alertable | WaitMode_IgnoreSyncCtx));
+    {
+        ThreadpoolMgr::BlockingWaitHolder blockingWait(timeout);
+        ret = pThread->DoAppropriateWait(numHandles, handleArray, waitForAll, timeout, (WaitMode)(WaitMode_Alertable | WaitMode_IgnoreSyncCtx));
+    }
 
     HELPER_METHOD_FRAME_END();
     return ret;
@@ -86,6 +93,7 @@ FCIMPL3(INT32, WaitHandleNative::CorSignalAndWaitOneNative, HANDLE waitHandleSig
     handles[0] = waitHandleSignalUNSAFE;
     handles[1] = waitHandleWaitUNSAFE;
     {
+        ThreadpoolMgr::BlockingWaitHolder blockingWait(timeout);
         res = pThread->DoSignalAndWait(handles, timeout, TRUE /*alertable*/);
     }
 
@@ -193,6 +193,7 @@ HRESULT EEConfig::Init()
     dwSpinLimitConstant = 0x0;
     dwSpinRetryCount = 0xA;
     dwMonitorSpinCount = 0;
+    dwMonitorThinLockYieldCount = 0;
 
     dwJitHostMaxSlabCache = 0;
 
@@ -338,6 +339,7 @@ HRESULT EEConfig::Init()
     fTieredCompilation_CallCounting = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_CallCountingDelayMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -988,6 +990,7 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
     dwSpinLimitConstant = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinLimitConstant);
     dwSpinRetryCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinRetryCount);
     dwMonitorSpinCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_Monitor_SpinCount);
+    dwMonitorThinLockYieldCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_Monitor_ThinLockYieldCount);
 
     dwJitHostMaxSlabCache = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitHostMaxSlabCache);
 
@@ -1152,9 +1155,11 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
 #ifndef FEATURE_HIJACK
     // Platforms that do not support hijacking MUST support GC polling.
     // Reject attempts by the user to configure the GC polling type as 
-    // GCPOLL_TYPE_HIJACK.
+    // GCPOLL_TYPE_HIJACK, or as GCPOLL_TYPE_LOOPS which hijacks returns.
     _ASSERTE(EEConfig::GCPOLL_TYPE_HIJACK != iGCPollTypeOverride);
-    if (EEConfig::GCPOLL_TYPE_HIJACK == iGCPollTypeOverride)
+    _ASSERTE(EEConfig::GCPOLL_TYPE_LOOPS != iGCPollTypeOverride);
+    if (EEConfig::GCPOLL_TYPE_HIJACK == iGCPollTypeOverride ||
+        EEConfig::GCPOLL_TYPE_LOOPS == iGCPollTypeOverride)
         iGCPollTypeOverride = EEConfig::GCPOLL_TYPE_DEFAULT;
 #endif
 
@@ -1238,6 +1243,14 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
             }
         }
 
+        tieredCompilation_BackgroundWorkerCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount == 0)
+        {
+            // Use up to a quarter of the processors available to the process, the rest are left to foreground work
+            int processorCount = GetCurrentProcessCpuCount();
+            tieredCompilation_BackgroundWorkerCount = processorCount >= 4 ? (DWORD)(processorCount / 4) : 1;
+        }
+
         if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
         {
             ETW::CompilationLog::TieredCompilation::Runtime::SendSettings();
@@ -268,6 +268,7 @@ public:
     DWORD         SpinLimitConstant(void)         const {LIMITED_METHOD_CONTRACT;  return dwSpinLimitConstant; }
     DWORD         SpinRetryCount(void)            const {LIMITED_METHOD_CONTRACT;  return dwSpinRetryCount; }
     DWORD         MonitorSpinCount(void)          const {LIMITED_METHOD_CONTRACT;  return dwMonitorSpinCount; }
+    DWORD         MonitorThinLockYieldCount(void) const {LIMITED_METHOD_CONTRACT;  return dwMonitorThinLockYieldCount; }
 
     // Jit-config
 
@@ -287,6 +288,7 @@ public:
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     DWORD         TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -757,6 +759,7 @@ public:
         GCPOLL_TYPE_HIJACK,     // Depend on thread hijacking for gc suspension
         GCPOLL_TYPE_POLL,       // Emit function calls to a helper for GC Poll
         GCPOLL_TYPE_INLINE,     // Emit inlined tests to the helper for GC Poll
+        GCPOLL_TYPE_LOOPS,      // Emit inlined tests at loop back edges only, hijack returns
         GCPOLL_TYPE_COUNT
     };
     GCPollType GetGCPollType() { LIMITED_METHOD_CONTRACT; return iGCPollType; }
@@ -891,6 +894,7 @@ private: //----------------------------------------------------------------
     DWORD dwSpinLimitConstant;
     DWORD dwSpinRetryCount;
     DWORD dwMonitorSpinCount;
+    DWORD dwMonitorThinLockYieldCount;
 
 #ifdef VERIFY_HEAP
     int  iGCHeapVerify;
@@ -1023,6 +1027,7 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_CallCounting;
     DWORD tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_CallCountingDelayMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
 #endif
 
 #ifndef CROSSGEN_COMPILE
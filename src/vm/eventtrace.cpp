@@ -3664,8 +3664,9 @@ VOID ETW::TypeSystemLog::FlushObjectAllocationEvents()
     AllLoggedTypes * pThreadAllLoggedTypes = NULL;
     Thread * pThread = NULL;
 
-    // Get the thread store lock.
-    ThreadStoreLockHolder tsl;
+    // Keep the threads we visit alive.  Their tables are only freed with the thread,
+    // so walking the list without the thread store lock is enough.
+    ThreadStoreReaderHolder tsr;
 
     // Iterate over each thread and log any un-logged allocations.
     while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
@@ -5751,8 +5752,9 @@ VOID ETW::EnumerationLog::SendThreadRundownEvent()
 #ifndef DACCESS_COMPILE
     Thread *pThread = NULL;
 
-    // Take the thread store lock while we enumerate threads.
-    ThreadStoreLockHolder tsl;
+    // Rundown only reads the threads it visits, so it does not need to hold
+    // thread creation and exit (and with them GC suspension) off while it logs.
+    ThreadStoreReaderHolder tsr;
     while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
     {
         if (pThread->IsUnstarted() || pThread->IsDead())
@@ -7514,6 +7516,18 @@ void ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitStop(UINT
     FireEtwTieredCompilationBackgroundJitStop(GetClrInstanceId(), pendingMethodCount, jittedMethodCount);
 }
 
+void ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitMethod(MethodDesc *pMethodDesc, UINT32 queueDurationMs, UINT32 jitDurationMs)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+    _ASSERTE(g_pConfig->TieredCompilation());
+    _ASSERTE(pMethodDesc != NULL);
+
+    FireEtwTieredCompilationBackgroundJitMethod(GetClrInstanceId(), (ULONGLONG)pMethodDesc, queueDurationMs, jitDurationMs);
+}
+
 #endif // !FEATURE_REDHAWK
 
 #ifdef FEATURE_PERFTRACING
@@ -63,11 +63,9 @@ DictionaryLayout::Allocate(
 
     DictionaryLayout * pD = (DictionaryLayout *)(void *)ptr;
 
-    // When bucket spills we'll allocate another layout structure
-    pD->m_pNext = NULL;
-
     // This is the number of slots excluding the type parameters
     pD->m_numSlots = numSlots;
+    pD->m_numInitialSlots = numSlots;
 
     RETURN pD;
 } // DictionaryLayout::Allocate
@@ -76,7 +74,7 @@ DictionaryLayout::Allocate(
 
 //---------------------------------------------------------------------------------------
 //
-// Count the number of bytes that are required by the first bucket in a dictionary with the specified layout
+// Count the number of bytes that are required by a dictionary with the specified layout
 // 
 //static
 DWORD 
@@ -90,21 +88,94 @@ DictionaryLayout::GetFirstDictionaryBucketSize(
 
     DWORD bytes = numGenericArgs * sizeof(TypeHandle);
     if (pDictLayout != NULL)
-        bytes += pDictLayout->m_numSlots * sizeof(void*);
+    {
+        // The extra slot holds the size of the dictionary
+        bytes += (pDictLayout->m_numSlots + 1) * sizeof(void*);
+    }
 
     return bytes;
 }
 
 #ifndef DACCESS_COMPILE 
+//---------------------------------------------------------------------------------------
+//
+// Dictionaries in native images are laid out at image generation time and cannot be
+// expanded afterwards, and the dictionary lookup stubs used by ReadyToRun code do not
+// check the dictionary size, so only lookups from the JIT at runtime can use slots
+// added by an expansion.
+//
+/* static */
+BOOL
+DictionaryLayout::CanExpand(DictionaryEntrySignatureSource signatureSource)
+{
+    LIMITED_METHOD_CONTRACT;
+    return signatureSource == FromJIT && !IsCompilationProcess();
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Append the dictionary slot to a signature built by the JIT interface and copy it to
+// the loader heap. A slot of 0 means the entry is not stored in the dictionary.
+//
+/* static */
+PVOID
+DictionaryLayout::CreateSignatureWithSlotData(SigBuilder *       pSigBuilder,
+                                              LoaderAllocator *  pAllocator,
+                                              WORD               slot)
+{
+    STANDARD_VM_CONTRACT;
+
+    pSigBuilder->AppendData(slot);
+
+    DWORD cbNewSig;
+    PVOID pNewSig = pSigBuilder->GetSignature(&cbNewSig);
+
+    PVOID pResultSignature = pAllocator->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(cbNewSig));
+    memcpy(pResultSignature, pNewSig, cbNewSig);
+
+    return pResultSignature;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Fill in the indirections needed to get to a dictionary slot
+//
+/* static */
+void
+DictionaryLayout::SetSlotLookupResult(CORINFO_RUNTIME_LOOKUP *   pResult,
+                                      DWORD                      numGenericArgs,
+                                      DictionaryLayout *         pDictLayout,
+                                      int                        nFirstOffset,
+                                      WORD                       slot)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
+    pResult->indirections = static_cast<WORD>(nFirstOffset + 1);
+    pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
+
+    // Dictionaries allocated before the layout was expanded may not have this slot yet
+    if (slot >= numGenericArgs + 1 + pDictLayout->m_numInitialSlots)
+    {
+        _ASSERTE(FitsIn<WORD>(numGenericArgs * sizeof(DictionaryEntry)));
+        pResult->sizeOffset = static_cast<WORD>(numGenericArgs * sizeof(DictionaryEntry));
+    }
+    else
+    {
+        pResult->sizeOffset = CORINFO_NO_SIZE_CHECK;
+    }
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Find a token in the dictionary layout and return the offsets of indirections
 // required to get to its slot in the actual dictionary
 //
+// If useEmptySlot is set, the caller must hold the domain lock and the first
+// empty slot of the layout is claimed for the token if it is not found.
+//
 // NOTE: We will currently never return more than one indirection. We don't
-// cascade dictionaries but we will record overflows in the dictionary layout
-// (and cascade that accordingly) so we can prepopulate the overflow hash in
-// reliability scenarios.
+// cascade dictionaries.
 //
 // Optimize the case of a token being !i (for class dictionaries) or !!i (for method dictionaries)
 // 
@@ -113,13 +184,14 @@ BOOL
 DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
                                   DWORD                             numGenericArgs,
                                   DictionaryLayout *                pDictLayout,
-                                  CORINFO_RUNTIME_LOOKUP *          pResult,
                                   SigBuilder *                      pSigBuilder,
                                   BYTE *                            pSig,
                                   DWORD                             cbSig,
                                   int                               nFirstOffset,
                                   DictionaryEntrySignatureSource    signatureSource,
-                                  WORD *                            pSlotOut)
+                                  CORINFO_RUNTIME_LOOKUP *          pResult,
+                                  WORD *                            pSlotOut,
+                                  BOOL                              useEmptySlot)
 {
     CONTRACTL
     {
@@ -132,158 +204,265 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
     }
     CONTRACTL_END
 
-#ifndef FEATURE_NATIVE_IMAGE_GENERATION
-    // If the tiered compilation is on, save the fast dictionary slots for the hot Tier1 code
-    if (g_pConfig->TieredCompilation() && signatureSource == FromReadyToRunImage)
-    {
-        pResult->signature = pSig;
-        return FALSE;
-    }
-#endif
-
-    BOOL isFirstBucket = TRUE;
+    // The dictionary starts with the type parameters and the dictionary size
+    _ASSERTE(FitsIn<WORD>(numGenericArgs + 1));
+    WORD slot = static_cast<WORD>(numGenericArgs + 1);
 
-    // First bucket also contains type parameters
-    _ASSERTE(FitsIn<WORD>(numGenericArgs));
-    WORD slot = static_cast<WORD>(numGenericArgs);
-    for (;;)
+    for (DWORD iSlot = 0; iSlot < pDictLayout->m_numSlots; iSlot++)
     {
-        for (DWORD iSlot = 0; iSlot < pDictLayout->m_numSlots; iSlot++)
+        BYTE * pCandidate = (BYTE *)pDictLayout->m_slots[iSlot].m_signature;
+        if (pCandidate != NULL)
         {
-        RetryMatch:
-            BYTE * pCandidate = (BYTE *)pDictLayout->m_slots[iSlot].m_signature;
-            if (pCandidate != NULL)
-            {
-                bool signaturesMatch = false;
-
-                if (pSigBuilder != NULL)
-                {
-                    // JIT case: compare signatures by comparing the bytes in them. We exclude
-                    // any ReadyToRun signatures from the JIT case.
+            bool signaturesMatch = false;
 
-                    if (pDictLayout->m_slots[iSlot].m_signatureSource != FromReadyToRunImage)
-                    {
-                        // Compare the signatures. We do not need to worry about the size of pCandidate. 
-                        // As long as we are comparing one byte at a time we are guaranteed to not overrun.
-                        DWORD j;
-                        for (j = 0; j < cbSig; j++)
-                        {
-                            if (pCandidate[j] != pSig[j])
-                                break;
-                        }
-                        signaturesMatch = (j == cbSig);
-                    }
-                }
-                else
-                {
-                    // ReadyToRun case: compare signatures by comparing their pointer values
-                    signaturesMatch = (pCandidate == pSig);
-                }
+            if (pSigBuilder != NULL)
+            {
+                // JIT case: compare signatures by comparing the bytes in them. We exclude
+                // any ReadyToRun signatures from the JIT case.
 
-                // We've found it
-                if (signaturesMatch)
+                if (pDictLayout->m_slots[iSlot].m_signatureSource != FromReadyToRunImage)
                 {
-                    pResult->signature = pDictLayout->m_slots[iSlot].m_signature;
-
-                    // We don't store entries outside the first bucket in the layout in the dictionary (they'll be cached in a hash
-                    // instead).
-                    if (!isFirstBucket)
+                    // Compare the signatures. We do not need to worry about the size of pCandidate. 
+                    // As long as we are comparing one byte at a time we are guaranteed to not overrun.
+                    DWORD j;
+                    for (j = 0; j < cbSig; j++)
                     {
-                        return FALSE;
+                        if (pCandidate[j] != pSig[j])
+                            break;
                     }
-                    _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
-                    pResult->indirections = static_cast<WORD>(nFirstOffset + 1);
-                    pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
-                    *pSlotOut = slot;
-                    return TRUE;
+                    signaturesMatch = (j == cbSig);
                 }
             }
-            // If we hit an empty slot then there's no more so use it
             else
             {
-                {
-                    BaseDomain::LockHolder lh(pAllocator->GetDomain());
-
-                    if (pDictLayout->m_slots[iSlot].m_signature != NULL)
-                        goto RetryMatch;
-
-                    PVOID pResultSignature = pSig;
+                // ReadyToRun case: compare signatures by comparing their pointer values
+                signaturesMatch = (pCandidate == pSig);
+            }
 
-                    if (pSigBuilder != NULL)
-                    {
-                        pSigBuilder->AppendData(isFirstBucket ? slot : 0);
+            // We've found it
+            if (signaturesMatch)
+            {
+                pResult->signature = pDictLayout->m_slots[iSlot].m_signature;
+                SetSlotLookupResult(pResult, numGenericArgs, pDictLayout, nFirstOffset, slot);
+                *pSlotOut = slot;
+                return TRUE;
+            }
+        }
+        // If we hit an empty slot then there's no more so use it
+        else
+        {
+            if (!useEmptySlot)
+                return FALSE;
 
-                        DWORD cbNewSig;
-                        PVOID pNewSig = pSigBuilder->GetSignature(&cbNewSig);
+            // ReadyToRun code cannot check the dictionary size, so it only gets the slots that
+            // every dictionary is guaranteed to have
+            if (signatureSource == FromReadyToRunImage && iSlot >= pDictLayout->m_numInitialSlots)
+                return FALSE;
 
-                        pResultSignature = pAllocator->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(cbNewSig));
-                        memcpy(pResultSignature, pNewSig, cbNewSig);
-                    }
+            PVOID pResultSignature = pSig;
 
-                    *EnsureWritablePages(&(pDictLayout->m_slots[iSlot].m_signature)) = pResultSignature;
-                    *EnsureWritablePages(&(pDictLayout->m_slots[iSlot].m_signatureSource)) = signatureSource;
-                }
+            if (pSigBuilder != NULL)
+                pResultSignature = CreateSignatureWithSlotData(pSigBuilder, pAllocator, slot);
 
-                pResult->signature = pDictLayout->m_slots[iSlot].m_signature;
+            *EnsureWritablePages(&(pDictLayout->m_slots[iSlot].m_signatureSource)) = signatureSource;
+            VolatileStore(EnsureWritablePages(&(pDictLayout->m_slots[iSlot].m_signature)), pResultSignature);
 
-                // Again, we only store entries in the first layout bucket in the dictionary.
-                if (!isFirstBucket)
-                {
-                    return FALSE;
-                }
-                _ASSERTE(FitsIn<WORD>(nFirstOffset + 1));
-                pResult->indirections = static_cast<WORD>(nFirstOffset + 1);
-                pResult->offsets[nFirstOffset] = slot * sizeof(DictionaryEntry);
-                *pSlotOut = slot;
-                return TRUE;
-            }
-            slot++;
+            pResult->signature = pResultSignature;
+            SetSlotLookupResult(pResult, numGenericArgs, pDictLayout, nFirstOffset, slot);
+            *pSlotOut = slot;
+            return TRUE;
         }
+        slot++;
+    }
 
-        // If we've reached the end of the chain we need to allocate another bucket. Make the pointer update carefully to avoid
-        // orphaning a bucket in a race. We leak the loser in such a race (since the allocation comes from the loader heap) but both
-        // the race and the overflow should be very rare.
-        if (pDictLayout->m_pNext == NULL)
-            FastInterlockCompareExchangePointer(EnsureWritablePages(&(pDictLayout->m_pNext)), Allocate(4, pAllocator, NULL), 0);
+    return FALSE;
+} // DictionaryLayout::FindTokenWorker
 
-        pDictLayout = pDictLayout->m_pNext;
-        isFirstBucket = FALSE;
+//---------------------------------------------------------------------------------------
+//
+// Allocate a copy of a full dictionary layout with twice as many slots, and put the
+// token in the first new slot. The caller must hold the domain lock and publish the
+// new layout.
+//
+/* static */
+DictionaryLayout *
+DictionaryLayout::ExpandDictionaryLayout(LoaderAllocator *               pAllocator,
+                                         DictionaryLayout *              pCurrentDictLayout,
+                                         DWORD                           numGenericArgs,
+                                         SigBuilder *                    pSigBuilder,
+                                         BYTE *                          pSig,
+                                         int                             nFirstOffset,
+                                         DictionaryEntrySignatureSource  signatureSource,
+                                         CORINFO_RUNTIME_LOOKUP *        pResult,
+                                         WORD *                          pSlotOut)
+{
+    CONTRACTL
+    {
+        STANDARD_VM_CHECK;
+        PRECONDITION(CheckPointer(pCurrentDictLayout));
+        PRECONDITION(CheckPointer(pSigBuilder));
+        PRECONDITION(CheckPointer(pSlotOut));
     }
-} // DictionaryLayout::FindToken
+    CONTRACTL_END
+
+    // There shouldn't be any empty slots remaining in the current layout
+    _ASSERTE(pCurrentDictLayout->m_numSlots == 0 ||
+             pCurrentDictLayout->m_slots[pCurrentDictLayout->m_numSlots - 1].m_signature != NULL);
+
+    // Every expansion leaves the dictionaries allocated for the old layout behind, so stop
+    // growing at some point and let further lookups use the generic handle cache instead
+    if (pCurrentDictLayout->m_numSlots >= MaxExpandedSlots)
+        return NULL;
+
+    // Layouts trimmed by NGEN may have no slots at all
+    DWORD numSlots = min(max((DWORD)pCurrentDictLayout->m_numSlots * 2, (DWORD)4), (DWORD)MaxExpandedSlots);
+
+    // Slot numbers are encoded in 16 bits in signatures and in dictionaryIndexAndSlot
+    if (!FitsIn<WORD>(numGenericArgs + 1 + numSlots))
+        return NULL;
+
+    DictionaryLayout * pNewDictLayout = Allocate(static_cast<WORD>(numSlots), pAllocator, NULL);
+    pNewDictLayout->m_numInitialSlots = pCurrentDictLayout->m_numInitialSlots;
+
+    for (DWORD iSlot = 0; iSlot < pCurrentDictLayout->m_numSlots; iSlot++)
+        pNewDictLayout->m_slots[iSlot] = pCurrentDictLayout->m_slots[iSlot];
+
+    WORD layoutSlotIndex = pCurrentDictLayout->m_numSlots;
+    WORD slot = static_cast<WORD>(numGenericArgs + 1 + layoutSlotIndex);
+
+    PVOID pResultSignature = CreateSignatureWithSlotData(pSigBuilder, pAllocator, slot);
+    pNewDictLayout->m_slots[layoutSlotIndex].m_signature = pResultSignature;
+    pNewDictLayout->m_slots[layoutSlotIndex].m_signatureSource = signatureSource;
+
+    pResult->signature = pResultSignature;
+    SetSlotLookupResult(pResult, numGenericArgs, pNewDictLayout, nFirstOffset, slot);
+    *pSlotOut = slot;
+
+    return pNewDictLayout;
+} // DictionaryLayout::ExpandDictionaryLayout
 
 /* static */
 BOOL 
-DictionaryLayout::FindToken(LoaderAllocator *               pAllocator, 
-                            DWORD                           numGenericArgs, 
-                            DictionaryLayout *              pDictLayout, 
-                            CORINFO_RUNTIME_LOOKUP *        pResult, 
-                            SigBuilder *                    pSigBuilder, 
-                            int                             nFirstOffset, 
-                            DictionaryEntrySignatureSource  signatureSource)
+DictionaryLayout::FindToken(MethodTable *                   pMT,
+                            LoaderAllocator *               pAllocator,
+                            int                             nFirstOffset,
+                            SigBuilder *                    pSigBuilder,
+                            BYTE *                          pSig,
+                            DictionaryEntrySignatureSource  signatureSource,
+                            CORINFO_RUNTIME_LOOKUP *        pResult,
+                            WORD *                          pSlotOut)
 {
-    WRAPPER_NO_CONTRACT;
+    CONTRACTL
+    {
+        STANDARD_VM_CHECK;
+        PRECONDITION(CheckPointer(pMT));
+        PRECONDITION(CheckPointer(pAllocator));
+        PRECONDITION(CheckPointer(pResult));
+        PRECONDITION(pSigBuilder != NULL || pSig != NULL);
+    }
+    CONTRACTL_END
+
+#ifndef FEATURE_NATIVE_IMAGE_GENERATION
+    // If the tiered compilation is on, save the fast dictionary slots for the hot Tier1 code
+    if (g_pConfig->TieredCompilation() && signatureSource == FromReadyToRunImage)
+    {
+        pResult->signature = pSig;
+        return FALSE;
+    }
+#endif
+
+    DWORD cbSig = -1;
+    pSig = (pSigBuilder != NULL) ? (BYTE *)pSigBuilder->GetSignature(&cbSig) : pSig;
+
+    DWORD numGenericArgs = pMT->GetNumGenericArgs();
 
-    DWORD cbSig;
-    BYTE * pSig = (BYTE *)pSigBuilder->GetSignature(&cbSig);
+    if (FindTokenWorker(pAllocator, numGenericArgs, pMT->GetClass()->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, FALSE))
+        return TRUE;
+
+    BaseDomain::LockHolder lh(pAllocator->GetDomain());
+
+    // Try again under the lock, in case another thread has added the token or expanded the layout
+    DictionaryLayout * pCurrentDictLayout = pMT->GetClass()->GetDictionaryLayout();
+    if (FindTokenWorker(pAllocator, numGenericArgs, pCurrentDictLayout, pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, TRUE))
+        return TRUE;
+
+    if (CanExpand(signatureSource))
+    {
+        DictionaryLayout * pNewDictLayout = ExpandDictionaryLayout(pAllocator, pCurrentDictLayout, numGenericArgs, pSigBuilder, pSig, nFirstOffset, signatureSource, pResult, pSlotOut);
+        if (pNewDictLayout != NULL)
+        {
+            // Make the new layout fully visible before publishing it
+            MemoryBarrier();
+            pMT->GetClass()->SetDictionaryLayout(pNewDictLayout);
+            return TRUE;
+        }
+    }
 
-    WORD slotDummy;
-    return FindTokenWorker(pAllocator, numGenericArgs, pDictLayout, pResult, pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, &slotDummy);
+    // Fall back to the generic handle cache
+    pResult->signature = (pSigBuilder != NULL) ? CreateSignatureWithSlotData(pSigBuilder, pAllocator, 0) : pSig;
+    return FALSE;
 }
 
 /* static */
 BOOL 
-DictionaryLayout::FindToken(LoaderAllocator *               pAllocator,
-                            DWORD                           numGenericArgs, 
-                            DictionaryLayout *              pDictLayout, 
-                            CORINFO_RUNTIME_LOOKUP *        pResult, 
-                            BYTE *                          signature,
+DictionaryLayout::FindToken(MethodDesc *                    pMD,
+                            LoaderAllocator *               pAllocator,
                             int                             nFirstOffset,
+                            SigBuilder *                    pSigBuilder,
+                            BYTE *                          pSig,
                             DictionaryEntrySignatureSource  signatureSource,
+                            CORINFO_RUNTIME_LOOKUP *        pResult,
                             WORD *                          pSlotOut)
 {
-    WRAPPER_NO_CONTRACT;
+    CONTRACTL
+    {
+        STANDARD_VM_CHECK;
+        PRECONDITION(CheckPointer(pMD));
+        PRECONDITION(CheckPointer(pAllocator));
+        PRECONDITION(CheckPointer(pResult));
+        PRECONDITION(pSigBuilder != NULL || pSig != NULL);
+    }
+    CONTRACTL_END
+
+#ifndef FEATURE_NATIVE_IMAGE_GENERATION
+    // If the tiered compilation is on, save the fast dictionary slots for the hot Tier1 code
+    if (g_pConfig->TieredCompilation() && signatureSource == FromReadyToRunImage)
+    {
+        pResult->signature = pSig;
+        return FALSE;
+    }
+#endif
+
+    DWORD cbSig = -1;
+    pSig = (pSigBuilder != NULL) ? (BYTE *)pSigBuilder->GetSignature(&cbSig) : pSig;
+
+    DWORD numGenericArgs = pMD->GetNumGenericMethodArgs();
 
-    return FindTokenWorker(pAllocator, numGenericArgs, pDictLayout, pResult, NULL, signature, -1, nFirstOffset, signatureSource, pSlotOut);
+    if (FindTokenWorker(pAllocator, numGenericArgs, pMD->GetDictionaryLayout(), pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, FALSE))
+        return TRUE;
+
+    BaseDomain::LockHolder lh(pAllocator->GetDomain());
+
+    // Try again under the lock, in case another thread has added the token or expanded the layout
+    DictionaryLayout * pCurrentDictLayout = pMD->GetDictionaryLayout();
+    if (FindTokenWorker(pAllocator, numGenericArgs, pCurrentDictLayout, pSigBuilder, pSig, cbSig, nFirstOffset, signatureSource, pResult, pSlotOut, TRUE))
+        return TRUE;
+
+    if (CanExpand(signatureSource))
+    {
+        DictionaryLayout * pNewDictLayout = ExpandDictionaryLayout(pAllocator, pCurrentDictLayout, numGenericArgs, pSigBuilder, pSig, nFirstOffset, signatureSource, pResult, pSlotOut);
+        if (pNewDictLayout != NULL)
+        {
+            // Make the new layout fully visible before publishing it
+            MemoryBarrier();
+            pMD->AsInstantiatedMethodDesc()->IMD_SetDictionaryLayout(pNewDictLayout);
+            return TRUE;
+        }
+    }
+
+    // Fall back to the generic handle cache
+    pResult->signature = (pSigBuilder != NULL) ? CreateSignatureWithSlotData(pSigBuilder, pAllocator, 0) : pSig;
+    return FALSE;
 }
 
 #endif //!DACCESS_COMPILE
@@ -354,14 +533,7 @@ DictionaryLayout::Save(
 {
     STANDARD_VM_CONTRACT;
 
-    DictionaryLayout *pDictLayout = this;
-
-    while (pDictLayout)
-    {
-        image->StoreStructure(pDictLayout, pDictLayout->GetObjectSize(), DataImage::ITEM_DICTIONARY_LAYOUT);
-        pDictLayout = pDictLayout->m_pNext;
-    }
-
+    image->StoreStructure(this, GetObjectSize(), DataImage::ITEM_DICTIONARY_LAYOUT);
 }
 
 //---------------------------------------------------------------------------------------
@@ -378,15 +550,12 @@ DictionaryLayout::Trim()
     }
     CONTRACTL_END;
 
-    // Only the last bucket in the chain may have unused entries
-    DictionaryLayout *pDictLayout = this;
-    while (pDictLayout->m_pNext)
-        pDictLayout = pDictLayout->m_pNext;
-
-    // Trim down the size to what's actually used
-    DWORD dwSlots = pDictLayout->GetNumUsedSlots();
+    // Trim down the size to what's actually used. The dictionaries saved in the image
+    // are sized after the trimmed layout, so that becomes the initial size as well.
+    DWORD dwSlots = GetNumUsedSlots();
     _ASSERTE(FitsIn<WORD>(dwSlots));
-    *EnsureWritablePages(&pDictLayout->m_numSlots) = static_cast<WORD>(dwSlots);
+    *EnsureWritablePages(&m_numSlots) = static_cast<WORD>(dwSlots);
+    *EnsureWritablePages(&m_numInitialSlots) = static_cast<WORD>(dwSlots);
 
 }
 
@@ -401,21 +570,14 @@ DictionaryLayout::Fixup(
 {
     STANDARD_VM_CONTRACT;
 
-    DictionaryLayout *pDictLayout = this;
-
-    while (pDictLayout)
+    for (DWORD i = 0; i < m_numSlots; i++)
     {
-        for (DWORD i = 0; i < pDictLayout->m_numSlots; i++)
+        PVOID signature = m_slots[i].m_signature;
+        if (signature != NULL)
         {
-            PVOID signature = pDictLayout->m_slots[i].m_signature;
-            if (signature != NULL)
-            {
-                image->FixupFieldToNode(pDictLayout, (BYTE *)&pDictLayout->m_slots[i].m_signature - (BYTE *)pDictLayout,
-                    image->GetGenericSignature(signature, fMethod));
-            }
+            image->FixupFieldToNode(this, (BYTE *)&m_slots[i].m_signature - (BYTE *)this,
+                image->GetGenericSignature(signature, fMethod));
         }
-        image->FixupPointerField(pDictLayout, offsetof(DictionaryLayout, m_pNext));
-        pDictLayout = pDictLayout->m_pNext;
     }
 }
 
@@ -452,9 +614,13 @@ Dictionary::Fixup(
     // Now traverse the remaining slots
     if (pDictLayout != NULL)
     {
+        // The layout may have been trimmed since this dictionary was allocated
+        Dictionary * pImageDictionary = (Dictionary *)image->GetImagePointer(this);
+        pImageDictionary->SetDictionarySlotsSize(numGenericArgs, DictionaryLayout::GetFirstDictionaryBucketSize(numGenericArgs, pDictLayout));
+
         for (DWORD i = 0; i < pDictLayout->m_numSlots; i++)
         {
-            int slotOffset = (numGenericArgs + i) * sizeof(DictionaryEntry);
+            int slotOffset = (numGenericArgs + 1 + i) * sizeof(DictionaryEntry);
 
             // First check if we can simply hardbind to a prerestored object
             DictionaryEntryLayout *pLayout = pDictLayout->GetEntryLayout(i);
@@ -1245,14 +1411,172 @@ Dictionary::PopulateEntry(
 
         if ((slotIndex != 0) && !IsCompilationProcess())
         {
-            *EnsureWritablePages(pDictionary->GetSlotAddr(0, slotIndex)) = result;
-            *ppSlot = pDictionary->GetSlotAddr(0, slotIndex);
+            // The layout may have been expanded since this dictionary was allocated
+            pDictionary = (pMT != NULL) ?
+                GetTypeDictionaryWithSizeCheck(pMT, slotIndex) :
+                GetMethodDictionaryWithSizeCheck(pMD, slotIndex);
+
+            if (pDictionary != NULL)
+            {
+                DictionaryEntry * pSlot = (DictionaryEntry *)&pDictionary->m_pEntries[slotIndex];
+                *EnsureWritablePages(pSlot) = result;
+                *ppSlot = pSlot;
+            }
         }
     }
 
     return result;
 } // Dictionary::PopulateEntry
 
+//---------------------------------------------------------------------------------------
+//
+// Allocate a copy of a dictionary that is large enough for the current layout. The old
+// dictionary is left alone since other threads may still be reading from it.
+//
+static Dictionary * AllocateExpandedDictionary(
+    LoaderAllocator *  pAllocator,
+    Dictionary *       pCurrentDictionary,
+    DWORD              numGenericArgs,
+    DWORD              cbCurrentSize,
+    DWORD              cbNewSize)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(cbNewSize > cbCurrentSize);
+
+    Dictionary * pNewDictionary = (Dictionary *)(void *)pAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(cbNewSize));
+
+    // Copy the instantiation and the slots filled in so far; the rest stays zero
+    memcpy(pNewDictionary, pCurrentDictionary, cbCurrentSize);
+    pNewDictionary->SetDictionarySlotsSize(numGenericArgs, cbNewSize);
+
+    return pNewDictionary;
+}
+
+//---------------------------------------------------------------------------------------
+//
+/* static */
+Dictionary *
+Dictionary::GetTypeDictionaryWithSizeCheck(
+    MethodTable *  pMT,
+    ULONG          slotIndex)
+{
+    STANDARD_VM_CONTRACT;
+
+    DWORD numGenericArgs = pMT->GetNumGenericArgs();
+    Dictionary * pDictionary = pMT->GetDictionary();
+    DWORD cbSlotEnd = (slotIndex + 1) * sizeof(DictionaryEntry);
+
+    if (pDictionary->GetDictionarySlotsSize(numGenericArgs) >= cbSlotEnd)
+        return pDictionary;
+
+    // The per-inst info of types in native images may be shared or read-only
+    if (pMT->IsZapped())
+        return NULL;
+
+    BaseDomain::LockHolder lh(pMT->GetLoaderAllocator()->GetDomain());
+
+    pDictionary = pMT->GetDictionary();
+    DWORD cbCurrentSize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
+    if (cbCurrentSize >= cbSlotEnd)
+        return pDictionary;
+
+    DWORD cbNewSize = DictionaryLayout::GetFirstDictionaryBucketSize(numGenericArgs, pMT->GetClass()->GetDictionaryLayout());
+    _ASSERTE(cbNewSize >= cbSlotEnd);
+
+    Dictionary * pNewDictionary = AllocateExpandedDictionary(pMT->GetLoaderAllocator(), pDictionary, numGenericArgs, cbCurrentSize, cbNewSize);
+
+    // Publish the new dictionary. Types derived from this one keep pointing at the old
+    // copy until they take the slow path; see code:JIT_GenericHandleWorker.
+    MemoryBarrier();
+    pMT->GetPerInstInfo()[pMT->GetNumDicts() - 1].SetValueMaybeNull(pNewDictionary);
+
+    return pNewDictionary;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// The inherited dictionary pointers of a derived type are not updated under any lock, and
+// two threads may race to update one to different copies of the parent's dictionary.
+// Copies only ever grow, so the update is done with a compare-exchange that never
+// replaces a dictionary with a smaller one.
+//
+/* static */
+void
+Dictionary::UpdateInheritedDictionary(
+    MethodTable *  pMT,
+    MethodTable *  pDeclaringMT,
+    DWORD          dictionaryIndex)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(CheckPointer(pMT));
+        PRECONDITION(CheckPointer(pDeclaringMT));
+        PRECONDITION(!pMT->IsZapped());
+        PRECONDITION(pDeclaringMT->GetNumDicts() == dictionaryIndex + 1);
+    }
+    CONTRACTL_END;
+
+    MethodTable::PerInstInfoElem_t * pPerInstInfoElem = EnsureWritablePages(&pMT->GetPerInstInfo()[dictionaryIndex]);
+
+    DWORD numGenericArgs = pDeclaringMT->GetNumGenericArgs();
+    Dictionary * pDeclaringDictionary = pDeclaringMT->GetDictionary();
+    DWORD cbDeclaringSize = pDeclaringDictionary->GetDictionarySlotsSize(numGenericArgs);
+
+    Dictionary * pCurrentDictionary = pPerInstInfoElem->GetValueMaybeNull();
+    while (pCurrentDictionary != pDeclaringDictionary &&
+           pCurrentDictionary->GetDictionarySlotsSize(numGenericArgs) < cbDeclaringSize)
+    {
+        Dictionary * pPreviousDictionary = pPerInstInfoElem->CompareExchangeValue(pDeclaringDictionary, pCurrentDictionary);
+        if (pPreviousDictionary == pCurrentDictionary)
+            break;
+
+        // Another thread got in first; only retry if it installed a smaller copy
+        pCurrentDictionary = pPreviousDictionary;
+    }
+}
+
+//---------------------------------------------------------------------------------------
+//
+/* static */
+Dictionary *
+Dictionary::GetMethodDictionaryWithSizeCheck(
+    MethodDesc *   pMD,
+    ULONG          slotIndex)
+{
+    STANDARD_VM_CONTRACT;
+
+    DWORD numGenericArgs = pMD->GetNumGenericMethodArgs();
+    Dictionary * pDictionary = pMD->GetMethodDictionary();
+    DWORD cbSlotEnd = (slotIndex + 1) * sizeof(DictionaryEntry);
+
+    if (pDictionary->GetDictionarySlotsSize(numGenericArgs) >= cbSlotEnd)
+        return pDictionary;
+
+    if (pMD->IsZapped())
+        return NULL;
+
+    BaseDomain::LockHolder lh(pMD->GetLoaderAllocator()->GetDomain());
+
+    pDictionary = pMD->GetMethodDictionary();
+    DWORD cbCurrentSize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
+    if (cbCurrentSize >= cbSlotEnd)
+        return pDictionary;
+
+    DWORD cbNewSize = DictionaryLayout::GetFirstDictionaryBucketSize(numGenericArgs, pMD->GetDictionaryLayout());
+    _ASSERTE(cbNewSize >= cbSlotEnd);
+
+    Dictionary * pNewDictionary = AllocateExpandedDictionary(pMD->GetLoaderAllocator(), pDictionary, numGenericArgs, cbCurrentSize, cbNewSize);
+
+    MemoryBarrier();
+    pMD->AsInstantiatedMethodDesc()->IMD_SetMethodDictionary(pNewDictionary);
+
+    return pNewDictionary;
+}
+
 //---------------------------------------------------------------------------------------
 // 
 void 
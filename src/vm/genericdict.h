@@ -47,7 +47,19 @@
 // that is shared across compatible instantiations. For generic methods, the layout
 // is stored in the InstantiatedMethodDesc associated with the shared generic code itself.
 //
-
+// DICTIONARY EXPANSION
+//
+// When all the slots of a layout are in use, the layout is replaced by a bigger copy
+// instead of spilling lookups into the generic handle cache. Dictionaries allocated
+// against the old layout are only expanded when a lookup hits one of the new slots:
+// the slot right after the instantiation records the size of each dictionary in bytes,
+// and JIT-ed code checks it before loading any slot past the initial size of the layout.
+// Expanding a dictionary allocates a new one from the loader heap and repoints the
+// owner at it; the old dictionary stays valid (and is only freed with its loader
+// allocator) so that code racing with the expansion just takes the slow path. Layouts
+// stop growing at DictionaryLayout::MaxExpandedSlots, which bounds the space taken by
+// superseded dictionaries to less than the size of the final one.
+//
 class TypeHandleList;
 class Module;
 class BaseDomain;
@@ -101,51 +113,85 @@ class DictionaryLayout
     friend class NativeImageDumper;
 #endif
 private:
-    // Next bucket of slots (only used to track entries that won't fit in the dictionary)
-    DictionaryLayout* m_pNext;
-    
-    // Number of non-type-argument slots in this bucket
-    WORD m_numSlots;          
+    // Number of non-type-argument slots in this layout
+    WORD m_numSlots;
+
+    // Number of slots the layout had before it was ever expanded. Every dictionary
+    // using this layout has at least this many slots, so lookups into them do not
+    // need to check the dictionary size.
+    WORD m_numInitialSlots;
 
     // m_numSlots of these
     DictionaryEntryLayout m_slots[1];
 
-    static BOOL FindTokenWorker(LoaderAllocator *pAllocator,
-                                DWORD numGenericArgs,
-                                DictionaryLayout *pDictLayout,
-                                CORINFO_RUNTIME_LOOKUP *pResult,
-                                SigBuilder * pSigBuilder,
-                                BYTE * pSig,
-                                DWORD cbSig,
-                                int nFirstOffset,
-                                DictionaryEntrySignatureSource signatureSource,
-                                WORD * pSlotOut);
-
-     
+    // Layouts are not expanded beyond this many slots. Since a layout at least doubles on every
+    // expansion, the superseded copies of a dictionary (which cannot be freed while other threads
+    // may still be reading them) take up less space than the final copy.
+    static const DWORD MaxExpandedSlots = 256;
+
+    static BOOL FindTokenWorker(LoaderAllocator *                 pAllocator,
+                                DWORD                             numGenericArgs,
+                                DictionaryLayout *                pDictLayout,
+                                SigBuilder *                      pSigBuilder,
+                                BYTE *                            pSig,
+                                DWORD                             cbSig,
+                                int                               nFirstOffset,
+                                DictionaryEntrySignatureSource    signatureSource,
+                                CORINFO_RUNTIME_LOOKUP *          pResult,
+                                WORD *                            pSlotOut,
+                                BOOL                              useEmptySlot);
+
+    static DictionaryLayout* ExpandDictionaryLayout(LoaderAllocator *               pAllocator,
+                                                    DictionaryLayout *              pCurrentDictLayout,
+                                                    DWORD                           numGenericArgs,
+                                                    SigBuilder *                    pSigBuilder,
+                                                    BYTE *                          pSig,
+                                                    int                             nFirstOffset,
+                                                    DictionaryEntrySignatureSource  signatureSource,
+                                                    CORINFO_RUNTIME_LOOKUP *        pResult,
+                                                    WORD *                          pSlotOut);
+
+    static BOOL CanExpand(DictionaryEntrySignatureSource signatureSource);
+
+    static PVOID CreateSignatureWithSlotData(SigBuilder *       pSigBuilder,
+                                             LoaderAllocator *  pAllocator,
+                                             WORD               slot);
+
+    static void SetSlotLookupResult(CORINFO_RUNTIME_LOOKUP *   pResult,
+                                    DWORD                      numGenericArgs,
+                                    DictionaryLayout *         pDictLayout,
+                                    int                        nFirstOffset,
+                                    WORD                       slot);
+
 public:
-    // Create an initial dictionary layout with a single bucket containing numSlots slots
+    // Create an initial dictionary layout containing numSlots slots
     static DictionaryLayout* Allocate(WORD numSlots, LoaderAllocator *pAllocator, AllocMemTracker *pamTracker);
 
-    // Bytes used for the first bucket of this dictionary, which might be stored inline in
-    // another structure (e.g. MethodTable)
+    // Bytes used for a dictionary allocated against this layout, which might be stored inline in
+    // another structure (e.g. MethodTable). This includes the instantiation and the size slot.
     static DWORD GetFirstDictionaryBucketSize(DWORD numGenericArgs, PTR_DictionaryLayout pDictLayout);
 
-    static BOOL FindToken(LoaderAllocator *pAllocator,
-                          DWORD numGenericArgs,
-                          DictionaryLayout *pDictLayout,
-                          CORINFO_RUNTIME_LOOKUP *pResult,
-                          SigBuilder * pSigBuilder,
-                          int nFirstOffset,
-                          DictionaryEntrySignatureSource signatureSource);
-
-    static BOOL FindToken(LoaderAllocator * pAllocator,
-                          DWORD numGenericArgs,
-                          DictionaryLayout * pDictLayout,
-                          CORINFO_RUNTIME_LOOKUP * pResult,
-                          BYTE * signature,
-                          int nFirstOffset,
-                          DictionaryEntrySignatureSource signatureSource,
-                          WORD * pSlotOut);
+    // Find a token in the dictionary layout of a shared generic type, expanding the
+    // layout if it is full. pSigBuilder is used for tokens coming from the JIT, and
+    // pSig for ReadyToRun fixup blobs.
+    static BOOL FindToken(MethodTable *                     pMT,
+                          LoaderAllocator *                 pAllocator,
+                          int                               nFirstOffset,
+                          SigBuilder *                      pSigBuilder,
+                          BYTE *                            pSig,
+                          DictionaryEntrySignatureSource    signatureSource,
+                          CORINFO_RUNTIME_LOOKUP *          pResult,
+                          WORD *                            pSlotOut);
+
+    // Same as above for the dictionary layout of a shared generic method
+    static BOOL FindToken(MethodDesc *                      pMD,
+                          LoaderAllocator *                 pAllocator,
+                          int                               nFirstOffset,
+                          SigBuilder *                      pSigBuilder,
+                          BYTE *                            pSig,
+                          DictionaryEntrySignatureSource    signatureSource,
+                          CORINFO_RUNTIME_LOOKUP *          pResult,
+                          WORD *                            pSlotOut);
 
     DWORD GetMaxSlots();
     DWORD GetNumUsedSlots();
@@ -158,8 +204,6 @@ public:
             dac_cast<TADDR>(this) + offsetof(DictionaryLayout, m_slots) + sizeof(DictionaryEntryLayout) * i);
     }
 
-    DictionaryLayout* GetNextLayout() { LIMITED_METHOD_CONTRACT; return m_pNext; }
-
 #ifdef FEATURE_PREJIT
     DWORD GetObjectSize();
 
@@ -197,7 +241,8 @@ class Dictionary
   private:
     // First N entries are generic instantiations arguments. They are stored as FixupPointers 
     // in NGen images. It means that the lowest bit is used to mark optional indirection (see code:FixupPointer).
-    // The rest of the open array are normal pointers (no optional indirection).
+    // If the dictionary has a layout, the next entry is the size of the dictionary in bytes, and the
+    // rest of the open array are normal pointers (no optional indirection).
     DictionaryEntry m_pEntries[1];
 
     TADDR EntryAddr(ULONG32 idx)
@@ -224,6 +269,22 @@ class Dictionary
     }
 #endif // #ifndef DACCESS_COMPILE
 
+    // Only valid for dictionaries that have a layout
+    inline DWORD GetDictionarySlotsSize(DWORD numGenericArgs)
+    {
+        LIMITED_METHOD_CONTRACT;
+        SUPPORTS_DAC;
+        return (DWORD)*dac_cast<PTR_SIZE_T>(EntryAddr(numGenericArgs));
+    }
+
+#ifndef DACCESS_COMPILE
+    inline void SetDictionarySlotsSize(DWORD numGenericArgs, DWORD cbDictionary)
+    {
+        LIMITED_METHOD_CONTRACT;
+        *(SIZE_T *)&m_pEntries[numGenericArgs] = cbDictionary;
+    }
+#endif // #ifndef DACCESS_COMPILE
+
   private:
 
 #ifndef DACCESS_COMPILE
@@ -246,22 +307,22 @@ class Dictionary
     inline TypeHandle *GetTypeHandleSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((TypeHandle *) &m_pEntries[numGenericArgs + i]);
+        return ((TypeHandle *) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline MethodDesc **GetMethodDescSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((MethodDesc **) &m_pEntries[numGenericArgs + i]);
+        return ((MethodDesc **) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline FieldDesc **GetFieldDescSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((FieldDesc **) &m_pEntries[numGenericArgs + i]);
+        return ((FieldDesc **) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline DictionaryEntry *GetSlotAddr(DWORD numGenericArgs, DWORD i) 
     { 
         LIMITED_METHOD_CONTRACT; 
-        return ((void **) &m_pEntries[numGenericArgs + i]);
+        return ((void **) &m_pEntries[numGenericArgs + 1 + i]);
     }
     inline DictionaryEntry GetSlot(DWORD numGenericArgs, DWORD i) 
     { 
@@ -274,6 +335,15 @@ class Dictionary
         return GetSlot(numGenericArgs,i) == NULL;
     }
 
+    // Returns the dictionary of the type or method, expanding it first if it is too small
+    // to hold the given slot. Returns NULL if the dictionary cannot be expanded.
+    static Dictionary* GetTypeDictionaryWithSizeCheck(MethodTable * pMT, ULONG slotIndex);
+    static Dictionary* GetMethodDictionaryWithSizeCheck(MethodDesc * pMD, ULONG slotIndex);
+
+    // Points a derived type at the current copy of a dictionary it inherits from pDeclaringMT,
+    // unless it already points at a copy at least as large
+    static void UpdateInheritedDictionary(MethodTable * pMT, MethodTable * pDeclaringMT, DWORD dictionaryIndex);
+
 #endif // #ifndef DACCESS_COMPILE
 
   public:
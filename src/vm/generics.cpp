@@ -485,6 +485,11 @@ ClassLoader::CreateTypeHandleForNonCanonicalGenericInstantiation(
         pInstDest[iArg] = inst[iArg];
     }
 
+    if (pOldMT->GetClass()->GetDictionaryLayout() != NULL)
+    {
+        pDict->SetDictionarySlotsSize(ntypars, cbInstAndDict);
+    }
+
     // Copy interface map across
     InterfaceInfo_t * pInterfaceMap = (InterfaceInfo_t *)(pMemory + cbMT + cbOptional + (fHasDynamicInterfaceMap ? sizeof(DWORD_PTR) : 0));
 
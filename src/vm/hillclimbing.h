@@ -29,6 +29,9 @@ enum HillClimbingStateTransition
     Stabilizing,
     Starvation, //used by ThreadpoolMgr
     ThreadTimedOut, //used by ThreadpoolMgr
+    QueueLatency, //used by ThreadpoolMgr, see LatencyController
+    BlockingCompensation, //used by ThreadpoolMgr, see LatencyController
+    IdleRetirement, //used by ThreadpoolMgr, see LatencyController
     Undefined,
 };
 
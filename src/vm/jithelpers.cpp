@@ -44,6 +44,7 @@
 #include "debuginfostore.h"
 #include "safemath.h"
 #include "threadstatics.h"
+#include "castcache.h"
 
 #ifdef FEATURE_PREJIT
 #include "compile.h"
@@ -2176,6 +2177,11 @@ TypeHandle::CastResult STDCALL ObjIsInstanceOfNoGC(Object *pObject, TypeHandle t
         return TypeHandle::MaybeCast;
     }
 
+    // Casts that previously had to go through the slow path
+    TypeHandle::CastResult cachedResult = CastCache::TryGet(pMT, toTypeHnd);
+    if (cachedResult != TypeHandle::MaybeCast)
+        return cachedResult;
+
     if (pMT->IsArray())
     {
         if (toTypeHnd.IsArray())
@@ -2222,6 +2228,17 @@ BOOL ObjIsInstanceOf(Object *pObject, TypeHandle toTypeHnd, BOOL throwCastExcept
 
     TypeHandle fromTypeHnd = obj->GetTypeHandle();
 
+    switch (CastCache::TryGet(obj->GetMethodTable(), toTypeHnd))
+    {
+    case TypeHandle::CanCast:
+        fCast = TRUE;
+        goto Done;
+    case TypeHandle::CannotCast:
+        goto Done;
+    default:
+        break;
+    }
+
     // If we are trying to cast a proxy we need to delegate to remoting
     // services which will determine whether the proxy and the type are compatible.
     // Start by doing a quick static cast check to see if the type information captured in
@@ -2274,6 +2291,9 @@ BOOL ObjIsInstanceOf(Object *pObject, TypeHandle toTypeHnd, BOOL throwCastExcept
     }
 #endif // FEATURE_ICASTABLE
 
+    CastCache::TrySet(obj->GetMethodTable(), toTypeHnd, fCast);
+
+Done:
     if (!fCast && throwCastException) 
     {
         COMPlusThrowInvalidCastException(&obj, toTypeHnd);
@@ -2312,6 +2332,12 @@ HCIMPL2(Object*, JIT_ChkCastClass_Portable, MethodTable* pTargetMT, Object* pObj
         pMT = MethodTable::GetParentMethodTableOrIndirection(pMT);
     } while (pMT);
 
+    // A cached failure still goes through the slow helper so that it throws
+    if (CastCache::TryGet(pObject->GetMethodTable(), TypeHandle(pTargetMT)) == TypeHandle::CanCast)
+    {
+        return pObject;
+    }
+
     ENDFORBIDGC();
     return HCCALL2(JITutil_ChkCastAny, CORINFO_CLASS_HANDLE(pTargetMT), pObject);
 }
@@ -2339,6 +2365,12 @@ HCIMPL2(Object*, JIT_ChkCastClassSpecial_Portable, MethodTable* pTargetMT, Objec
         pMT = MethodTable::GetParentMethodTableOrIndirection(pMT);
     }
 
+    // A cached failure still goes through the slow helper so that it throws
+    if (CastCache::TryGet(pObject->GetMethodTable(), TypeHandle(pTargetMT)) == TypeHandle::CanCast)
+    {
+        return pObject;
+    }
+
     ENDFORBIDGC();
     return HCCALL2(JITutil_ChkCastAny, CORINFO_CLASS_HANDLE(pTargetMT), pObject);
 }
@@ -2371,6 +2403,15 @@ HCIMPL2(Object*, JIT_IsInstanceOfClass_Portable, MethodTable* pTargetMT, Object*
         return NULL;
     }
 
+    switch (CastCache::TryGet(pObject->GetMethodTable(), TypeHandle(pTargetMT))) {
+    case TypeHandle::CanCast:
+        return pObject;
+    case TypeHandle::CannotCast:
+        return NULL;
+    default:
+        break;
+    }
+
     ENDFORBIDGC();
     return HCCALL2(JITutil_IsInstanceOfAny, CORINFO_CLASS_HANDLE(pTargetMT), pObject);
 }
@@ -2611,6 +2652,14 @@ NOINLINE HCIMPL2(Object *, JITutil_ChkCastAny, CORINFO_CLASS_HANDLE type, Object
 
     TypeHandle clsHnd(type);
 
+    // Every casting helper that cannot decide a cast ends up here (the assembly helpers jump here directly),
+    // so check the cast cache before paying for the helper frame. A cached failure still goes through
+    // ObjIsInstanceOf so that it throws.
+    if (CastCache::TryGet(obj->GetMethodTable(), clsHnd) == TypeHandle::CanCast)
+    {
+        return obj;
+    }
+
     HELPER_METHOD_FRAME_BEGIN_RET_1(oref);
     if (!ObjIsInstanceOf(OBJECTREFToObject(oref), clsHnd, TRUE))
     {
@@ -2634,6 +2683,17 @@ NOINLINE HCIMPL2(Object *, JITutil_IsInstanceOfAny, CORINFO_CLASS_HANDLE type, O
 
     TypeHandle clsHnd(type);
 
+    // Every casting helper that cannot decide a cast ends up here (the assembly helpers jump here directly),
+    // so check the cast cache before paying for the helper frame
+    switch (CastCache::TryGet(obj->GetMethodTable(), clsHnd)) {
+    case TypeHandle::CanCast:
+        return obj;
+    case TypeHandle::CannotCast:
+        return NULL;
+    default:
+        break;
+    }
+
     HELPER_METHOD_FRAME_BEGIN_RET_1(oref);
     if (!ObjIsInstanceOf(OBJECTREFToObject(oref), clsHnd))
         oref = NULL;
@@ -3747,10 +3807,10 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
     } CONTRACTL_END;
  
     MethodTable * pDeclaringMT = NULL;
+    ULONG dictionaryIndex = 0;
 
     if (pMT != NULL)
     {
-        ULONG dictionaryIndex = 0;
 
         if (pModule != NULL)
         {
@@ -3806,6 +3866,26 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
     DictionaryEntry * pSlot;
     CORINFO_GENERIC_HANDLE result = (CORINFO_GENERIC_HANDLE)Dictionary::PopulateEntry(pMD, pDeclaringMT, signature, FALSE, &pSlot, dictionaryIndexAndSlot, pModule);
 
+    if (pSlot != NULL && pMT != NULL && pMT != pDeclaringMT)
+    {
+        // Derived types copy the dictionary pointers of their parents when they are loaded. If the
+        // parent's dictionary has been expanded since, point this type at the new copy as well so
+        // that its lookups stop missing the dictionary.
+        Dictionary * pDeclaringDictionary = pDeclaringMT->GetDictionary();
+        if (pMT->GetPerInstInfo()[dictionaryIndex].GetValueMaybeNull() != pDeclaringDictionary)
+        {
+            if (pMT->IsZapped())
+            {
+                // The per-inst info of types in native images may be shared; use the cache instead
+                pSlot = NULL;
+            }
+            else
+            {
+                Dictionary::UpdateInheritedDictionary(pMT, pDeclaringMT, dictionaryIndex);
+            }
+        }
+    }
+
     if (pSlot == NULL)
     {
         // If we've overflowed the dictionary write the result to the cache.
@@ -0,0 +1,138 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//=========================================================================
+
+//
+// LatencyController.cpp
+//
+// Defines the ThreadPool's queue latency aware concurrency controller.
+//
+
+//=========================================================================
+
+#ifdef LATENCYCONTROLLER_STANDALONE
+#include "simenv.h"     // src/tools/threadpoolsim
+#else
+#include "common.h"
+#endif
+#include "latencycontroller.h"
+
+void LatencyController::Initialize(const LatencyControllerSettings& settings)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    m_targetQueueWaitMs = max(settings.TargetQueueWaitMs, (DWORD)1);
+    m_retireDelayMs = settings.RetireDelayMs;
+    m_maxInjectionPerSample = max(settings.MaxInjectionPerSample, 1);
+    m_numProcessors = max(settings.NumProcessors, 1);
+    m_cpuUtilizationHigh = settings.CpuUtilizationHigh;
+    m_idleMs = 0;
+    m_compensationThreads = 0;
+}
+
+//
+// Requests also wait when the processors are simply busy.  More threads will not get them
+// served sooner then, so don't inject for queue latency if enough workers are known to be
+// runnable and the CPU is in fact busy.  The utilization check catches workers that block
+// without reporting it, e.g. in native code.
+//
+bool LatencyController::IsCpuSaturated(const LatencyControllerSample& sample)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return sample.NumWorking - sample.NumBlocked >= m_numProcessors &&
+           sample.CpuUtilization >= m_cpuUtilizationHigh;
+}
+
+int LatencyController::Update(const LatencyControllerSample& sample, LatencyControllerReason* pReason)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(sample.NumBlocked >= 0);
+    _ASSERTE(sample.MinThreads <= sample.MaxThreads);
+
+    int newMax = sample.MaxWorking;
+    LatencyControllerReason reason = LatencyReason_None;
+
+    //
+    // Blocked workers do not use a processor, so they should not count against MinThreads.
+    //
+    int floor = min(sample.MinThreads + sample.NumBlocked, sample.MaxThreads);
+
+    //
+    // Workers we compensated for have come back.  Withdraw the threads injected on their
+    // behalf right away instead of waiting for the pool to go idle; if the requests still
+    // need them, the queue wait will bring them back.
+    //
+    if (m_compensationThreads > sample.NumBlocked)
+    {
+        int withdraw = m_compensationThreads - sample.NumBlocked;
+        m_compensationThreads = sample.NumBlocked;
+        newMax = max(newMax - withdraw, floor);
+        reason = LatencyReason_BlockingCompensation;
+    }
+
+    if (sample.RequestsPending)
+    {
+        m_idleMs = 0;
+
+        //
+        // Replace blocked workers one for one, without waiting for the queue wait to
+        // build up.  Count from the current limit rather than from MinThreads, so that a
+        // limit already raised by queue latency still grows with each worker that blocks.
+        //
+        int uncompensated = min(sample.NumBlocked - m_compensationThreads, sample.MaxThreads - newMax);
+        if (uncompensated > 0)
+        {
+            m_compensationThreads += uncompensated;
+            newMax += uncompensated;
+            reason = LatencyReason_BlockingCompensation;
+        }
+        else if (sample.QueueWaitMs >= m_targetQueueWaitMs && !IsCpuSaturated(sample))
+        {
+            //
+            // Inject in proportion to how far the wait is over the target.  Each injected
+            // thread that finds work injects the next one, so this ramps up quickly.
+            //
+            DWORD step = min(sample.QueueWaitMs / m_targetQueueWaitMs, (DWORD)m_maxInjectionPerSample);
+            newMax += (int)step;
+            reason = LatencyReason_QueueLatency;
+        }
+
+        if (newMax < floor)
+        {
+            newMax = floor;
+            reason = LatencyReason_BlockingCompensation;
+        }
+    }
+    else if (newMax > floor)
+    {
+        m_idleMs += sample.ElapsedMs;
+
+        if (m_idleMs >= m_retireDelayMs)
+        {
+            //
+            // Give back half of the threads that are neither running work nor needed to
+            // satisfy MinThreads, so that an idle pool shrinks within a few retire delays.
+            //
+            int excess = newMax - max(floor, sample.NumWorking);
+            if (excess > 0)
+            {
+                newMax -= max(excess / 2, 1);
+                reason = LatencyReason_IdleRetirement;
+            }
+            m_idleMs = 0;
+        }
+    }
+    else
+    {
+        m_idleMs = 0;
+    }
+
+    newMax = max(min(newMax, sample.MaxThreads), sample.MinThreads);
+
+    *pReason = (newMax != sample.MaxWorking) ? reason : LatencyReason_None;
+    return newMax;
+}
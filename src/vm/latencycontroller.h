@@ -0,0 +1,79 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//=========================================================================
+
+//
+// LatencyController.h
+//
+// Defines the ThreadPool's queue latency aware concurrency controller, an
+// alternative to HillClimbing that is selected with
+// ThreadPool_UseLatencyController.
+//
+// HillClimbing only looks at throughput and needs several seconds of samples
+// before it moves. This controller instead reacts to how long requests have
+// been waiting for a worker and to workers reported as blocked, so that it
+// can add threads within a sample interval of a burst of blocking work and
+// give them back once the burst is over.
+//
+// The controller has no dependencies on the rest of the VM so that it can be
+// driven by the simulation harness in src/tools/threadpoolsim.
+//
+
+//=========================================================================
+
+#ifndef _LATENCYCONTROLLER_H
+#define _LATENCYCONTROLLER_H
+
+enum LatencyControllerReason
+{
+    LatencyReason_None,
+    LatencyReason_QueueLatency,         // requests waited longer than the target
+    LatencyReason_BlockingCompensation, // workers blocked, or came back from blocking
+    LatencyReason_IdleRetirement,       // the pool has been idle for the retire delay
+};
+
+struct LatencyControllerSettings
+{
+    DWORD TargetQueueWaitMs;    // queue wait above which threads are injected
+    DWORD RetireDelayMs;        // idle time after which excess threads are retired
+    int MaxInjectionPerSample;  // upper bound on threads injected by one sample
+    int NumProcessors;          // processors available to the pool
+    int CpuUtilizationHigh;     // CPU utilization (percent) at which more threads will not help
+};
+
+struct LatencyControllerSample
+{
+    int MaxWorking;         // current worker thread limit
+    int NumActive;          // worker threads that are not retired
+    int NumWorking;         // worker threads that are running or looking for work
+    int NumBlocked;         // worker threads in a reported blocking wait
+    int MinThreads;         // SetMinThreads limit
+    int MaxThreads;         // SetMaxThreads limit
+    bool RequestsPending;   // whether any work requests are waiting for a worker
+    DWORD QueueWaitMs;      // how long requests have been waiting with every worker busy
+    DWORD ElapsedMs;        // time since the previous sample
+    int CpuUtilization;     // recent CPU utilization in percent, 0 if not known yet
+};
+
+class LatencyController
+{
+private:
+    DWORD m_targetQueueWaitMs;
+    DWORD m_retireDelayMs;
+    int m_maxInjectionPerSample;
+    int m_numProcessors;
+    int m_cpuUtilizationHigh;
+
+    DWORD m_idleMs;             // time the pool has had no pending requests
+    int m_compensationThreads;  // threads injected on behalf of blocked workers
+
+    bool IsCpuSaturated(const LatencyControllerSample& sample);
+
+public:
+    void Initialize(const LatencyControllerSettings& settings);
+    int Update(const LatencyControllerSample& sample, LatencyControllerReason* pReason);
+};
+
+#endif
@@ -3515,6 +3515,30 @@ public:
         else
             return NULL;
     }
+
+    // Replace the dictionary layout with an expanded one
+    void IMD_SetDictionaryLayout(DictionaryLayout* pNewLayout)
+    {
+        WRAPPER_NO_CONTRACT;
+        if (IMD_IsWrapperStubWithInstantiations() && IMD_HasMethodInstantiation())
+        {
+            InstantiatedMethodDesc* pIMD = IMD_GetWrappedMethodDesc()->AsInstantiatedMethodDesc();
+            EnsureWritablePages(&pIMD->m_pDictLayout)->SetValueMaybeNull(pNewLayout);
+        }
+        else
+        {
+            _ASSERTE(IMD_IsSharedByGenericMethodInstantiations());
+            EnsureWritablePages(&m_pDictLayout)->SetValueMaybeNull(pNewLayout);
+        }
+    }
+
+    // Replace the dictionary with an expanded copy
+    void IMD_SetMethodDictionary(Dictionary* pNewDictionary)
+    {
+        WRAPPER_NO_CONTRACT;
+        _ASSERTE(IMD_HasMethodInstantiation());
+        EnsureWritablePages(&m_pPerInstInfo)->SetValueMaybeNull(pNewDictionary);
+    }
 #endif // !DACCESS_COMPILE
 
     // Setup the IMD as shared code
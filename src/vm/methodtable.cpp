@@ -9426,7 +9426,11 @@ MethodTable::EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
 
     if (GetDictionary() != NULL)
     {
-        DacEnumMemoryRegion(dac_cast<TADDR>(GetDictionary()), GetInstAndDictSize());
+        // Expanded dictionaries record their own size, which may differ from the current layout
+        DWORD cbDict = (GetClass()->GetDictionaryLayout() != NULL) ?
+            GetDictionary()->GetDictionarySlotsSize(GetNumGenericArgs()) :
+            GetInstAndDictSize();
+        DacEnumMemoryRegion(dac_cast<TADDR>(GetDictionary()), cbDict);
     }
 
     VtableIndirectionSlotIterator it = IterateVtableIndirectionSlots();
@@ -10086,7 +10086,13 @@ MethodTable * MethodTableBuilder::AllocateNewMT(Module *pLoaderModule,
         if (cbInstAndDict)
         {
             MethodTable::PerInstInfoElem_t *pPInstInfo = (MethodTable::PerInstInfoElem_t *)(pPerInstInfo + (dwNumDicts-1));
-            pPInstInfo->SetValueMaybeNull((Dictionary*) (pPerInstInfo + dwNumDicts));
+            Dictionary *pDict = (Dictionary*) (pPerInstInfo + dwNumDicts);
+            pPInstInfo->SetValueMaybeNull(pDict);
+
+            if (GetHalfBakedClass()->GetDictionaryLayout() != NULL)
+            {
+                pDict->SetDictionarySlotsSize(bmtGenerics->GetNumGenericArgs(), cbInstAndDict);
+            }
         }
     }
 
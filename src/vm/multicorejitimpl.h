@@ -51,6 +51,8 @@ const unsigned MODULE_MASK       = 0xFF;            //  8-bit dependent module i
 
 const int      MAX_WALKBACK      = 128;
 
+const unsigned MAX_PLAYER_WORKERS = 3;              // Maximum number of helper threads compiling along with the player thread
+
 enum
 {
     MULTICOREJIT_PROFILE_VERSION   = 101,
@@ -240,6 +242,18 @@ class PlayerModuleInfo;
 
 // MulticoreJitProfilePlayer manages background thread, playing back profile, storing result into code stoage, and gather statistics information
 
+class MulticoreJitProfilePlayer;
+
+// Helper thread compiling methods of a walk-back group along with the player thread
+
+struct PlayerWorker
+{
+    MulticoreJitProfilePlayer        * m_pPlayer;
+    Thread                           * m_pThread;
+    MulticoreJitPlayerStat             m_stats;         // Merged into the player statistics after each group
+};
+
+
 class MulticoreJitProfilePlayer
 {
 friend class MulticoreJitRecorder;
@@ -261,19 +275,45 @@ private:
     unsigned                           m_nMissingModule;
 
     int                                m_nLoadedModuleCount;
-    
-    unsigned                           m_busyWith;
 
     unsigned                           m_headerModuleCount;
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
+
+    PlayerWorker                       m_workers[MAX_PLAYER_WORKERS];
+    unsigned                           m_nWorkerCount;
+    LONG                               m_nRunningWorkers;  // Started helper threads, plus one for the player thread
+    Volatile<bool>                     m_fWorkersExit;
+    CLRSemaphore                       m_workerWake;       // Released once per helper thread needed for a group
+    CLREvent                           m_groupDone;        // Set by the helper thread finishing the last method of a group
+    CLREvent                           m_workersExited;    // Set by the last helper thread to exit
+
+    unsigned                         * m_pGroup;           // Current walk-back group
+    LONG                               m_nGroupNext;       // Methods left to claim in the group, claimed backwards
+    LONG                               m_nGroupPending;    // Methods not finished yet in the group
     
-    void JITMethod(Module * pModule, unsigned methodIndex);
+    void JITMethod(Module * pModule, unsigned methodIndex, MulticoreJitPlayerStat & stats);
+
+    void InitClassWithoutConstructor(MethodTable * pMT);
+
+    void JITMethodGroup(unsigned * pGroup, int run);
+
+    bool JITGroupMethods(MulticoreJitPlayerStat & stats);
+
+    void MergeWorkerStats();
+
+    void StartWorkers();
+
+    void StopWorkers();
+
+    void WorkerThreadProc(PlayerWorker * pWorker);
+
+    static DWORD WINAPI StaticWorkerThreadProc(void *args);
 
     HRESULT HandleModuleRecord(const ModuleRecord * pModule);
     HRESULT HandleMethodRecord(unsigned * buffer, int count);
 
-    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    bool CompileMethodDesc(Module * pModule, MethodDesc * pMD, MulticoreJitPlayerStat & stats);
 
     HRESULT PlayProfile();
 
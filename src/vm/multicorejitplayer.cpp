@@ -315,8 +315,6 @@ void PlayerModuleInfo::Dump(const wchar_t * prefix, int index)
 //
 ///////////////////////////////////////////////////////////////////////////////////
 
-const unsigned EmptyToken = 0xFFFFFFFF;
-
 bool ModuleRecord::MatchWithModule(ModuleVersion & modVersion, bool & gotVersion, Module * pModule, bool & shouldAbort, bool fAppx) const
 {
     STANDARD_VM_CONTRACT;
@@ -384,8 +382,13 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(ICLRPrivBinder * pBinderCon
     m_pThread            = NULL;
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
-    
-    m_busyWith           = EmptyToken;
+
+    m_nWorkerCount       = 0;
+    m_nRunningWorkers    = 1;
+    m_fWorkersExit       = false;
+    m_pGroup             = NULL;
+    m_nGroupNext         = 0;
+    m_nGroupPending      = 0;
 
     m_nStartTime         = GetTickCount();
 }
@@ -523,7 +526,7 @@ public:
 
 // Call JIT to compile a method
 
-bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD)
+bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc * pMD, MulticoreJitPlayerStat & stats)
 {
     STANDARD_VM_CONTRACT;
     
@@ -538,7 +541,7 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
             MulticoreJitTrace(("First call to MakeJitWorker"));
         }
 
-        m_stats.m_nTryCompiling ++;
+        stats.m_nTryCompiling ++;
 
         // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
         ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
@@ -554,8 +557,21 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
 }
 
 
+// Run class initialization ahead of the application for types without a static constructor. It only allocates the statics,
+// so no managed code runs on the background thread, and the application thread finds the class already initialized.
+void MulticoreJitProfilePlayer::InitClassWithoutConstructor(MethodTable * pMT)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (pMT->IsFullyLoaded() && ! pMT->HasClassConstructor() && ! pMT->IsClassInited())
+    {
+        pMT->CheckRunClassInitThrowing();
+    }
+}
+
+
 // Conditional JIT of a method
-void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex)
+void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex, MulticoreJitPlayerStat & stats)
 {
     STANDARD_VM_CONTRACT;
     
@@ -592,19 +608,17 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
             pModule = pMethod->GetModule_NoLogging();
         }
 
+        InitClassWithoutConstructor(pMethod->GetMethodTable());
+
         if (pMethod->GetNativeCode() != NULL) // last check before
         {
-            m_stats.m_nHasNativeCode ++;
+            stats.m_nHasNativeCode ++;
 
             return;
         }
         else
         {                    
-            m_busyWith = methodIndex;
-
-            bool rslt = CompileMethodDesc(pModule, pMethod);
-
-            m_busyWith = EmptyToken;
+            bool rslt = CompileMethodDesc(pModule, pMethod, stats);
 
             if (rslt)
             {
@@ -615,7 +629,7 @@ void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex
     
 BadMethod:
 
-    m_stats.m_nFilteredMethods ++;
+    stats.m_nFilteredMethods ++;
         
     MulticoreJitTrace(("Filtered out methods: pModule:[%s] token:[%x]", pModule->GetSimpleName(), token));
 
@@ -964,6 +978,105 @@ inline bool MethodJifInfo(unsigned inst)
 }
 
 
+// Compile methods of the current group until there is none left to claim
+// Return true if this thread finished the last method of the group
+bool MulticoreJitProfilePlayer::JITGroupMethods(MulticoreJitPlayerStat & stats)
+{
+    STANDARD_VM_CONTRACT;
+
+    bool finishedGroup = false;
+
+    while (true)
+    {
+        LONG index = InterlockedDecrement(& m_nGroupNext);
+
+        if (index < 0)
+        {
+            break;
+        }
+
+        unsigned inst = m_pGroup[index];
+
+        _ASSERTE(MethodJifInfo(inst));
+
+        PlayerModuleInfo & mod = m_pModules[inst >> 24];
+
+        _ASSERTE(mod.IsModuleLoaded());
+
+        // Failing to compile one method should not leave the other threads waiting for the group
+        EX_TRY
+        {
+            if (mod.m_enableJit)
+            {
+                JITMethod(mod.m_pModule, inst, stats);
+            }
+            else
+            {
+                stats.m_nFilteredMethods ++;
+            }
+        }
+        EX_CATCH
+        {
+            stats.m_nFilteredMethods ++;
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        if (InterlockedDecrement(& m_nGroupPending) == 0)
+        {
+            finishedGroup = true;
+        }
+    }
+
+    return finishedGroup;
+}
+
+
+// JIT a group of methods not broken apart by dependency, sharing the work with helper threads
+void MulticoreJitProfilePlayer::JITMethodGroup(unsigned * pGroup, int run)
+{
+    STANDARD_VM_CONTRACT;
+
+    m_pGroup        = pGroup;
+    m_nGroupPending = run;
+
+    // Publishing the claim count makes the group visible to helper threads woken up for an earlier group
+    VolatileStore(& m_nGroupNext, (LONG) run);
+
+    LONG helpers = min((LONG) m_nWorkerCount, (LONG) run - 1);
+
+    if (helpers > 0)
+    {
+        m_workerWake.Release(helpers, NULL);
+    }
+
+    if (! JITGroupMethods(m_stats))
+    {
+        // A helper thread is still compiling the last methods of the group
+        m_groupDone.Wait(INFINITE, FALSE);
+    }
+
+    MergeWorkerStats();
+}
+
+
+// Helper threads are idle between groups, so their counters can be folded into the player statistics
+void MulticoreJitProfilePlayer::MergeWorkerStats()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (unsigned i = 0; i < m_nWorkerCount; i ++)
+    {
+        MulticoreJitPlayerStat & stats = m_workers[i].m_stats;
+
+        m_stats.m_nHasNativeCode   += stats.m_nHasNativeCode;
+        m_stats.m_nTryCompiling    += stats.m_nTryCompiling;
+        m_stats.m_nFilteredMethods += stats.m_nFilteredMethods;
+
+        stats.Clear();
+    }
+}
+
+
 // Process a block of methodDef, call JIT if not blocked
 HRESULT MulticoreJitProfilePlayer::HandleMethodRecord(unsigned * buffer, int count)
 {
@@ -1035,25 +1148,7 @@ HRESULT MulticoreJitProfilePlayer::HandleMethodRecord(unsigned * buffer, int cou
                         }
 
                         // Walk backwards within the same group, may be from different modules
-                        for (int p = pos + run - 1; p >= pos; p --)
-                        {
-                            unsigned inst = buffer[p];
-
-                            _ASSERTE(MethodJifInfo(inst));
-
-                            PlayerModuleInfo & mod = m_pModules[inst >> 24];
-
-                            _ASSERTE(mod.IsModuleLoaded());
-
-                            if (mod.m_enableJit)
-                            {
-                                JITMethod(mod.m_pModule, inst);
-                            }
-                            else
-                            {
-                                m_stats.m_nFilteredMethods ++;
-                            }
-                        }
+                        JITMethodGroup(buffer + pos, run);
 
                         m_stats.m_nWalkBack    += (short) (run - 1);
                         m_stats.m_nTotalMethod += (short) (run - 1);
@@ -1241,6 +1336,8 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         nSize,
         GetAppDomain()->GetFriendlyNameForLogging()));
 
+    StartWorkers();
+
     while ((SUCCEEDED(hr)) && (nSize > sizeof(unsigned)))
     {
         unsigned data   = * (const unsigned *) pBuffer;
@@ -1335,10 +1432,190 @@ HRESULT MulticoreJitProfilePlayer::JITThreadProc(Thread * pThread)
     }
     EX_END_CATCH(SwallowAllExceptions);
 
+    {
+        GCX_PREEMP();
+
+        // Helper threads reference the player, they need to be gone before it's deleted
+        StopWorkers();
+    }
+
     return (DWORD) m_stats.m_hr;
 }
 
 
+// Start helper threads to share the JIT work of walk-back groups with the player thread
+void MulticoreJitProfilePlayer::StartWorkers()
+{
+    STANDARD_VM_CONTRACT;
+
+    DWORD threadCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPlayerThreadCount);
+
+    if (threadCount == 0)
+    {
+        // Leave half of the processors to the application, which is busy starting up
+        threadCount = g_SystemInfo.dwNumberOfProcessors / 2;
+    }
+
+    unsigned workerCount = min(threadCount, MAX_PLAYER_WORKERS + 1);
+
+    if (workerCount <= 1)
+    {
+        return;
+    }
+
+    workerCount --; // The player thread compiles too
+
+    m_workerWake.Create(0, MAXLONG);
+    m_groupDone.CreateAutoEvent(FALSE);
+    m_workersExited.CreateManualEvent(FALSE);
+
+    for (unsigned i = 0; i < workerCount; i ++)
+    {
+        PlayerWorker & worker = m_workers[m_nWorkerCount];
+
+        worker.m_pPlayer = this;
+        worker.m_pThread = SetupUnstartedThread();
+        worker.m_stats.Clear();
+
+        if (! worker.m_pThread->CreateNewThread(0, StaticWorkerThreadProc, & worker))
+        {
+            worker.m_pThread->DecExternalCount(FALSE);
+            break;
+        }
+
+        InterlockedIncrement(& m_nRunningWorkers);
+
+        if ((int) worker.m_pThread->StartThread() <= 0)
+        {
+            InterlockedDecrement(& m_nRunningWorkers);
+            break;
+        }
+
+        m_nWorkerCount ++;
+    }
+
+    MulticoreJitTrace(("Started %d helper threads", m_nWorkerCount));
+}
+
+
+// Wait for all helper threads to exit
+void MulticoreJitProfilePlayer::StopWorkers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    m_fWorkersExit = true;
+
+    if (m_nWorkerCount != 0)
+    {
+        m_workerWake.Release(m_nWorkerCount, NULL);
+    }
+
+    // Drop the reference of the player thread, the last thread to leave signals the event
+    if (InterlockedDecrement(& m_nRunningWorkers) != 0)
+    {
+        m_workersExited.Wait(INFINITE, FALSE);
+    }
+}
+
+
+void MulticoreJitProfilePlayer::WorkerThreadProc(PlayerWorker * pWorker)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    Thread * pThread = pWorker->m_pThread;
+
+    {
+        // 1 marks background thread
+        FireEtwThreadCreated((ULONGLONG) pThread, (ULONGLONG) GetAppDomain(), 1, pThread->GetThreadId(), pThread->GetOSThreadId(), GetClrInstanceId());
+    }
+
+    EX_TRY
+    {
+        GCX_PREEMP();
+
+        while (true)
+        {
+            m_workerWake.Wait(INFINITE, FALSE);
+
+            if (m_fWorkersExit)
+            {
+                break;
+            }
+
+            if (JITGroupMethods(pWorker->m_stats))
+            {
+                m_groupDone.Set();
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    {
+        FireEtwThreadTerminated((ULONGLONG) pThread, (ULONGLONG) GetAppDomain(), GetClrInstanceId());
+    }
+}
+
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticWorkerThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    BEGIN_ENTRYPOINT_NOTHROW;
+
+    PlayerWorker * pWorker = (PlayerWorker *) args;
+
+    MulticoreJitProfilePlayer * pPlayer = pWorker->m_pPlayer;
+
+    Thread * pThread = pWorker->m_pThread;
+
+    if (pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        pPlayer->WorkerThreadProc(pWorker);
+    }
+
+    DestroyThread(pThread);
+
+    // The player may be deleted as soon as the last helper thread leaves, so this must be the last access to it
+    if (InterlockedDecrement(& pPlayer->m_nRunningWorkers) == 0)
+    {
+        pPlayer->m_workersExited.Set();
+    }
+
+    END_ENTRYPOINT_NOTHROW;
+
+    return 0;
+}
+
+
 DWORD WINAPI MulticoreJitProfilePlayer::StaticJITThreadProc(void *args)
 {
     CONTRACTL
@@ -100,6 +100,11 @@
 //  1) Any hash modifications are performed under a lock or otherwise serialized.
 //  2) Any miss on a lookup is handled by taking a lock are retry-ing the lookup.
 //
+// A lookup of the first entry matching a given hash (BaseFindFirstEntryByHash) never misses an entry that
+// was inserted before the lookup started, even if the warm bucket list is being grown concurrently. Only
+// enumeration of further matches via BaseFindNextEntryByHash can (very rarely) miss an entry during a
+// concurrent grow, which is why the retry in (2) is still required.
+//
 // OVERALL DESIGN
 //
 // The hash contains up to three groups of hash entries. These consist of two groups of entries persisted to
@@ -118,6 +123,15 @@
 //
 // Separate bucket lists and entry arrays are stored for hot and cold entries.
 //
+// The warm entries are held in a conventional bucket list of singly linked chains. Each warm bucket array is
+// preceded by two special slots: the bucket count of the array (so that readers always see an array and
+// count that agree) and a pointer to the array that replaced it when the table was last grown (NULL for the
+// current array). Growing the table allocates a new array, links it from the old one and then moves entries
+// over one at a time starting from the tail of each old chain. An entry is always linked into the new array
+// before it is unlinked from the old one, so a reader that misses in one array and then follows the link to
+// the next is guaranteed to find any entry that was present before it started. Old arrays are never freed
+// (they live on the loader heap).
+//
 // The live entries (referred to here as volatile or warm entries) follow a more traditional hash
 // implementation where entries are allocated individually from a loader heap and are chained together with a
 // singly linked list if they collide. Here the bucket list is a simple array of pointers to the first entry
@@ -451,6 +465,26 @@ private:
         return ReadPointer(this, &NgenHashTable<NGEN_HASH_ARGS>::m_pWarmBuckets);
     }
 
+    // Every warm bucket array is preceded by these special slots (see OVERALL DESIGN above). m_pWarmBuckets
+    // always points at bucket zero, past the special slots.
+    static const int SLOT_NEXT_BUCKETS = -2;    // Array that superseded this one on a grow (or NULL)
+    static const int SLOT_BUCKET_COUNT = -1;    // Number of buckets in this array
+    static const int SKIP_SPECIAL_SLOTS = 2;
+
+    static DWORD GetWarmBucketCount(DPTR(PTR_VolatileEntry) pBuckets)
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+
+        return (DWORD)dac_cast<TADDR>(pBuckets[SLOT_BUCKET_COUNT]);
+    }
+
+    static DPTR(PTR_VolatileEntry) GetNextWarmBuckets(DPTR(PTR_VolatileEntry) pBuckets)
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+
+        return dac_cast<DPTR(PTR_VolatileEntry)>(dac_cast<TADDR>(pBuckets[SLOT_NEXT_BUCKETS]));
+    }
+
 #ifdef FEATURE_PREJIT
     APTR_PersistedEntry GetPersistedHotEntries()
     {
@@ -534,7 +568,9 @@ private:
 
     // Fields related to the runtime (volatile or warm) part of the hash.
     RelativePointer<DPTR(PTR_VolatileEntry)> m_pWarmBuckets;  // Pointer to a simple bucket list (array of VolatileEntry pointers)
-    DWORD                                    m_cWarmBuckets;  // Count of buckets in the above array (always non-zero)
+    DWORD                                    m_cWarmBuckets;  // Count of buckets in the above array (always non-zero).
+                                                              // Lock-free readers use the count stored with the
+                                                              // array instead (see GetWarmBucketCount).
     DWORD                                    m_cWarmEntries;  // Count of elements in the warm section of the hash
 
 #ifdef FEATURE_PREJIT
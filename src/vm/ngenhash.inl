@@ -51,13 +51,16 @@ NgenHashTable<NGEN_HASH_ARGS>::NgenHashTable(Module *pModule, LoaderHeap *pHeap,
     m_pModule.SetValueMaybeNull(pModule);
     m_pHeap = pHeap;
 
-    S_SIZE_T cbBuckets = S_SIZE_T(sizeof(VolatileEntry*)) * S_SIZE_T(cInitialBuckets);
+    S_SIZE_T cbBuckets = S_SIZE_T(sizeof(VolatileEntry*)) * (S_SIZE_T(cInitialBuckets) + S_SIZE_T(SKIP_SPECIAL_SLOTS));
+
+    PTR_VolatileEntry *pBuckets = (PTR_VolatileEntry*)(void*)GetHeap()->AllocMem(cbBuckets) + SKIP_SPECIAL_SLOTS;
+    pBuckets[SLOT_BUCKET_COUNT] = (PTR_VolatileEntry)(TADDR)cInitialBuckets;
 
     m_cWarmEntries = 0;
     m_cWarmBuckets = cInitialBuckets;
-    m_pWarmBuckets.SetValue((PTR_VolatileEntry*)(void*)GetHeap()->AllocMem(cbBuckets));
+    m_pWarmBuckets.SetValue(pBuckets);
 
-    // Note: Memory allocated on loader heap is zero filled
+    // Note: Memory allocated on loader heap is zero filled (this also leaves SLOT_NEXT_BUCKETS NULL)
     // memset(m_pWarmBuckets, 0, sizeof(VolatileEntry*) * cInitialBuckets);
 
 #ifdef FEATURE_PREJIT
@@ -83,7 +86,8 @@ VALUE *NgenHashTable<NGEN_HASH_ARGS>::BaseAllocateEntry(AllocMemTracker *pamTrac
 
     // Faults are forbidden in BaseInsertEntry. Make the table writeable now that the faults are still allowed.
     EnsureWritablePages(this);
-    EnsureWritablePages(this->GetWarmBuckets(), m_cWarmBuckets * sizeof(PTR_VolatileEntry));
+    EnsureWritablePages(this->GetWarmBuckets() - SKIP_SPECIAL_SLOTS,
+                        (m_cWarmBuckets + SKIP_SPECIAL_SLOTS) * sizeof(PTR_VolatileEntry));
 
     TaggedMemAllocPtr pMemory = GetHeap()->AllocMem(S_SIZE_T(sizeof(VolatileEntry)));
 
@@ -188,54 +192,62 @@ void NgenHashTable<NGEN_HASH_ARGS>::GrowTable()
     // error to our caller.
     FAULT_NOT_FATAL();
 
+    PTR_VolatileEntry *pOldBuckets = GetWarmBuckets();
+    DWORD cOldBuckets = m_cWarmBuckets;
+    _ASSERTE(GetWarmBucketCount(pOldBuckets) == cOldBuckets);
+
     // Make the new bucket table larger by the scale factor requested by the subclass (but also prime).
-    DWORD cNewBuckets = NextLargestPrime(m_cWarmBuckets * SCALE_FACTOR);
-    S_SIZE_T cbNewBuckets = S_SIZE_T(cNewBuckets) * S_SIZE_T(sizeof(PTR_VolatileEntry));
+    DWORD cNewBuckets = NextLargestPrime(cOldBuckets * SCALE_FACTOR);
+    S_SIZE_T cbNewBuckets = (S_SIZE_T(cNewBuckets) + S_SIZE_T(SKIP_SPECIAL_SLOTS)) * S_SIZE_T(sizeof(PTR_VolatileEntry));
     PTR_VolatileEntry *pNewBuckets = (PTR_VolatileEntry*)(void*)GetHeap()->AllocMem_NoThrow(cbNewBuckets);
     if (!pNewBuckets)
         return;
+    pNewBuckets += SKIP_SPECIAL_SLOTS;
 
-    // All buckets are initially empty.
+    // All buckets are initially empty and the new array has no successor.
     // Note: Memory allocated on loader heap is zero filled
     // memset(pNewBuckets, 0, cNewBuckets * sizeof(PTR_VolatileEntry));
-
-    // Run through the old table and transfer all the entries. Be sure not to mess with the integrity of the
-    // old table while we are doing this, as there can be concurrent readers! Note that it is OK if the
-    // concurrent reader misses out on a match, though - they will have to acquire the lock on a miss & try
-    // again.
-    for (DWORD i = 0; i < m_cWarmBuckets; i++)
+    pNewBuckets[SLOT_BUCKET_COUNT] = (PTR_VolatileEntry)(TADDR)cNewBuckets;
+
+    // Link the new array from the old one before moving any entries. From here on a reader that misses in
+    // the old array will go on to search the new one, so an entry is never out of sight of a reader as long
+    // as it is linked into the new array before it's unlinked from the old one.
+    VolatileStore(&pOldBuckets[SLOT_NEXT_BUCKETS], (PTR_VolatileEntry)(TADDR)pNewBuckets);
+
+    // Run through the old table and transfer all the entries, always taking the last entry of each old chain.
+    // Moving the tail means the only link that changes in the old chain is the one pointing at the entry being
+    // moved, so concurrent readers in the middle of an old chain still see every entry ahead of them. A
+    // reader that is sitting on the moved entry itself continues into the new bucket's chain, which is
+    // harmless since lookups compare the hash of every entry they visit.
+    for (DWORD i = 0; i < cOldBuckets; i++)
     {
-        PTR_VolatileEntry pEntry = (GetWarmBuckets())[i];
-
-        // Try to lock out readers from scanning this bucket. This is obviously a race which may fail.
-        // However, note that it's OK if somebody is already in the list - it's OK if we mess with the bucket
-        // groups, as long as we don't destroy anything. The lookup function will still do appropriate
-        // comparison even if it wanders aimlessly amongst entries while we are rearranging things. If a
-        // lookup finds a match under those circumstances, great. If not, they will have to acquire the lock &
-        // try again anyway.
-        (GetWarmBuckets())[i] = NULL;
-
-        while (pEntry != NULL)
+        PTR_VolatileEntry *ppTail = &pOldBuckets[i];
+        while (*ppTail != NULL)
         {
+            // Find the last link in the chain.
+            ppTail = &pOldBuckets[i];
+            while ((*ppTail)->m_pNextEntry != NULL)
+                ppTail = &(*ppTail)->m_pNextEntry;
+
+            PTR_VolatileEntry pEntry = *ppTail;
             DWORD dwNewBucket = pEntry->m_iHashValue % cNewBuckets;
-            PTR_VolatileEntry pNextEntry  = pEntry->m_pNextEntry;
 
-            pEntry->m_pNextEntry = pNewBuckets[dwNewBucket];
-            pNewBuckets[dwNewBucket] = pEntry;
+            // Publish the entry at the head of its new bucket...
+            VolatileStore(&pEntry->m_pNextEntry, pNewBuckets[dwNewBucket]);
+            VolatileStore(&pNewBuckets[dwNewBucket], pEntry);
+
+            // ...and only then drop it from the old chain.
+            VolatileStore(ppTail, (PTR_VolatileEntry)NULL);
 
-            pEntry = pNextEntry;
+            ppTail = &pOldBuckets[i];
         }
     }
 
-    // Make sure that all writes are visible before publishing the new array.
+    // Publish the new array. Readers that still pick up the old array will find it empty and follow the
+    // SLOT_NEXT_BUCKETS link. Lock-free readers take the bucket count from the array itself, so the order in
+    // which m_cWarmBuckets becomes visible doesn't matter to them.
     MemoryBarrier();
     m_pWarmBuckets.SetValue(pNewBuckets);
-
-    // The new number of buckets has to be published last (prior to this readers may miscalculate a bucket
-    // index, but the result will always be in range and they'll simply walk the wrong chain and get a miss,
-    // prompting a retry under the lock). If we let the count become visible unordered wrt to the bucket array
-    // itself a reader could potentially read buckets from beyond the end of the old bucket list).
-    MemoryBarrier();
     m_cWarmBuckets = cNewBuckets;
 }
 
@@ -997,9 +1009,10 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseSave(DataImage *pImage, CorProfileData *
     _ASSERTE(m_cWarmBuckets >= m_cInitialBuckets);
     DWORD cNewWarmBuckets = min(m_cInitialBuckets, 11);
 
-    // Create the ngen version of the warm buckets.
-    pImage->StoreStructure(GetWarmBuckets(),
-                           cNewWarmBuckets * sizeof(VolatileEntry*),
+    // Create the ngen version of the warm buckets (including the special slots that precede them).
+    PTR_VolatileEntry *pWarmBucketsStart = GetWarmBuckets() - SKIP_SPECIAL_SLOTS;
+    pImage->StoreStructure(pWarmBucketsStart,
+                           (cNewWarmBuckets + SKIP_SPECIAL_SLOTS) * sizeof(VolatileEntry*),
                            DataImage::ITEM_NGEN_HASH_HOT);
 
     // Reset the ngen-version of the table to have no warm entries and the reduced warm bucket count.
@@ -1007,9 +1020,11 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseSave(DataImage *pImage, CorProfileData *
     pNewTable->m_cWarmEntries = 0;
     pNewTable->m_cWarmBuckets = cNewWarmBuckets;
 
-    // Zero-out the ngen version of the warm buckets.
-    VolatileEntry *pNewBuckets = (VolatileEntry*)pImage->GetImagePointer(GetWarmBuckets());
-    memset(pNewBuckets, 0, cNewWarmBuckets * sizeof(VolatileEntry*));
+    // Zero-out the ngen version of the warm buckets (which also clears any link to a newer bucket array) and
+    // record the reduced bucket count alongside them.
+    PTR_VolatileEntry *pNewBuckets = (PTR_VolatileEntry*)pImage->GetImagePointer(pWarmBucketsStart);
+    memset(pNewBuckets, 0, (cNewWarmBuckets + SKIP_SPECIAL_SLOTS) * sizeof(VolatileEntry*));
+    pNewBuckets[SKIP_SPECIAL_SLOTS + SLOT_BUCKET_COUNT] = (PTR_VolatileEntry)(TADDR)cNewWarmBuckets;
 }
 
 #ifdef _MSC_VER
@@ -1049,8 +1064,13 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseFixup(DataImage *pImage)
                              GetPersistedColdEntries(),
                              i * sizeof(PersistedEntry));
 
-    // Fixup the warm (empty) bucket list.
-    pImage->FixupRelativePointerField(this, offsetof(NgenHashTable<NGEN_HASH_ARGS>, m_pWarmBuckets));
+    // Fixup the warm (empty) bucket list. The saved structure starts at the special slots but the field
+    // points past them at the first bucket.
+    pImage->FixupField(this,
+                       offsetof(NgenHashTable<NGEN_HASH_ARGS>, m_pWarmBuckets),
+                       GetWarmBuckets() - SKIP_SPECIAL_SLOTS,
+                       SKIP_SPECIAL_SLOTS * sizeof(PTR_VolatileEntry),
+                       IMAGE_REL_BASED_RELPTR);
 
     // Fixup the hot entry array and bucket list.
     pImage->FixupRelativePointerField(this, offsetof(NgenHashTable<NGEN_HASH_ARGS>, m_sHotEntries) + offsetof(PersistedEntries, m_pEntries));
@@ -1076,8 +1096,9 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseEnumMemoryRegions(CLRDataEnumMemoryFlags
     // sub-class).
     DacEnumMemoryRegion(dac_cast<TADDR>(this), sizeof(FINAL_CLASS));
 
-    // Save the warm bucket list.
-    DacEnumMemoryRegion(dac_cast<TADDR>(GetWarmBuckets()), m_cWarmBuckets * sizeof(VolatileEntry*));
+    // Save the warm bucket list (along with the special slots that precede it).
+    DacEnumMemoryRegion(dac_cast<TADDR>(GetWarmBuckets()) - SKIP_SPECIAL_SLOTS * sizeof(VolatileEntry*),
+                        (m_cWarmBuckets + SKIP_SPECIAL_SLOTS) * sizeof(VolatileEntry*));
 
     // Save all the warm entries.
     if (GetWarmBuckets().IsValid())
@@ -1260,30 +1281,44 @@ DPTR(VALUE) NgenHashTable<NGEN_HASH_ARGS>::FindVolatileEntryByHash(NgenHashValue
     if (m_cWarmEntries == 0)
         return NULL;
 
-    // Since there is at least one entry there must be at least one bucket.
-    _ASSERTE(m_cWarmBuckets > 0);
+    // Search the current bucket array first. If the table is being grown concurrently some entries may have
+    // already moved on to a newer array, in which case we follow the SLOT_NEXT_BUCKETS links until we run out
+    // of arrays (see OVERALL DESIGN in ngenhash.h).
+    DPTR(PTR_VolatileEntry) pBuckets = GetWarmBuckets();
+    while (pBuckets)
+    {
+        // Use the bucket count stored alongside this particular array (m_cWarmBuckets may describe a
+        // different one). Since there is at least one entry there must be at least one bucket.
+        DWORD cBuckets = GetWarmBucketCount(pBuckets);
+        _ASSERTE(cBuckets > 0);
 
-    // Point at the first entry in the bucket chain which would contain any entries with the given hash code.
-    PTR_VolatileEntry pEntry = (GetWarmBuckets())[iHash % m_cWarmBuckets];
+        // Point at the first entry in the bucket chain which would contain any entries with the given hash
+        // code.
+        PTR_VolatileEntry pEntry = VolatileLoad(&pBuckets[iHash % cBuckets]);
 
-    // Walk the bucket chain one entry at a time.
-    while (pEntry)
-    {
-        if (pEntry->m_iHashValue == iHash)
+        // Walk the bucket chain one entry at a time.
+        while (pEntry)
         {
-            // We've found our match.
+            if (pEntry->m_iHashValue == iHash)
+            {
+                // We've found our match.
 
-            // Record our current search state into the provided context so that a subsequent call to
-            // BaseFindNextEntryByHash can pick up the search where it left off.
-            pContext->m_pEntry = dac_cast<TADDR>(pEntry);
-            pContext->m_eType = Warm;
+                // Record our current search state into the provided context so that a subsequent call to
+                // BaseFindNextEntryByHash can pick up the search where it left off.
+                pContext->m_pEntry = dac_cast<TADDR>(pEntry);
+                pContext->m_eType = Warm;
 
-            // Return the address of the sub-classes' embedded entry structure.
-            return VALUE_FROM_VOLATILE_ENTRY(pEntry);
+                // Return the address of the sub-classes' embedded entry structure.
+                return VALUE_FROM_VOLATILE_ENTRY(pEntry);
+            }
+
+            // Move to the next entry in the chain.
+            pEntry = VolatileLoad(&pEntry->m_pNextEntry);
         }
 
-        // Move to the next entry in the chain.
-        pEntry = pEntry->m_pNextEntry;
+        // The chain loads above are ordered before this one, so if a grow removed an entry from under us we're
+        // guaranteed to see the link to the array it moved to.
+        pBuckets = GetNextWarmBuckets(pBuckets);
     }
 
     // If we get here then none of the entries in the target bucket matched the hash code and we have a miss
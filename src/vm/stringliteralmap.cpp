@@ -40,6 +40,13 @@
     will all come before destruction of the map, the hash table is safe for multiple readers,
     and we know the StringLiteralEntry so found 1) can't be destroyed because that table keeps
     an AddRef on it and 2) isn't internally modified once created.
+
+    Loader allocators that never unload don't record entries in their own StringLiteralMap.
+    Instead the entries they use are pinned: their refcount is parked in the overflowed state so
+    they can never be released, and they are added to the GlobalStringLiteralMap's pinned table.
+    Nothing is ever removed from that table, so it may also be looked up without the lock. This
+    keeps the common case (literals and String.Intern in a non-collectible context) lock free once
+    a string has been seen.
 */
     
 #define GLOBAL_STRING_TABLE_BUCKET_SIZE 128
@@ -159,14 +166,20 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // Try the lock free lookups first: our own table and then the pinned entries in the global map.
+    if (m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+        return ((StringLiteralEntry*)Data)->GetStringObject();
+
+    GlobalStringLiteralMap *pGlobalMap = SystemDomain::GetGlobalStringLiteralMap();
+    StringLiteralEntry *pPinnedEntry = pGlobalMap->GetPinnedStringLiteral(pStringData, dwHash);
+    if (pPinnedEntry != NULL)
+        return pPinnedEntry->GetStringObject();
+
     // Retrieve the string literal from the global string literal map.
-    CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
+    CrstHolder gch(&(pGlobalMap->m_HashTableCrstGlobal));
 
-    // TODO: We can be more efficient by checking our local hash table now to see if
-    // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-    // (Rather than waiting until after we look the string up in the global map) 
-    
-    StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound));
+    StringLiteralEntryHolder pEntry(pGlobalMap->GetStringLiteral(pStringData, dwHash, bAddIfNotFound));
 
     _ASSERTE(pEntry || !bAddIfNotFound);
 
@@ -191,12 +204,12 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
                 pEntry.Release(); //while we're still under lock
             }
         }
-#ifdef _DEBUG
         else
         {
+            // Hand our reference over to the global map so later lookups don't need the lock.
+            pGlobalMap->PinStringLiteralEntry(pEntry);
             LOG((LF_APPDOMAIN, LL_INFO10000, "Avoided adding String literal to appdomain map: size: %d bytes\n", pStringData->GetCharCount()));
         }
-#endif
         pEntry.SuppressRelease();
         STRINGREF *pStrObj = NULL;
         // Retrieve the string objectref from the string literal entry.
@@ -226,6 +239,8 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
     EEStringData StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(&StringData);
+    GlobalStringLiteralMap *pGlobalMap = SystemDomain::GetGlobalStringLiteralMap();
+    StringLiteralEntry *pPinnedEntry;
     if (m_StringToEntryHashTable->GetValue(&StringData, &Data, dwHash))
     {
         STRINGREF *pStrObj = NULL;
@@ -234,16 +249,16 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         return pStrObj;
 
     }
+    else if ((pPinnedEntry = pGlobalMap->GetPinnedStringLiteral(&StringData, dwHash)) != NULL)
+    {
+        return pPinnedEntry->GetStringObject();
+    }
     else
     {
-        CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
+        CrstHolder gch(&(pGlobalMap->m_HashTableCrstGlobal));
 
-        // TODO: We can be more efficient by checking our local hash table now to see if
-        // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-        // (Rather than waiting until after we look the string up in the global map) 
-        
         // Retrieve the string literal from the global string literal map.
-        StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetInternedString(pString, dwHash, bAddIfNotFound));
+        StringLiteralEntryHolder pEntry(pGlobalMap->GetInternedString(pString, dwHash, bAddIfNotFound));
 
         _ASSERTE(pEntry || !bAddIfNotFound);
 
@@ -272,6 +287,11 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
                     pEntry.Release(); // while we're under lock
                 }
             }
+            else
+            {
+                // Hand our reference over to the global map so later lookups don't need the lock.
+                pGlobalMap->PinStringLiteralEntry(pEntry);
+            }
             pEntry.SuppressRelease();
             // Retrieve the string objectref from the string literal entry.
             STRINGREF *pStrObj = NULL;
@@ -288,6 +308,7 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
 
 GlobalStringLiteralMap::GlobalStringLiteralMap()
 : m_StringToEntryHashTable(NULL)
+, m_PinnedStringToEntryHashTable(NULL)
 , m_MemoryPool(NULL)
 , m_HashTableCrstGlobal(CrstGlobalStrLiteralMap)
 , m_LargeHeapHandleTable(SystemDomain::System(), GLOBAL_STRING_TABLE_BUCKET_SIZE)
@@ -327,9 +348,11 @@ GlobalStringLiteralMap::~GlobalStringLiteralMap()
     {
         // if this isn't the real global table then it must be empty
         _ASSERTE(m_StringToEntryHashTable->IsEmpty());  
+        _ASSERTE(m_PinnedStringToEntryHashTable->IsEmpty());
 
-        // Delete the hash table first. The dtor of the hash table would clean up all the entries.
+        // Delete the hash tables first. The dtor of the hash table would clean up all the entries.
         delete m_StringToEntryHashTable;
+        delete m_PinnedStringToEntryHashTable;
         // Delete the pool later, since the dtor above would need it.
         delete m_MemoryPool;        
     }
@@ -357,9 +380,13 @@ void GlobalStringLiteralMap::Init()
 
     m_StringToEntryHashTable =  new EEUnicodeStringLiteralHashTable ();
 
+    m_PinnedStringToEntryHashTable = new EEUnicodeStringLiteralHashTable ();
+
     LockOwner lock = {&m_HashTableCrstGlobal, IsOwnerOfCrst};
     if (!m_StringToEntryHashTable->Init(INIT_NUM_GLOBAL_STRING_BUCKETS, &lock, m_MemoryPool))
         ThrowOutOfMemory();
+    if (!m_PinnedStringToEntryHashTable->Init(INIT_NUM_GLOBAL_STRING_BUCKETS, &lock, m_MemoryPool))
+        ThrowOutOfMemory();
 }
 
 StringLiteralEntry *GlobalStringLiteralMap::GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound)
@@ -428,6 +455,60 @@ StringLiteralEntry *GlobalStringLiteralMap::GetInternedString(STRINGREF *pString
     return pEntry;
 }
 
+StringLiteralEntry *GlobalStringLiteralMap::GetPinnedStringLiteral(EEStringData *pStringData, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(this));
+        PRECONDITION(CheckPointer(pStringData));
+    }
+    CONTRACTL_END;
+
+    HashDatum Data;
+
+    // No lock needed: entries are never removed from the pinned table and pinned entries are never
+    // released.
+    if (m_PinnedStringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        _ASSERTE(((StringLiteralEntry*)Data)->IsPinned());
+        return (StringLiteralEntry*)Data;
+    }
+
+    return NULL;
+}
+
+void GlobalStringLiteralMap::PinStringLiteralEntry(StringLiteralEntry *pEntry)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(this));
+        PRECONDITION(CheckPointer(pEntry));
+        PRECONDITION(m_HashTableCrstGlobal.OwnedByCurrentThread());
+    }
+    CONTRACTL_END;
+
+    // The entry may have been pinned already by another caller that raced with us to the lock (or its
+    // refcount may simply have overflowed, in which case it still needs to go into the pinned table).
+    HashDatum Data;
+    EEStringData StringData;
+    pEntry->GetStringData(&StringData);
+    if (m_PinnedStringToEntryHashTable->GetValue(&StringData, &Data))
+    {
+        _ASSERTE((StringLiteralEntry*)Data == pEntry);
+        return;
+    }
+
+    // Pin before publishing so a lock free reader never sees an entry that could still be released.
+    pEntry->Pin();
+    m_PinnedStringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
+}
+
 #ifdef LOGGING
 static void LogStringLiteral(__in_z const char* action, EEStringData *pStringData)
 {
@@ -77,6 +77,15 @@ public:
     // Method to explicitly intern a string object. Takes a precomputed hash (for perf).
     StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound);
 
+    // Lock free lookup of a pinned string literal (one that can never be released). Returns NULL if the
+    // string is not pinned, in which case the caller should fall back to the locked lookup above. The
+    // returned entry is not AddRef'd.
+    StringLiteralEntry *GetPinnedStringLiteral(EEStringData *pStringData, DWORD dwHash);
+
+    // Pin an entry retrieved above on behalf of a loader allocator that will never unload, making it
+    // visible to GetPinnedStringLiteral. Takes over the caller's reference.
+    void PinStringLiteralEntry(StringLiteralEntry *pEntry);
+
     // Method to calculate the hash
     DWORD GetHash(EEStringData* pData)
     {
@@ -104,7 +113,11 @@ private:
     // Hash tables that maps a Unicode string to a LiteralStringEntry.
     EEUnicodeStringLiteralHashTable    *m_StringToEntryHashTable;
 
-    // The memorypool for hash entries for this hash table.
+    // Subset of the above containing only pinned entries. Entries are never removed from this table so it
+    // can be read without taking the lock (writes still require m_HashTableCrstGlobal).
+    EEUnicodeStringLiteralHashTable    *m_PinnedStringToEntryHashTable;
+
+    // The memorypool for hash entries for both hash tables.
     MemoryPool                  *m_MemoryPool;
 
     // The hash table table critical section.  
@@ -153,7 +166,7 @@ public:
             NOTHROW;
             GC_NOTRIGGER;
             PRECONDITION(CheckPointer<void>(this));
-            PRECONDITION((LONG)VolatileLoad(&m_dwRefCount) > 0);            
+            PRECONDITION(VolatileLoad(&m_dwRefCount) != 0);
             PRECONDITION(SystemDomain::GetGlobalStringLiteralMapNoCreate()->m_HashTableCrstGlobal.OwnedByCurrentThread());            
         }
         CONTRACTL_END;
@@ -166,6 +179,32 @@ public:
 
         VolatileStore(&m_dwRefCount, VolatileLoad(&m_dwRefCount) + 1);
     }
+
+    // Keep the item alive forever (the same state as an overflowed refcount). Pinned entries are never
+    // released so they may be handed out without the lock.
+    void Pin()
+    {
+        CONTRACTL
+        {
+            NOTHROW;
+            GC_NOTRIGGER;
+            PRECONDITION(CheckPointer<void>(this));
+            PRECONDITION(VolatileLoad(&m_dwRefCount) != 0);
+            PRECONDITION(SystemDomain::GetGlobalStringLiteralMapNoCreate()->m_HashTableCrstGlobal.OwnedByCurrentThread());
+        }
+        CONTRACTL_END;
+
+        _ASSERTE (!m_bDeleted);
+
+        VolatileStore(&m_dwRefCount, (DWORD)PINNED_REF_COUNT);
+    }
+
+    BOOL IsPinned()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        return (LONG)VolatileLoad(&m_dwRefCount) < 0;
+    }
 #ifndef DACCESS_COMPILE
     FORCEINLINE static void StaticRelease(StringLiteralEntry* pEntry)
     {        
@@ -264,6 +303,8 @@ public:
     static void DeleteEntry (StringLiteralEntry *pEntry);
 
 private:
+    static const DWORD PINNED_REF_COUNT = 0x80000000;
+
     STRINGREF*                  m_pStringObj;
     union
     {
@@ -37,6 +37,10 @@
 // Allocate 4K worth. Typically enough
 #define MAXSYNCBLOCK (0x1000-sizeof(void*))/sizeof(SyncBlock)
 #define SYNC_TABLE_INITIAL_SIZE 250
+// The initial sync table size is scaled by the processor count up to this many processors
+#define SYNC_TABLE_INITIAL_SCALE_LIMIT 16
+// Number of free sync blocks moved to a thread's own free list at a time
+#define SYNC_BLOCK_THREAD_BATCH 8
 
 //#define DUMP_SB
 
@@ -658,13 +662,17 @@ void SyncBlockCache::Start()
     }
     CONTRACTL_END;
 
-    DWORD* bm = new DWORD [BitMapSize(SYNC_TABLE_INITIAL_SIZE+1)];
+    // Every Grow copies the whole table under the cache lock, so start out bigger on machines where
+    // many threads are likely to be inflating locks at the same time.
+    DWORD initialSize = SYNC_TABLE_INITIAL_SIZE * min(max((DWORD)GetCurrentProcessCpuCount(), (DWORD)1), (DWORD)SYNC_TABLE_INITIAL_SCALE_LIMIT);
 
-    memset (bm, 0, BitMapSize (SYNC_TABLE_INITIAL_SIZE+1)*sizeof(DWORD));
+    DWORD* bm = new DWORD [BitMapSize(initialSize+1)];
 
-    SyncTableEntry::GetSyncTableEntryByRef() = new SyncTableEntry[SYNC_TABLE_INITIAL_SIZE+1];
+    memset (bm, 0, BitMapSize (initialSize+1)*sizeof(DWORD));
+
+    SyncTableEntry::GetSyncTableEntryByRef() = new SyncTableEntry[initialSize+1];
 #ifdef _DEBUG
-    for (int i=0; i<SYNC_TABLE_INITIAL_SIZE+1; i++) {
+    for (DWORD i=0; i<initialSize+1; i++) {
         SyncTableEntry::GetSyncTableEntry()[i].m_SyncBlock = NULL;
     }
 #endif    
@@ -673,6 +681,7 @@ void SyncBlockCache::Start()
     SyncBlockCache::GetSyncBlockCache() = new (&g_SyncBlockCacheInstance) SyncBlockCache;
 
     SyncBlockCache::GetSyncBlockCache()->m_EphemeralBitmap = bm;
+    SyncBlockCache::GetSyncBlockCache()->m_SyncTableSize = initialSize;
 
 #ifndef FEATURE_PAL
     InitializeSListHead(&InteropSyncBlockInfo::s_InteropInfoStandbyList);
@@ -768,7 +777,11 @@ SyncBlock* SyncBlockCache::GetNextCleanupSyncBlock()
 
 // returns and removes the next free syncblock from the list
 // the cache lock must be entered to call this
-SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
+//
+// Each thread keeps a small free list of its own (see code:SyncBlockCache::TakeThreadFreeSyncBlock), which the
+// caller pops outside of the cache lock and passes in as pThreadFreeSyncBlock. When the global list has to be used
+// instead, a batch of further free sync blocks is moved to the thread's list along the way.
+SyncBlock *SyncBlockCache::GetNextFreeSyncBlock(Thread *pThread, SyncBlock *pThreadFreeSyncBlock)
 {
     CONTRACTL
     {
@@ -788,6 +801,12 @@ SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
 
     m_ActiveCount++;
 
+    if (pThreadFreeSyncBlock != NULL)
+    {
+        // Blocks on a thread's free list are not counted in m_FreeCount
+        return pThreadFreeSyncBlock;
+    }
+
     if (plst)
     {
         m_FreeBlockList = m_FreeBlockList->m_pNext;
@@ -798,6 +817,19 @@ SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
         // get the actual sync block pointer
         psb = (SyncBlock *) (((BYTE *) plst) - offsetof(SyncBlock, m_Link));
 
+        if (pThread != NULL)
+        {
+            while (m_FreeBlockList != NULL && pThread->m_FreeSyncBlockCount < SYNC_BLOCK_THREAD_BATCH)
+            {
+                SLink *pNext = m_FreeBlockList->m_pNext;
+                m_FreeBlockList->m_pNext = pThread->m_pFreeSyncBlockList;
+                pThread->m_pFreeSyncBlockList = m_FreeBlockList;
+                pThread->m_FreeSyncBlockCount++;
+                m_FreeBlockList = pNext;
+                m_FreeCount--;
+            }
+        }
+
         return psb;
     }
     else
@@ -821,6 +853,69 @@ SyncBlock *SyncBlockCache::GetNextFreeSyncBlock()
 
 }
 
+// returns and removes the next sync block from the thread's own free list, or NULL if it is empty. Only the
+// thread itself uses the list while it is running, so the cache lock is not needed.
+/* static */
+SyncBlock *SyncBlockCache::TakeThreadFreeSyncBlock(Thread *pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pThread == GetThread());
+
+    SLink *plst = pThread->m_pFreeSyncBlockList;
+    if (plst == NULL)
+    {
+        return NULL;
+    }
+
+    pThread->m_pFreeSyncBlockList = plst->m_pNext;
+    pThread->m_FreeSyncBlockCount--;
+
+    return (SyncBlock *) (((BYTE *) plst) - offsetof(SyncBlock, m_Link));
+}
+
+// puts a sync block obtained from TakeThreadFreeSyncBlock back on the thread's own free list
+/* static */
+void SyncBlockCache::ReturnThreadFreeSyncBlock(Thread *pThread, SyncBlock *psb)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pThread == GetThread());
+
+    psb->m_Link.m_pNext = pThread->m_pFreeSyncBlockList;
+    pThread->m_pFreeSyncBlockList = &psb->m_Link;
+    pThread->m_FreeSyncBlockCount++;
+}
+
+// moves the free sync blocks of a terminating thread back to the global free list
+void SyncBlockCache::ReleaseThreadFreeSyncBlocks(Thread *pThread)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (pThread->m_pFreeSyncBlockList == NULL)
+    {
+        return;
+    }
+
+    SyncBlockCache::LockHolder lh(this);
+
+    while (pThread->m_pFreeSyncBlockList != NULL)
+    {
+        SLink *plst = pThread->m_pFreeSyncBlockList;
+        pThread->m_pFreeSyncBlockList = plst->m_pNext;
+
+        plst->m_pNext = m_FreeBlockList;
+        m_FreeBlockList = plst;
+        m_FreeCount++;
+    }
+    pThread->m_FreeSyncBlockCount = 0;
+}
+
 void SyncBlockCache::Grow()
 {
     CONTRACTL
@@ -1623,15 +1718,19 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // From here on the lock's own adaptive spin count applies
+            const DWORD lockSpinCount = awareLock->GetSpinCount();
+            bool stoppedSpinningEarly = false;
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1640,10 +1739,12 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true /* acquiredLock */);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
                     {
+                        stoppedSpinningEarly = true;
                         break;
                     }
                 }
@@ -1651,9 +1752,17 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinResult(true /* acquiredLock */);
                 return AwareLock::EnterHelperResult_Entered;
             }
-            break;
+
+            // Spinning for the full duration was not enough to acquire the lock, so spin less on this lock next time. When
+            // spinning was cut short to let waiters in, that says nothing about how long the lock is held.
+            if (!stoppedSpinningEarly)
+            {
+                awareLock->RecordSpinResult(false /* acquiredLock */);
+            }
+            return AwareLock::EnterHelperResult_Contention;
         }
 
         DWORD tid = pCurThread->GetThreadId();
@@ -1688,6 +1797,48 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
             tid != (DWORD)(oldValue & SBLK_MASK_LOCK_THREADID));
     }
 
+    // The lock is still in thin lock mode and held by another thread. Going down the slow path would inflate it to a sync
+    // block, which takes the sync block cache lock and makes the lock permanently fat even if the contention was momentary.
+    // Typically the owner is about to release the lock, or has been preempted while holding it, so give it a few chances to
+    // run by yielding the processor before giving up on the thin lock.
+    // Yielding is a form of spinning, so don't do it when spinning is disabled (dwMonitorSpinCount == 0).
+    const DWORD yieldCount = spinCount == 0 ? 0 : g_SpinConstants.dwMonitorThinLockYieldCount;
+    for (DWORD switchCount = 0; switchCount < yieldCount;)
+    {
+        // Don't hold up a pending suspension while in cooperative mode
+        if (pCurThread->CatchAtSafePointOpportunistic())
+        {
+            break;
+        }
+
+        __SwitchToThread(0, ++switchCount);
+
+        LONG oldValue = m_SyncBlockValue.LoadWithoutBarrier();
+        if (oldValue & BIT_SBLK_IS_HASH_OR_SYNCBLKINDEX)
+        {
+            // Another thread has already inflated the lock, wait on the AwareLock in the slow path
+            break;
+        }
+
+        if ((oldValue & (BIT_SBLK_SPIN_LOCK +
+            SBLK_MASK_LOCK_THREADID +
+            SBLK_MASK_LOCK_RECLEVEL)) == 0)
+        {
+            DWORD tid = pCurThread->GetThreadId();
+            if (tid > SBLK_MASK_LOCK_THREADID)
+            {
+                return AwareLock::EnterHelperResult_UseSlowPath;
+            }
+
+            LONG newValue = oldValue | tid;
+            if (InterlockedCompareExchangeAcquire((LONG*)&m_SyncBlockValue, newValue, oldValue) == oldValue)
+            {
+                pCurThread->IncLockCount();
+                return AwareLock::EnterHelperResult_Entered;
+            }
+        }
+    }
+
     return AwareLock::EnterHelperResult_Contention;
 }
 
@@ -2180,6 +2331,10 @@ SyncBlock *ObjHeader::GetSyncBlock()
         RETURN syncBlock;
     }
 
+    // Take the memory from the thread's own free list first, outside of the cache lock
+    Thread *pThread = GetThreadNULLOk();
+    SyncBlock *pThreadFreeSyncBlock = (pThread != NULL) ? SyncBlockCache::TakeThreadFreeSyncBlock(pThread) : NULL;
+
     //Need to get it from the cache
     {
         SyncBlockCache::LockHolder lh(SyncBlockCache::GetSyncBlockCache());
@@ -2187,10 +2342,16 @@ SyncBlock *ObjHeader::GetSyncBlock()
         //Try one more time
         syncBlock = GetBaseObject()->PassiveGetSyncBlock();
         if (syncBlock)
+        {
+            if (pThreadFreeSyncBlock != NULL)
+            {
+                SyncBlockCache::ReturnThreadFreeSyncBlock(pThread, pThreadFreeSyncBlock);
+            }
             RETURN syncBlock;
+        }
 
 
-        SyncBlockMemoryHolder syncBlockMemoryHolder(SyncBlockCache::GetSyncBlockCache()->GetNextFreeSyncBlock());
+        SyncBlockMemoryHolder syncBlockMemoryHolder(SyncBlockCache::GetSyncBlockCache()->GetNextFreeSyncBlock(pThread, pThreadFreeSyncBlock));
         syncBlock = syncBlockMemoryHolder;
 
         if ((indx = GetHeaderSyncBlockIndex()) == 0)
@@ -2588,8 +2749,14 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     {
         QueryPerformanceCounter(&startTicks);
 
-        // Fire a contention start event for a managed contention
-        FireEtwContentionStart_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
+        // Fire a contention start event for a managed contention, identifying the lock, its object and its current owner
+        Thread *pHoldingThread = m_HoldingThread;
+        FireEtwContentionStart_V2(
+            ETW::ContentionLog::ContentionStructs::ManagedContention,
+            GetClrInstanceId(),
+            this,
+            OBJECTREFToObject(GetOwningObject()),
+            pHoldingThread == NULL ? 0 : (UINT64)pHoldingThread->GetOSThreadId64());
     }
 
     LogContention();
@@ -2670,7 +2837,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = GetSpinCount();
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -157,6 +157,7 @@ inline void InitializeSpinConstants()
     g_SpinConstants.dwBackoffFactor   = g_pConfig->SpinBackoffFactor();
     g_SpinConstants.dwRepetitions     = g_pConfig->SpinRetryCount();
     g_SpinConstants.dwMonitorSpinCount = g_SpinConstants.dwMaximumDuration == 0 ? 0 : g_pConfig->MonitorSpinCount();
+    g_SpinConstants.dwMonitorThinLockYieldCount = g_pConfig->MonitorThinLockYieldCount();
 #endif
 }
 
@@ -456,6 +457,15 @@ private:
 
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
+    // Number of spin iterations a contending thread performs on this lock before waiting. It starts at (and is capped by)
+    // g_SpinConstants.dwMonitorSpinCount and is adjusted by RecordSpinResult() depending on whether spinning has recently
+    // been successful in acquiring this particular lock. Locks that are held briefly keep spinning for the full duration,
+    // while locks that are held for longer than a spin quickly stop burning CPU on every contended enter.
+    UINT16 m_spinCount;
+
+    static const UINT16 SpinCountNotInitialized = (UINT16)-1;
+    static const DWORD MinimumSpinCount = 1;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_Recursion(0),
@@ -465,7 +475,8 @@ private:
 #endif // DACCESS_COMPILE          
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(SpinCountNotInitialized)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -543,6 +554,10 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    // Adaptive spinning, see m_spinCount
+    DWORD GetSpinCount() const;
+    void RecordSpinResult(bool acquiredLock);
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
@@ -1203,8 +1218,14 @@ class SyncBlockCache
     static void Start();
     static void Stop();
 
-    // returns and removes next from free list
-    SyncBlock* GetNextFreeSyncBlock();
+    // returns and removes next from free list, or uses a sync block taken from the thread's own free list
+    SyncBlock* GetNextFreeSyncBlock(Thread *pThread, SyncBlock *pThreadFreeSyncBlock);
+    // removes the next sync block from the thread's own free list, does not need the cache lock
+    static SyncBlock* TakeThreadFreeSyncBlock(Thread *pThread);
+    // puts a sync block taken with TakeThreadFreeSyncBlock back, does not need the cache lock
+    static void ReturnThreadFreeSyncBlock(Thread *pThread, SyncBlock *psb);
+    // gives the thread's own free list back to the cache when the thread terminates
+    void    ReleaseThreadFreeSyncBlocks(Thread *pThread);
     // returns and removes the next from cleanup list
     SyncBlock* GetNextCleanupSyncBlock();
     // inserts a syncblock into the cleanup list
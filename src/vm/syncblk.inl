@@ -468,6 +468,40 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Locks that have not recorded a spin result yet start at the configured maximum
+    return min((DWORD)VolatileLoadWithoutBarrier(&m_spinCount), g_SpinConstants.dwMonitorSpinCount);
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Updates are not synchronized between spinners, it's only a heuristic and a lost update does no harm
+    DWORD spinCount = GetSpinCount();
+    DWORD newSpinCount = spinCount;
+    if (acquiredLock)
+    {
+        if (spinCount < g_SpinConstants.dwMonitorSpinCount)
+        {
+            ++newSpinCount;
+        }
+    }
+    else if (spinCount > MinimumSpinCount)
+    {
+        --newSpinCount;
+    }
+
+    // Avoid dirtying the cache line when the count is stable
+    if (newSpinCount != spinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, (UINT16)min(newSpinCount, (DWORD)SpinCountNotInitialized - 1));
+    }
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
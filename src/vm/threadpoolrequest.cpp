@@ -32,7 +32,7 @@ BYTE PerAppDomainTPCountList::s_padding[MAX_CACHE_LINE_SIZE - sizeof(LONG)];
 DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) LONG PerAppDomainTPCountList::s_ADHint = -1;
 
 // Move out of from preceeding variables' cache line
-DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) UnManagedPerAppDomainTPCount PerAppDomainTPCountList::s_unmanagedTPCount;
+DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) SVAL_IMPL(UnManagedPerAppDomainTPCount, PerAppDomainTPCountList, s_unmanagedTPCount);
 //The list of all per-appdomain work-request counts.
 ArrayListStatic PerAppDomainTPCountList::s_appDomainIndexList;
 
@@ -332,6 +332,165 @@ bool FORCEINLINE UnManagedPerAppDomainTPCount::TakeActiveRequest()
 }
 
 
+#ifndef DACCESS_COMPILE
+
+// The local queue owned by the current worker while it dispatches unmanaged
+// work requests, or NULL.
+#ifndef __GNUC__
+__declspec(thread) WorkRequestStealingQueue* t_pLocalWorkQueue = NULL;
+#else // !__GNUC__
+thread_local WorkRequestStealingQueue* t_pLocalWorkQueue = NULL;
+#endif // !__GNUC__
+
+//---------------------------------------------------------------------------
+//LocalPush adds a request at the tail of the queue. It must only be called by
+//the owning worker. Returns false if the queue is full.
+//
+bool WorkRequestStealingQueue::LocalPush(WorkRequest* pWorkRequest)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    LONG tail = VolatileLoad(&m_tailIndex);
+
+    // Rebase the indices before the tail index overflows. Since MAXLONG & QueueMask
+    // equals QueueMask, the head index still precedes the tail index afterwards.
+    if (tail == MAXLONG)
+    {
+        DangerousNonHostedSpinLockHolder lockHolder(&m_foreignLock);
+
+        if (m_tailIndex == MAXLONG)
+        {
+            VolatileStore(&m_headIndex, m_headIndex & QueueMask);
+            tail = m_tailIndex & QueueMask;
+            VolatileStore(&m_tailIndex, tail);
+            _ASSERTE(m_headIndex <= m_tailIndex);
+        }
+    }
+
+    // Fast path: there is room in the queue, no need to synchronize with thieves
+    if (tail < VolatileLoad(&m_headIndex) + QueueMask)
+    {
+        m_array[tail & QueueMask] = pWorkRequest;
+        VolatileStore(&m_tailIndex, tail + 1);
+        return true;
+    }
+
+    DangerousNonHostedSpinLockHolder lockHolder(&m_foreignLock);
+
+    LONG head = m_headIndex;
+    if (tail - head >= QueueMask)
+    {
+        return false;
+    }
+
+    m_array[tail & QueueMask] = pWorkRequest;
+    VolatileStore(&m_tailIndex, tail + 1);
+    return true;
+}
+
+//---------------------------------------------------------------------------
+//LocalPop removes the most recently pushed request. It must only be called by
+//the owning worker. Only takes the lock when racing a thief for the last
+//request.
+//
+WorkRequest* WorkRequestStealingQueue::LocalPop()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    LONG tail = VolatileLoad(&m_tailIndex);
+    if (VolatileLoad(&m_headIndex) >= tail)
+    {
+        return NULL;
+    }
+
+    // Publish the decremented tail with a full fence, so that a thief either
+    // sees it or we see the thief's head increment below.
+    tail -= 1;
+    FastInterlockExchange(&m_tailIndex, tail);
+
+    WorkRequest* pWorkRequest = NULL;
+
+    if (VolatileLoad(&m_headIndex) <= tail)
+    {
+        pWorkRequest = m_array[tail & QueueMask];
+        m_array[tail & QueueMask] = NULL;
+        return pWorkRequest;
+    }
+
+    DangerousNonHostedSpinLockHolder lockHolder(&m_foreignLock);
+
+    if (m_headIndex <= tail)
+    {
+        // Won the race for the last request
+        pWorkRequest = m_array[tail & QueueMask];
+        m_array[tail & QueueMask] = NULL;
+    }
+    else
+    {
+        // A thief took the last request, restore the tail
+        VolatileStore(&m_tailIndex, tail + 1);
+    }
+
+    return pWorkRequest;
+}
+
+//---------------------------------------------------------------------------
+//TrySteal removes the oldest request on behalf of another worker. Sets
+//*missedSteal if the queue may have had a request that could not be taken
+//because the lock was busy.
+//
+WorkRequest* WorkRequestStealingQueue::TrySteal(bool* missedSteal)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (IsEmpty())
+    {
+        return NULL;
+    }
+
+    DangerousNonHostedSpinLockTryHolder lockHolder(&m_foreignLock);
+    if (!lockHolder.Acquired())
+    {
+        *missedSteal = true;
+        return NULL;
+    }
+
+    // Publish the incremented head with a full fence, pairs with LocalPop
+    LONG head = m_headIndex;
+    FastInterlockExchange(&m_headIndex, head + 1);
+
+    if (head < VolatileLoad(&m_tailIndex))
+    {
+        WorkRequest* pWorkRequest = m_array[head & QueueMask];
+        m_array[head & QueueMask] = NULL;
+        return pWorkRequest;
+    }
+
+    // The owner popped the last request, restore the head
+    VolatileStore(&m_headIndex, head);
+    return NULL;
+}
+
+#endif // !DACCESS_COMPILE
+
 FORCEINLINE void ReleaseWorkRequest(WorkRequest *workRequest) { ThreadpoolMgr::RecycleMemory( workRequest, ThreadpoolMgr::MEMTYPE_WorkRequest ); }
 typedef Wrapper< WorkRequest *, DoNothing<WorkRequest *>, ReleaseWorkRequest > WorkRequestHolder;
 
@@ -363,14 +522,26 @@ void UnManagedPerAppDomainTPCount::QueueUnmanagedWorkRequest(LPTHREAD_START_ROUT
         !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(function))
         FireEtwThreadPoolEnqueue(pWorkRequest, GetClrInstanceId());
 
-    m_lock.Init(LOCK_TYPE_DEFAULT);
-    
+    // Count the request before publishing it, so that a dequeuing thread
+    // never observes a request that has not been accounted for.
+    FastInterlockIncrement(&m_NumRequests);
+
+    // Requests queued from a worker go to its local queue, where the worker
+    // picks them up next without touching the global lock. Other threads and
+    // local queue overflow inject into the global queue.
+    WorkRequestStealingQueue* pLocalQueue = t_pLocalWorkQueue;
+    if (pLocalQueue != NULL && pLocalQueue->LocalPush(pWorkRequest))
     {
+        pWorkRequest.SuppressRelease();
+    }
+    else
+    {
+        m_lock.Init(LOCK_TYPE_DEFAULT);
+
         SpinLock::Holder slh(&m_lock);
 
         ThreadpoolMgr::EnqueueWorkRequest(pWorkRequest);
         pWorkRequest.SuppressRelease();
-        m_NumRequests++;
     }
 
     SetAppDomainRequestsActive();
@@ -389,19 +560,220 @@ PVOID UnManagedPerAppDomainTPCount::DeQueueUnManagedWorkRequest(bool* lastOne)
 
     *lastOne = true;
 
-    WorkRequest * pWorkRequest = ThreadpoolMgr::DequeueWorkRequest();
+    if (VolatileLoad(&m_NumRequests) <= 0)
+        return NULL;
+
+    WorkRequest * pWorkRequest = NULL;
+
+#ifndef DACCESS_COMPILE
+    // Own queue first (LIFO, cache warm), then the global queue (FIFO), and
+    // finally steal the oldest request from another worker's queue.
+    WorkRequestStealingQueue* pLocalQueue = t_pLocalWorkQueue;
+    if (pLocalQueue != NULL)
+        pWorkRequest = pLocalQueue->LocalPop();
+
+    if (pWorkRequest == NULL)
+    {
+        m_lock.Init(LOCK_TYPE_DEFAULT);
+
+        SpinLock::Holder slh(&m_lock);
+        pWorkRequest = ThreadpoolMgr::DequeueWorkRequest();
+    }
+
+    if (pWorkRequest == NULL)
+        pWorkRequest = TryStealWorkRequest(pLocalQueue);
 
     if (pWorkRequest) 
     {
-        m_NumRequests--;
+        pWorkRequest->next = NULL;
 
-        if(m_NumRequests > 0) 
+        if (FastInterlockDecrement(&m_NumRequests) > 0) 
             *lastOne = false;
     }
+#endif // !DACCESS_COMPILE
 
     return (PVOID) pWorkRequest;
 }
 
+#ifndef DACCESS_COMPILE
+
+WorkRequest* UnManagedPerAppDomainTPCount::TryStealWorkRequest(WorkRequestStealingQueue* pLocalQueue)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    LONG count = min(VolatileLoad(&m_localQueueCount), MaxLocalQueues);
+    if (count == 0)
+        return NULL;
+
+    // Start after our own queue so that thieves spread out over the victims
+    LONG start = (pLocalQueue != NULL) ? pLocalQueue->GetIndex() + 1 : 0;
+    bool missedSteal = false;
+
+    for (LONG i = 0; i < count; i++)
+    {
+        WorkRequestStealingQueue* pQueue = VolatileLoad(&m_localQueues[(start + i) % count]);
+        if (pQueue == NULL || pQueue == pLocalQueue)
+            continue;
+
+        WorkRequest* pWorkRequest = pQueue->TrySteal(&missedSteal);
+        if (pWorkRequest != NULL)
+            return pWorkRequest;
+    }
+
+    // A busy victim may still hold work, make sure someone comes back for it
+    if (missedSteal)
+        SetAppDomainRequestsActive();
+
+    return NULL;
+}
+
+//---------------------------------------------------------------------------
+//AttachLocalQueue gives the current worker a local queue for the duration of
+//DispatchWorkItem, reusing a queue released by an earlier worker if possible.
+//If no queue can be had the worker simply runs without one.
+//
+void UnManagedPerAppDomainTPCount::AttachLocalQueue(UnManagedPerAppDomainTPCount* pTPCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(t_pLocalWorkQueue == NULL);
+
+    LONG count = min(VolatileLoad(&pTPCount->m_localQueueCount), MaxLocalQueues);
+    for (LONG i = 0; i < count; i++)
+    {
+        WorkRequestStealingQueue* pQueue = VolatileLoad(&pTPCount->m_localQueues[i]);
+        if (pQueue != NULL && pQueue->TryAcquireOwnership())
+        {
+            t_pLocalWorkQueue = pQueue;
+            return;
+        }
+    }
+
+    if (count >= MaxLocalQueues)
+        return;
+
+    LONG index = FastInterlockIncrement(&pTPCount->m_localQueueCount) - 1;
+    if (index >= MaxLocalQueues)
+        return;
+
+    WorkRequestStealingQueue* pQueue = new (nothrow) WorkRequestStealingQueue(index);
+    if (pQueue == NULL)
+        return;
+
+    pQueue->TryAcquireOwnership();
+    VolatileStore(&pTPCount->m_localQueues[index], pQueue);
+    t_pLocalWorkQueue = pQueue;
+}
+
+//---------------------------------------------------------------------------
+//DetachLocalQueue moves whatever is left in the current worker's local queue
+//to the global queue, in the order it was queued, and releases the queue.
+//A worker is requested for the moved requests, since the one that woke for
+//them may already have found the global queue empty and given up.
+//
+void UnManagedPerAppDomainTPCount::DetachLocalQueue(UnManagedPerAppDomainTPCount* pTPCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    WorkRequestStealingQueue* pQueue = t_pLocalWorkQueue;
+    if (pQueue == NULL)
+        return;
+
+    t_pLocalWorkQueue = NULL;
+
+    // LocalPop returns the newest request first; chaining each one in front
+    // restores queueing order.
+    WorkRequest* pFirst = NULL;
+    WorkRequest* pWorkRequest;
+    while ((pWorkRequest = pQueue->LocalPop()) != NULL)
+    {
+        pWorkRequest->next = pFirst;
+        pFirst = pWorkRequest;
+    }
+
+    if (pFirst != NULL)
+    {
+        pTPCount->m_lock.Init(LOCK_TYPE_DEFAULT);
+
+        {
+            SpinLock::Holder slh(&pTPCount->m_lock);
+
+            while (pFirst != NULL)
+            {
+                pWorkRequest = pFirst;
+                pFirst = pWorkRequest->next;
+                pWorkRequest->next = NULL;
+                ThreadpoolMgr::EnqueueWorkRequest(pWorkRequest);
+            }
+        }
+
+        pTPCount->SetAppDomainRequestsActive();
+    }
+
+    pQueue->ReleaseOwnership();
+}
+
+#else // !DACCESS_COMPILE
+
+//---------------------------------------------------------------------------
+//GetNextLocalWorkRequest walks the requests pending in the local queues, queue
+//by queue and from oldest to newest within a queue. It returns the request that
+//follows pPrevious, or the first one if pPrevious is not in a local queue, and
+//sets *pFoundPrevious accordingly. Returns NULL at the end of the walk.
+//
+PTR_WorkRequest UnManagedPerAppDomainTPCount::GetNextLocalWorkRequest(PTR_WorkRequest pPrevious, bool* pFoundPrevious)
+{
+    SUPPORTS_DAC;
+
+    PTR_WorkRequest pFirst = NULL;
+    *pFoundPrevious = false;
+
+    LONG count = min(m_localQueueCount, MaxLocalQueues);
+    for (LONG i = 0; i < count; i++)
+    {
+        PTR_WorkRequestStealingQueue pQueue = m_localQueues[i];
+        if (pQueue == NULL)
+            continue;
+
+        // Bound the walk in case the indices are torn in the target
+        LONG head = pQueue->m_headIndex;
+        LONG size = min(pQueue->m_tailIndex - head, (LONG)WorkRequestStealingQueue::QueueSize);
+        for (LONG j = 0; j < size; j++)
+        {
+            PTR_WorkRequest pWorkRequest = pQueue->m_array[(head + j) & WorkRequestStealingQueue::QueueMask];
+            if (*pFoundPrevious)
+                return pWorkRequest;
+
+            if (pFirst == NULL)
+                pFirst = pWorkRequest;
+            if (pWorkRequest == pPrevious)
+                *pFoundPrevious = true;
+        }
+    }
+
+    return *pFoundPrevious ? NULL : pFirst;
+}
+
+#endif // !DACCESS_COMPILE
+
 //---------------------------------------------------------------------------
 //DispatchWorkItem manages dispatching of unmanaged work requests. It keeps
 //processing unmanaged requests for the "Quanta". Essentially this function is 
@@ -433,13 +805,13 @@ void UnManagedPerAppDomainTPCount::DispatchWorkItem(bool* foundWork, bool* wasNo
     bool firstIteration = true;
     bool lastOne = false;
 
+    // Requests queued by the callbacks below go to this worker's local queue.
+    // Anything left in it when we return is handed back to the global queue.
+    LocalQueueHolder localQueueHolder(this);
+
     while (*wasNotRecalled) 
     {
-        m_lock.Init(LOCK_TYPE_DEFAULT);
-        {
-            SpinLock::Holder slh(&m_lock);
-            pWorkRequest = (WorkRequest*) DeQueueUnManagedWorkRequest(&lastOne);
-        }
+        pWorkRequest = (WorkRequest*) DeQueueUnManagedWorkRequest(&lastOne);
 
         if (NULL == pWorkRequest)
             break;
@@ -143,6 +143,74 @@ private:
     };
 };
 
+struct WorkRequest;
+typedef DPTR(WorkRequest) PTR_WorkRequest;
+
+//--------------------------------------------------------------------------
+//WorkRequestStealingQueue is the per worker queue of unmanaged work requests.
+//The owning worker pushes and pops at the tail (LIFO) without taking a lock,
+//while other workers steal from the head (FIFO) under a try-lock. This is the
+//native counterpart of WorkStealingQueue in threadpool.cs. The queue has a
+//fixed capacity; when it is full the caller falls back to the global queue.
+class WorkRequestStealingQueue {
+    friend class UnManagedPerAppDomainTPCount;
+
+public:
+
+    WorkRequestStealingQueue(LONG index)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_index = index;
+        m_owned = 0;
+        m_headIndex = 0;
+        m_tailIndex = 0;
+        ZeroMemory(m_array, sizeof(m_array));
+    }
+
+    inline bool TryAcquireOwnership()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return FastInterlockCompareExchange(&m_owned, 1, 0) == 0;
+    }
+
+    inline void ReleaseOwnership()
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE(VolatileLoad(&m_owned) == 1);
+        VolatileStore(&m_owned, (LONG)0);
+    }
+
+    inline LONG GetIndex()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_index;
+    }
+
+    inline bool IsEmpty()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoad(&m_headIndex) >= VolatileLoad(&m_tailIndex);
+    }
+
+    bool LocalPush(WorkRequest* pWorkRequest);
+    WorkRequest* LocalPop();
+    WorkRequest* TrySteal(bool* missedSteal);
+
+private:
+    static const LONG QueueSize = 256;
+    static const LONG QueueMask = QueueSize - 1;
+
+    // Only touched by the owner, or by thieves holding m_foreignLock
+    PTR_WorkRequest m_array[QueueSize];
+    LONG m_headIndex;
+    LONG m_tailIndex;
+    LONG m_index;
+    LONG m_owned;
+    DangerousNonHostedSpinLock m_foreignLock;
+};
+
+typedef DPTR(WorkRequestStealingQueue) PTR_WorkRequestStealingQueue;
+
 //--------------------------------------------------------------------------
 //UnManagedPerAppDomainTPCount maintains the thread pool state/counts for 
 //unmanaged work requests. From thread pool point of view we treat unmanaged 
@@ -155,6 +223,8 @@ public:
     {
         LIMITED_METHOD_CONTRACT;
         ResetState();
+        m_localQueueCount = 0;
+        ZeroMemory(m_localQueues, sizeof(m_localQueues));
     }
 
     inline void InitResources()
@@ -177,7 +247,7 @@ public:
     inline void ResetState()
     {
         LIMITED_METHOD_CONTRACT;
-        m_NumRequests = 0;
+        VolatileStore(&m_NumRequests, (LONG)0);
         VolatileStore(&m_outstandingThreadRequestCount, (LONG)0);
     }
 
@@ -224,12 +294,35 @@ public:
     inline ULONG GetNumRequests()
     {
         LIMITED_METHOD_CONTRACT;
-        return VolatileLoad(&m_NumRequests);
+        return (ULONG)VolatileLoad(&m_NumRequests);
     }
 
+#ifdef DACCESS_COMPILE
+    PTR_WorkRequest GetNextLocalWorkRequest(PTR_WorkRequest pPrevious, bool* pFoundPrevious);
+#endif // DACCESS_COMPILE
+
 private:
+    WorkRequest* TryStealWorkRequest(WorkRequestStealingQueue* pLocalQueue);
+
+    static void AttachLocalQueue(UnManagedPerAppDomainTPCount* pTPCount);
+    static void DetachLocalQueue(UnManagedPerAppDomainTPCount* pTPCount);
+    typedef Holder<UnManagedPerAppDomainTPCount*, AttachLocalQueue, DetachLocalQueue> LocalQueueHolder;
+
+    // Upper bound on the number of workers that get a local queue; workers
+    // beyond it dispatch from the global queue only.
+    static const LONG MaxLocalQueues = 64;
+
+    // Local queues are never freed. A queue is owned by one worker for the
+    // duration of DispatchWorkItem and reused by the next worker afterwards.
+    PTR_WorkRequestStealingQueue m_localQueues[MaxLocalQueues];
+    LONG m_localQueueCount;
+
+    // Protects the global FIFO queue, which receives requests from threads
+    // without a local queue and local queue overflow.
     SpinLock m_lock;
-    ULONG m_NumRequests;
+    // Requests pending across the global and all local queues. Only use with
+    // VolatileLoad+FastInterlockIncrement/Decrement.
+    LONG m_NumRequests;
     struct DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) {
         BYTE m_padding1[MAX_CACHE_LINE_SIZE - sizeof(LONG)];
         // Only use with VolatileLoad+VolatileStore+FastInterlockCompareExchange
@@ -256,6 +349,8 @@ private:
 //just provides heuristics to the thread pool scheduler, along with 
 //synchronization to indicate start/end of requests to the scheduler.
 class PerAppDomainTPCountList{
+    friend struct _DacGlobals;
+
 public:
     static void InitAppDomainIndexList();    
     static void ResetAppDomainIndex(TPIndex index);
@@ -278,7 +373,7 @@ private:
 
     static BYTE s_padding[MAX_CACHE_LINE_SIZE - sizeof(LONG)];
     DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static LONG s_ADHint;
-    DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static UnManagedPerAppDomainTPCount s_unmanagedTPCount;
+    DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) SVAL_DECL(UnManagedPerAppDomainTPCount, s_unmanagedTPCount);
 
     //The list of all per-appdomain work-request counts.
     static ArrayListStatic s_appDomainIndexList;
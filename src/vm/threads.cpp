@@ -85,6 +85,7 @@ BOOL Thread::s_fCleanFinalizedThread = FALSE;
 UINT64 Thread::s_workerThreadPoolCompletionCountOverflow = 0;
 UINT64 Thread::s_ioThreadPoolCompletionCountOverflow = 0;
 UINT64 Thread::s_monitorLockContentionCountOverflow = 0;
+Volatile<LONG> Thread::s_threadLocalCountsVersion = 0;
 
 CrstStatic g_DeadlockAwareCrst;
 
@@ -662,7 +663,9 @@ Thread* SetupThread(BOOL fInternal)
     {
         DWORD  ourOSThreadId = ::GetCurrentThreadId();
         {
-            ThreadStoreLockHolder TSLockHolder;
+            // Whoever is starting the pending thread keeps it alive, so the search
+            // does not need to hold up thread creation and exit.
+            ThreadStoreReaderHolder tsr;
             _ASSERTE(pThread == NULL);
             while ((pThread = ThreadStore::s_pThreadStore->GetAllThreadList(pThread, Thread::TS_Unstarted | Thread::TS_FailStarted, Thread::TS_Unstarted)) != NULL)
             {
@@ -1378,8 +1381,11 @@ Thread::Thread()
 
     m_OSThreadId = 0;
     m_Priority = INVALID_THREAD_PRIORITY;
+    m_fRendezvousPending = 0;
+    m_rendezvousTicks = 0;
     m_ExternalRefCount = 1;
     m_UnmanagedRefCount = 0;
+    m_pNextRetiredThread = NULL;
     m_State = TS_Unstarted;
     m_StateNC = TSNC_Unknown;
 
@@ -2481,7 +2487,7 @@ int Thread::DecExternalCount(BOOL holdingLock)
             if (SelfDelete) {
                 SetThread(NULL);
             }
-            delete this;
+            ThreadStore::RetireThread(this);
         }
 
         tsLock.Release();
@@ -2959,6 +2965,12 @@ void Thread::OnThreadTerminate(BOOL holdingLock)
 
     }
 
+    // Give the sync blocks set aside for this thread back to the cache
+    if (m_pFreeSyncBlockList != NULL)
+    {
+        SyncBlockCache::GetSyncBlockCache()->ReleaseThreadFreeSyncBlocks(this);
+    }
+
     if  (GCHeapUtilities::IsGCHeapInitialized())
     {
         // Guaranteed to NOT be a shutdown case, because we tear down the heap before
@@ -5206,6 +5218,13 @@ ThreadStore::ThreadStore()
     }
     CONTRACTL_END;
 
+    m_ReaderEpoch = 0;
+    m_ReaderCount[0] = 0;
+    m_ReaderCount[1] = 0;
+    m_RetiredThreads = NULL;
+    m_PreviousRetiredThreads = NULL;
+    m_ReclaimRetiredThreads = false;
+
     m_TerminationEvent.CreateManualEvent(FALSE);
     _ASSERTE(m_TerminationEvent.IsValid());
 }
@@ -5363,6 +5382,11 @@ BOOL ThreadStore::RemoveThread(Thread *target)
     _ASSERTE(s_pThreadStore->m_Crst.GetEnterCount() > 0 ||
              IsAtProcessExit());
     _ASSERTE(s_pThreadStore->DbgFindThread(target));
+
+    // Lock-free sums of the thread-local counts must not miss the target's counts
+    // between unlinking it and folding them into the overflow counts below.
+    Thread::BeginFoldThreadLocalCounts();
+
     ret = s_pThreadStore->m_ThreadList.FindAndRemove(target);
     _ASSERTE(ret && ret == target);
     found = (ret != NULL);
@@ -5395,7 +5419,12 @@ BOOL ThreadStore::RemoveThread(Thread *target)
         FastInterlockExchangeAddLong(
             (LONGLONG *)&Thread::s_monitorLockContentionCountOverflow,
             target->m_monitorLockContentionCount);
+    }
+
+    Thread::EndFoldThreadLocalCounts();
 
+    if (found)
+    {
         _ASSERTE(s_pThreadStore->m_ThreadCount >= 0);
         _ASSERTE(s_pThreadStore->m_BackgroundThreadCount >= 0);
         _ASSERTE(s_pThreadStore->m_ThreadCount >=
@@ -5413,6 +5442,176 @@ BOOL ThreadStore::RemoveThread(Thread *target)
 }
 
 
+// Threads reach here from DecExternalCount once nothing references them anymore.
+// Unlinking them from m_ThreadList right away keeps them out of every walk that
+// starts from now on, but a lock-free reader that is already past the previous
+// thread may still step onto them, so deleting them is left to ReclaimRetiredThreads.
+// FindAndRemove leaves the retired thread's m_Link pointing into the list, which
+// lets such a reader carry on from there.
+void ThreadStore::RetireThread(Thread *thread)
+{
+    CONTRACTL {
+        NOTHROW;
+        if (GetThread()) {GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_pThreadStore->m_Crst.GetEnterCount() > 0 ||
+             IsAtProcessExit());
+
+    if (thread->HasThreadStateNC(Thread::TSNC_ExistInThreadStore))
+    {
+        BOOL ret;
+        ret = RemoveThread(thread);
+        _ASSERTE(ret);
+    }
+
+    thread->m_pNextRetiredThread = s_pThreadStore->m_RetiredThreads;
+    s_pThreadStore->m_RetiredThreads = thread;
+
+    s_pThreadStore->ReclaimRetiredThreads();
+}
+
+// Delete the retired threads that no lock-free reader can reach anymore.  Runs
+// inside the critical section, so only one thread flips the epoch at a time.
+void ThreadStore::ReclaimRetiredThreads()
+{
+    CONTRACTL {
+        NOTHROW;
+        if (GetThread()) {GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
+    }
+    CONTRACTL_END;
+
+    // Order the caller's update of the retired lists before reading the reader
+    // counts.  Either we see the last reader of the previous epoch, or that reader
+    // sees the retired threads and asks the finalizer thread to reclaim them, see
+    // LeaveReader.
+    MemoryBarrier();
+
+    // Threads retired before the last flip could only be seen by readers of the
+    // previous epoch.  Once those are gone, delete them, move the current list
+    // over and flip, so the readers of the current epoch start draining.  Going
+    // around twice deletes everything right away when no reader is active, which
+    // is the common case.
+    for (int pass = 0; pass < 2; pass++)
+    {
+        LONG epoch = m_ReaderEpoch;
+
+        if (m_ReaderCount[epoch ^ 1] != 0)
+        {
+            return;
+        }
+
+        Thread *thread = m_PreviousRetiredThreads;
+        m_PreviousRetiredThreads = m_RetiredThreads;
+        m_RetiredThreads = NULL;
+
+        // The interlocked operation orders the flip before the reader counts the
+        // next pass reads, see EnterReader.
+        FastInterlockExchange((LONG *)&m_ReaderEpoch, epoch ^ 1);
+
+        while (thread != NULL)
+        {
+            Thread *next = thread->m_pNextRetiredThread;
+            delete thread;
+            thread = next;
+        }
+
+        if (m_PreviousRetiredThreads == NULL)
+        {
+            return;
+        }
+    }
+}
+
+LONG ThreadStore::EnterReader()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    while (TRUE)
+    {
+        LONG epoch = s_pThreadStore->m_ReaderEpoch;
+        FastInterlockIncrement((LONG *)&s_pThreadStore->m_ReaderCount[epoch]);
+
+        // If the epoch flipped before we were counted, ReclaimRetiredThreads may
+        // have already found this slot empty and deleted threads we could reach.
+        // Count ourselves in the new epoch instead.
+        if (s_pThreadStore->m_ReaderEpoch == epoch)
+        {
+            return epoch;
+        }
+
+        FastInterlockDecrement((LONG *)&s_pThreadStore->m_ReaderCount[epoch]);
+    }
+}
+
+void ThreadStore::LeaveReader(LONG epoch)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_pThreadStore->m_ReaderCount[epoch] > 0);
+    if (FastInterlockDecrement((LONG *)&s_pThreadStore->m_ReaderCount[epoch]) != 0 ||
+        s_pThreadStore->m_ReaderEpoch == epoch)
+    {
+        return;
+    }
+
+    // We were the last reader of the previous epoch.  ReclaimRetiredThreads gave up
+    // on the threads retired since then while we were counted, so unless someone
+    // reclaims them they would wait for the next thread to die.  Readers may hold
+    // other locks here, so leave the deleting to the finalizer thread rather than
+    // taking the thread store lock.
+    if (s_pThreadStore->m_PreviousRetiredThreads == NULL &&
+        s_pThreadStore->m_RetiredThreads == NULL)
+    {
+        return;
+    }
+
+    if (!g_fEEStarted) // required for FinalizerThread::EnableFinalization() below
+    {
+        return;
+    }
+
+    s_pThreadStore->m_ReclaimRetiredThreads = true;
+    FinalizerThread::EnableFinalization();
+}
+
+bool ThreadStore::ShouldReclaimRetiredThreads()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return m_ReclaimRetiredThreads;
+}
+
+void ThreadStore::ReclaimRetiredThreadsIfNecessary()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_TRIGGERS;
+    }
+    CONTRACTL_END;
+
+    if (!m_ReclaimRetiredThreads)
+    {
+        return;
+    }
+    m_ReclaimRetiredThreads = false;
+
+    ThreadStoreLockHolder TSLockHolder(TRUE);
+    ReclaimRetiredThreads();
+}
+
+
 // When a thread is created as unstarted.  Later it may get started, in which case
 // someone calls Thread::HasStarted() on that physical thread.  This completes
 // the Setup and calls here.
@@ -5669,9 +5868,9 @@ void ThreadStore::TriggerGCForDeadThreadsIfNecessary()
 #endif // #ifndef DACCESS_COMPILE
 
 
-// Access the list of threads.  You must be inside a critical section, otherwise
-// the "cursor" thread might disappear underneath you.  Pass in NULL for the
-// cursor to begin at the start of the list.
+// Access the list of threads.  You must be inside a critical section or a
+// ThreadStoreReaderHolder, otherwise the "cursor" thread might disappear
+// underneath you.  Pass in NULL for the cursor to begin at the start of the list.
 Thread *ThreadStore::GetAllThreadList(Thread *cursor, ULONG mask, ULONG bits)
 {
     CONTRACTL {
@@ -5682,7 +5881,8 @@ Thread *ThreadStore::GetAllThreadList(Thread *cursor, ULONG mask, ULONG bits)
     SUPPORTS_DAC;
 
 #ifndef DACCESS_COMPILE
-    _ASSERTE((s_pThreadStore->m_Crst.GetEnterCount() > 0) || IsAtProcessExit());
+    _ASSERTE((s_pThreadStore->m_Crst.GetEnterCount() > 0) || IsAtProcessExit() ||
+             (s_pThreadStore->m_ReaderCount[0] + s_pThreadStore->m_ReaderCount[1] > 0));
 #endif
 
     while (TRUE)
@@ -7321,7 +7521,8 @@ BOOL Thread::HaveExtraWorkForFinalizer()
         || Thread::CleanupNeededForFinalizedThread()
         || (m_DetachCount > 0)
         || SystemDomain::System()->RequireAppDomainCleanup()
-        || ThreadStore::s_pThreadStore->ShouldTriggerGCForDeadThreads();
+        || ThreadStore::s_pThreadStore->ShouldTriggerGCForDeadThreads()
+        || ThreadStore::s_pThreadStore->ShouldReclaimRetiredThreads();
 }
 
 void Thread::DoExtraWorkForFinalizer()
@@ -7373,6 +7574,8 @@ void Thread::DoExtraWorkForFinalizer()
     ThreadpoolMgr::FlushQueueOfTimerInfos();
 
     ThreadStore::s_pThreadStore->TriggerGCForDeadThreadsIfNecessary();
+
+    ThreadStore::s_pThreadStore->ReclaimRetiredThreadsIfNecessary();
 }
 
 
@@ -8035,35 +8238,53 @@ NOINLINE void Thread::OnIncrementCountOverflow(UINT32 *threadLocalCount, UINT64
     // below become visible together
     ThreadStoreLockHolder tsl;
 
+    BeginFoldThreadLocalCounts();
     *threadLocalCount = 0;
     InterlockedExchangeAdd64((LONGLONG *)overflowCount, (LONGLONG)UINT32_MAX + 1);
+    EndFoldThreadLocalCounts();
 }
 
-UINT64 Thread::GetTotalCount(SIZE_T threadLocalCountOffset, UINT64 *overflowCount)
+void Thread::BeginFoldThreadLocalCounts()
 {
-    CONTRACTL {
-        NOTHROW;
-        GC_TRIGGERS;
-    }
-    CONTRACTL_END;
+    LIMITED_METHOD_CONTRACT;
 
-    _ASSERTE(overflowCount != nullptr);
+    // The interlocked operation makes the odd version visible before any count changes
+    FastInterlockIncrement((LONG *)&s_threadLocalCountsVersion);
+    _ASSERTE((s_threadLocalCountsVersion & 1) != 0);
+}
 
-    // enumerate all threads, summing their local counts.
-    ThreadStoreLockHolder tsl;
+void Thread::EndFoldThreadLocalCounts()
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE((s_threadLocalCountsVersion & 1) != 0);
+
+    // The interlocked operation makes the count changes visible before the even version
+    FastInterlockIncrement((LONG *)&s_threadLocalCountsVersion);
+}
 
-    UINT64 total = GetOverflowCount(overflowCount);
+UINT64 Thread::SumCounts(const SIZE_T *threadLocalCountOffsets, UINT64 *const *overflowCounts, int countKinds)
+{
+    WRAPPER_NO_CONTRACT;
+
+    UINT64 total = 0;
+    for (int i = 0; i < countKinds; i++)
+    {
+        total += GetOverflowCount(overflowCounts[i]);
+    }
 
     Thread *pThread = NULL;
     while ((pThread = ThreadStore::GetAllThreadList(pThread, 0, 0)) != NULL)
     {
-        total += *GetThreadLocalCountRef(pThread, threadLocalCountOffset);
+        for (int i = 0; i < countKinds; i++)
+        {
+            total += VolatileLoadWithoutBarrier(GetThreadLocalCountRef(pThread, threadLocalCountOffsets[i]));
+        }
     }
 
     return total;
 }
 
-UINT64 Thread::GetTotalThreadPoolCompletionCount()
+UINT64 Thread::GetTotalCount(const SIZE_T *threadLocalCountOffsets, UINT64 *const *overflowCounts, int countKinds)
 {
     CONTRACTL {
         NOTHROW;
@@ -8071,19 +8292,61 @@ UINT64 Thread::GetTotalThreadPoolCompletionCount()
     }
     CONTRACTL_END;
 
-    // enumerate all threads, summing their local counts.
+    // enumerate all threads, summing their local counts.  Readers only keep the threads
+    // alive, so a count folded into its overflow count during the walk could be missed or
+    // counted twice; retry when the version shows that happened.
+    for (int attempt = 0; attempt < 4; attempt++)
+    {
+        LONG version = s_threadLocalCountsVersion;
+        if ((version & 1) != 0)
+        {
+            YieldProcessor();
+            continue;
+        }
+
+        UINT64 total;
+        {
+            ThreadStoreReaderHolder tsr;
+            total = SumCounts(threadLocalCountOffsets, overflowCounts, countKinds);
+        }
+
+        // Order the reads of the counts before re-reading the version
+        MemoryBarrier();
+        if (s_threadLocalCountsVersion == version)
+        {
+            return total;
+        }
+    }
+
+    // Threads keep dying or counts keep overflowing, wait for them instead
     ThreadStoreLockHolder tsl;
+    return SumCounts(threadLocalCountOffsets, overflowCounts, countKinds);
+}
 
-    UINT64 total = GetWorkerThreadPoolCompletionCountOverflow() + GetIOThreadPoolCompletionCountOverflow();
+UINT64 Thread::GetTotalCount(SIZE_T threadLocalCountOffset, UINT64 *overflowCount)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(overflowCount != nullptr);
 
-    Thread *pThread = NULL;
-    while ((pThread = ThreadStore::GetAllThreadList(pThread, 0, 0)) != NULL)
+    return GetTotalCount(&threadLocalCountOffset, &overflowCount, 1);
+}
+
+UINT64 Thread::GetTotalThreadPoolCompletionCount()
+{
+    WRAPPER_NO_CONTRACT;
+
+    const SIZE_T threadLocalCountOffsets[] =
     {
-        total += pThread->m_workerThreadPoolCompletionCount;
-        total += pThread->m_ioThreadPoolCompletionCount;
-    }
+        offsetof(Thread, m_workerThreadPoolCompletionCount),
+        offsetof(Thread, m_ioThreadPoolCompletionCount)
+    };
+    UINT64 *const overflowCounts[] =
+    {
+        &s_workerThreadPoolCompletionCountOverflow,
+        &s_ioThreadPoolCompletionCountOverflow
+    };
 
-    return total;
+    return GetTotalCount(threadLocalCountOffsets, overflowCounts, _countof(overflowCounts));
 }
 
 INT32 Thread::ResetManagedThreadObject(INT32 nPriority)
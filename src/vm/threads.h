@@ -988,6 +988,7 @@ class Thread: public IUnknown
     friend class  ThreadStore;
     friend class  ThreadSuspend;
     friend class  SyncBlock;
+    friend class  SyncBlockCache;
     friend struct PendingSync;
     friend class  AppDomain;
     friend class  ThreadNative;
@@ -1655,6 +1656,14 @@ public:
     // checkpoint is exited by the running thread.
     StackingAllocator*    m_stackLocalAllocator = NULL;
 
+private:
+    // Sync block memory set aside for this thread by the SyncBlockCache, so that inflating a lock or
+    // allocating a sync block for a hash code does not touch the global free list every time.
+    // See code:SyncBlockCache::GetNextFreeSyncBlock
+    SLink*               m_pFreeSyncBlockList = NULL;
+    DWORD                m_FreeSyncBlockCount = 0;
+
+public:
     // Flags used to indicate tasks the thread has to do.
     ThreadTasks          m_ThreadTasks;
 
@@ -3212,6 +3221,10 @@ public:
     // can't figure out how to expand the ThreadList template type without
     // making m_Link public.
     SLink       m_Link;
+
+    // Links the threads the ThreadStore has retired but not deleted yet.  m_Link
+    // cannot be reused since lock-free readers may still follow it.
+    Thread     *m_pNextRetiredThread;
     
     // For N/Direct calls with the "setLastError" bit, this field stores
     // the errorcode from that call.
@@ -3683,6 +3696,13 @@ private:
 
     DWORD           m_Priority;     // initialized to INVALID_THREAD_PRIORITY, set to actual priority when a
                                     // thread does a busy wait for GC, reset to INVALID_THREAD_PRIORITY after wait is over
+
+    // Set by ThreadSuspend::SuspendRuntime while it waits for this thread to reach a GC safe point,
+    // cleared by whichever of the two acknowledges the rendezvous first. See ThreadSuspend::AcknowledgeRendezvous.
+    Volatile<LONG>  m_fRendezvousPending;
+    // Performance counter value at which the rendezvous was acknowledged, when rendezvous times are being traced
+    LONGLONG        m_rendezvousTicks;
+
     friend class NDirect; // Quick access to thread stub creation
 
 #ifdef HAVE_GCCOVER
@@ -3871,6 +3891,11 @@ private:
     UINT32 m_monitorLockContentionCount;
     static UINT64 s_monitorLockContentionCountOverflow;
 
+    // Odd while a thread-local count is being folded into its overflow count, see
+    // BeginFoldThreadLocalCounts.  Lets GetTotalCount sum the counts without the
+    // thread store lock and retry if a fold raced with it.
+    static Volatile<LONG> s_threadLocalCountsVersion;
+
 #ifndef DACCESS_COMPILE
 private:
     static UINT32 *GetThreadLocalCountRef(Thread *pThread, SIZE_T threadLocalCountOffset)
@@ -3919,8 +3944,15 @@ private:
     }
 
     static UINT64 GetTotalCount(SIZE_T threadLocalCountOffset, UINT64 *overflowCount);
+    static UINT64 GetTotalCount(const SIZE_T *threadLocalCountOffsets, UINT64 *const *overflowCounts, int countKinds);
+    static UINT64 SumCounts(const SIZE_T *threadLocalCountOffsets, UINT64 *const *overflowCounts, int countKinds);
 
 public:
+    // Bracket moving thread-local counts into the overflow counts, including unlinking
+    // a thread whose counts were folded.  Must be called inside the thread store lock.
+    static void BeginFoldThreadLocalCounts();
+    static void EndFoldThreadLocalCounts();
+
     static void IncrementWorkerThreadPoolCompletionCount(Thread *pThread)
     {
         WRAPPER_NO_CONTRACT;
@@ -5120,6 +5152,14 @@ public:
     static Thread *GetAllThreadList(Thread *Prev, ULONG mask, ULONG bits);
     static Thread *GetThreadList(Thread *Prev);
 
+    // Readers that only need the threads they visit to stay allocated, rather than
+    // a list that cannot change underneath them, may walk it between EnterReader and
+    // LeaveReader (see ThreadStoreReaderHolder) instead of taking the critical section.
+    // Threads may be added or removed during the walk, but a removed Thread is not
+    // deleted until every reader that could still reach it has left.
+    static LONG EnterReader();
+    static void LeaveReader(LONG epoch);
+
     // Every EE process can lazily create a GUID that uniquely identifies it (for
     // purposes of remoting).
     const GUID    &GetUniqueEEId();
@@ -5158,12 +5198,32 @@ private:
     void Enter();
     void Leave();
 
+    // Unlink a Thread whose last external reference went away and delete it once no
+    // lock-free reader can reach it anymore.  Must be called inside the critical section.
+    static void RetireThread(Thread *thread);
+    void ReclaimRetiredThreads();
+
     // Critical section for adding and removing threads to the store
     Crst        m_Crst;
 
     // List of all the threads known to the ThreadStore (started & unstarted).
     ThreadList  m_ThreadList;
 
+    // Epoch based reclamation of the Thread objects in m_ThreadList.  Lock-free
+    // readers count themselves in m_ReaderCount[m_ReaderEpoch].  Threads retired
+    // during the current epoch wait in m_RetiredThreads; the epoch only flips once
+    // the readers of the previous one have drained, at which point the threads in
+    // m_PreviousRetiredThreads can no longer be reached and are deleted.
+    Volatile<LONG> m_ReaderEpoch;
+    Volatile<LONG> m_ReaderCount[2];
+    Thread     *m_RetiredThreads;
+    Thread     *m_PreviousRetiredThreads;
+
+    // Set by the last reader of the previous epoch when retired threads are waiting
+    // on it, so that the finalizer thread reclaims them without waiting for the next
+    // thread to die.
+    bool        m_ReclaimRetiredThreads;
+
     // m_ThreadCount is the count of all threads in m_ThreadList.  This includes
     // background threads / unstarted threads / whatever.
     //
@@ -5309,6 +5369,8 @@ public:
     void OnMaxGenerationGCStarted();
     bool ShouldTriggerGCForDeadThreads();
     void TriggerGCForDeadThreadsIfNecessary();
+    bool ShouldReclaimRetiredThreads();
+    void ReclaimRetiredThreadsIfNecessary();
 };
 
 struct TSSuspendHelper {
@@ -5319,6 +5381,26 @@ typedef StateHolder<TSSuspendHelper::SetTrap, TSSuspendHelper::UnsetTrap> TSSusp
 
 typedef StateHolder<ThreadStore::LockThreadStore,ThreadStore::UnlockThreadStore> ThreadStoreLockHolder;
 
+// Walk the thread list without the thread store lock, see ThreadStore::EnterReader.
+class ThreadStoreReaderHolder
+{
+public:
+    ThreadStoreReaderHolder()
+    {
+        WRAPPER_NO_CONTRACT;
+        m_epoch = ThreadStore::EnterReader();
+    }
+
+    ~ThreadStoreReaderHolder()
+    {
+        WRAPPER_NO_CONTRACT;
+        ThreadStore::LeaveReader(m_epoch);
+    }
+
+private:
+    LONG m_epoch;
+};
+
 #endif
 
 // This class dispenses small thread ids for the thin lock mechanism.
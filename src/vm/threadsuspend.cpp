@@ -25,6 +25,12 @@ bool ThreadSuspend::s_fSuspendRuntimeInProgress = false;
 
 CLREvent* ThreadSuspend::g_pGCSuspendEvent = NULL;
 
+Volatile<LONG> ThreadSuspend::s_cRendezvousPending = 0;
+Volatile<LONG> ThreadSuspend::s_cRendezvousWakeThreshold = 0;
+bool ThreadSuspend::s_fBatchedRendezvous = true;
+bool ThreadSuspend::s_fTraceRendezvous = false;
+LONGLONG ThreadSuspend::s_rendezvousStartTicks = 0;
+
 ThreadSuspend::SUSPEND_REASON ThreadSuspend::m_suspendReason;
 Thread* ThreadSuspend::m_pThreadAttemptingSuspendForGC;
 
@@ -59,6 +65,10 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+// With batched rendezvous, how long to wait for acknowledgements before rescanning the threads
+// for ones that left cooperative mode without acknowledging.
+#define RENDEZVOUS_RESCAN_TIMEOUT   1
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -2908,8 +2918,12 @@ void Thread::RareEnablePreemptiveGC()
         UnhijackThread();
 #endif // FEATURE_HIJACK
 
-        // wake up any threads waiting to suspend us, like the GC thread.
-        ThreadSuspend::g_pGCSuspendEvent->Set();
+        // wake up any threads waiting to suspend us, like the GC thread. With batched rendezvous,
+        // the suspending thread only needs to wake up once enough of the threads it waits for got here.
+        if (ThreadSuspend::AcknowledgeRendezvous(this) || !ThreadSuspend::s_fBatchedRendezvous)
+        {
+            ThreadSuspend::g_pGCSuspendEvent->Set();
+        }
 
         // for GC, the fact that we are leaving the EE means that it no longer needs to
         // suspend us.  But if we are doing a non-GC suspend, we need to block now.
@@ -3766,6 +3780,102 @@ COR_PRF_SUSPEND_REASON GCSuspendReasonToProfSuspendReason(ThreadSuspend::SUSPEND
 }
 #endif // PROFILING_SUPPORTED
 
+//----------------------------------------------------------------------------
+//
+// ArmRendezvous - registers a thread SuspendRuntime is going to wait for
+//
+// The count goes up before the thread is marked, so that the thread acknowledging
+// the rendezvous right away cannot take the count to zero while it is still
+// being waited for.
+//
+//----------------------------------------------------------------------------
+void ThreadSuspend::ArmRendezvous(Thread *pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    FastInterlockIncrement(&s_cRendezvousPending);
+
+    if (FastInterlockExchange(&pThread->m_fRendezvousPending, 1) != 0)
+    {
+        // Already waited for
+        FastInterlockDecrement(&s_cRendezvousPending);
+    }
+}
+
+//----------------------------------------------------------------------------
+//
+// AcknowledgeRendezvous - records that a thread reached a GC safe point
+//
+// Called by the thread itself when it leaves cooperative mode, and by
+// SuspendRuntime when it finds the thread in preemptive mode. Only the first
+// of the two counts. Returns true if SuspendRuntime should wake up, i.e. the
+// count of threads it waits for dropped to s_cRendezvousWakeThreshold.
+//
+//----------------------------------------------------------------------------
+bool ThreadSuspend::AcknowledgeRendezvous(Thread *pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pThread->m_fRendezvousPending == 0 ||
+        FastInterlockExchange(&pThread->m_fRendezvousPending, 0) == 0)
+    {
+        return false;
+    }
+
+    if (s_fTraceRendezvous)
+    {
+        LARGE_INTEGER ticks;
+        QueryPerformanceCounter(&ticks);
+        pThread->m_rendezvousTicks = ticks.QuadPart;
+    }
+
+    return FastInterlockDecrement(&s_cRendezvousPending) <= s_cRendezvousWakeThreshold;
+}
+
+//----------------------------------------------------------------------------
+//
+// CancelRendezvous - unregisters a thread that turned out not to need waiting for
+//
+//----------------------------------------------------------------------------
+void ThreadSuspend::CancelRendezvous(Thread *pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (FastInterlockExchange(&pThread->m_fRendezvousPending, 0) != 0)
+    {
+        FastInterlockDecrement(&s_cRendezvousPending);
+    }
+}
+
+//----------------------------------------------------------------------------
+//
+// TraceRendezvousTimes - fires a GCThreadRendezvous event for every thread
+// that had to be waited for by the suspension that just completed
+//
+//----------------------------------------------------------------------------
+void ThreadSuspend::TraceRendezvousTimes()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static LARGE_INTEGER freq;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+
+    Thread *thread = NULL;
+    while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+    {
+        if (thread->m_rendezvousTicks == 0)
+            continue;
+
+        LONGLONG elapsedTicks = thread->m_rendezvousTicks - s_rendezvousStartTicks;
+        ULONGLONG elapsedNs = (ULONGLONG)((double)max(elapsedTicks, (LONGLONG)0) * 1000000000.0 / freq.QuadPart);
+
+        FireEtwGCThreadRendezvous((ULONGLONG)thread->GetOSThreadId64(), elapsedNs, GetClrInstanceId());
+
+        thread->m_rendezvousTicks = 0;
+    }
+}
+
 //************************************************************************************
 //
 // SuspendRuntime is responsible for ensuring that all managed threads reach a
@@ -3891,6 +4001,19 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
     ::FlushProcessWriteBuffers();
 
+    // Threads that are found in cooperative mode below are registered in s_cRendezvousPending. The
+    // extra count keeps the last of them from signaling g_pGCSuspendEvent before the pass is over.
+    s_cRendezvousPending = 1;
+    s_cRendezvousWakeThreshold = 0;
+
+    s_fTraceRendezvous = ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, GCThreadRendezvous);
+    if (s_fTraceRendezvous)
+    {
+        LARGE_INTEGER ticks;
+        QueryPerformanceCounter(&ticks);
+        s_rendezvousStartTicks = ticks.QuadPart;
+    }
+
     //
     // Make a pass through all threads.  We do a couple of things here:
     // 1) we count the number of threads that are observed to be in cooperative mode.
@@ -3938,6 +4061,11 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             //
             // <TODO> Need more careful review of this </TODO>
             //
+            // The thread is registered for the rendezvous before checking its mode again. A
+            // thread leaving cooperative mode concurrently then either acknowledges the
+            // rendezvous or is seen in preemptive mode here.
+            //
+            ArmRendezvous(thread);
             FastInterlockOr(&thread->m_fPreemptiveGCDisabled, 0);
 
             if (thread->m_fPreemptiveGCDisabled)
@@ -3953,6 +4081,10 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 }
 #endif // FEATURE_HIJACK && PLATFORM_UNIX
             }
+            else
+            {
+                CancelRendezvous(thread);
+            }
 
 #else // DISABLE_THREADSUSPEND
 
@@ -4041,6 +4173,10 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
                 countThreads++;
 
+                // If the thread did not get suspended, it may leave cooperative mode before this
+                // without acknowledging the rendezvous; the next pass below will find it then.
+                ArmRendezvous(thread);
+
                 // Only resume if we actually suspended the thread above.
                 if (str == Thread::STR_Success)
                     thread->ResumeThread();
@@ -4087,6 +4223,13 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
 #endif
 
+    // Drop the extra count. If it was the last one, every thread already reached a safe point and
+    // the pass below will find them all in preemptive mode.
+    FastInterlockDecrement(&s_cRendezvousPending);
+
+    // Time at which threads still in cooperative mode were last hijacked or sent an activation
+    DWORD lastPingTime = GetTickCount();
+
     //
     // Now we keep retrying until we find that no threads are in cooperative mode.  This should be merged into 
     // the first loop.
@@ -4112,6 +4255,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                         thread->SetThreadState(Thread::TS_GCSuspendPending);
                         countThreads ++;
                     }
+                    ArmRendezvous(thread);
                     thread->ResetThreadState(Thread::TS_BlockGCForSO);
                     FastInterlockOr (&thread->m_fPreemptiveGCDisabled, 1);
                 }
@@ -4127,6 +4271,7 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Thread %x went preemptive it is at a GC safe point\n", thread);
                 countThreads--;
                 thread->ResetThreadState(Thread::TS_GCSuspendPending);
+                AcknowledgeRendezvous(thread);
             }
         }
 
@@ -4159,6 +4304,14 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             }
 #endif // PROFILING_SUPPORTED
 
+            // Leave no thread registered for the rendezvous, the next attempt starts over
+            _ASSERTE (thread == NULL);
+            while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+            {
+                CancelRendezvous(thread);
+                thread->m_rendezvousTicks = 0;
+            }
+
             STRESS_LOG0(LF_SYNC, LL_ALWAYS, "Thread::SuspendRuntime() - Timing out.\n");
             return (ERROR_TIMEOUT);
         }
@@ -4183,8 +4336,39 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         //
         // For now, we simply wait.
         //
+        // With batched rendezvous, acknowledging threads wake us up once half of the threads still
+        // pending got to a safe point. Threads that leave cooperative mode without acknowledging (inlined
+        // N/Direct, or the fast path of EnablePreemptiveGC racing with the first pass) are only found by
+        // rescanning, so wait in slices of RENDEZVOUS_RESCAN_TIMEOUT and ping the threads every
+        // PING_JIT_TIMEOUT as before.
+        //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        DWORD waitTimeout = PING_JIT_TIMEOUT;
+        bool fRescanOnly = false;
+        if (s_fBatchedRendezvous)
+        {
+            LONG wakeThreshold = s_cRendezvousPending / 2;
+            FastInterlockExchange(&s_cRendezvousWakeThreshold, wakeThreshold);
+
+            DWORD sinceLastPing = GetTickCount() - lastPingTime;
+            if (sinceLastPing < PING_JIT_TIMEOUT)
+            {
+                waitTimeout = min((DWORD)(PING_JIT_TIMEOUT - sinceLastPing), (DWORD)RENDEZVOUS_RESCAN_TIMEOUT);
+                fRescanOnly = true;
+            }
+            else
+            {
+                waitTimeout = 0;
+            }
+
+            // Acknowledgements that came in before the threshold was published did not wake us up
+            if (wakeThreshold > 0 && s_cRendezvousPending <= wakeThreshold)
+            {
+                waitTimeout = 0;
+            }
+        }
+
+        res = g_pGCSuspendEvent->Wait(waitTimeout, FALSE);
 
 
 #ifdef TIME_SUSPEND
@@ -4197,9 +4381,17 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
             g_SuspendStatistics.cntWaitTimeouts++;
 #endif
 
+        if ((res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION) &&
+            fRescanOnly && GetTickCount() - lastPingTime < PING_JIT_TIMEOUT)
+        {
+            // Not time to ping the threads yet, only look for ones that went preemptive
+            continue;
+        }
+        else
         if (res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION)
         {
             STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Timed out waiting for rendezvous event %d threads remaining\n", countThreads);
+            lastPingTime = GetTickCount();
 #ifdef _DEBUG
             DWORD dbgEndTimeout = GetTickCount();
 
@@ -4378,6 +4570,11 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     // We know all threads are in preemptive mode, so go ahead and reset the event.  
     g_pGCSuspendEvent->Reset();
 
+    if (s_fTraceRendezvous)
+    {
+        TraceRendezvousTimes();
+    }
+
 #ifdef HAVE_GCCOVER
     //
     // Now that the EE has been suspended, let's see if any oustanding
@@ -6202,9 +6399,11 @@ BOOL Thread::HandledJITCase(BOOL ForTaskSwitchIn)
             // On platforms that support both hijacking and GC polling
             // decide whether to hijack based on a configuration value.  
             // COMPlus_GCPollType = 1 is the setting that enables hijacking
-            // in GCPOLL enabled builds.
+            // in GCPOLL enabled builds.  COMPlus_GCPollType = 4 only polls at
+            // loop back edges and still relies on hijacking for returns.
             EEConfig::GCPollType pollType = g_pConfig->GetGCPollType();
-            if (EEConfig::GCPOLL_TYPE_HIJACK == pollType || EEConfig::GCPOLL_TYPE_DEFAULT == pollType)
+            if (EEConfig::GCPOLL_TYPE_HIJACK == pollType || EEConfig::GCPOLL_TYPE_DEFAULT == pollType ||
+                EEConfig::GCPOLL_TYPE_LOOPS == pollType)
 #endif // FEATURE_ENABLE_GCPOLL
             {
                 HijackThread(pvHijackAddr, &esb);
@@ -6781,6 +6980,8 @@ bool Thread::InjectGcSuspension()
 // Initialize thread suspension support
 void ThreadSuspend::Initialize()
 {
+    s_fBatchedRendezvous = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadSuspendBatchedRendezvous) != 0;
+
 #if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
     ::PAL_SetActivationFunction(HandleGCSuspensionForInterruptedThread, CheckActivationSafePoint);
 #endif
@@ -202,6 +202,33 @@ public:
 private:
     static CLREvent * g_pGCSuspendEvent;
 
+    // Number of threads SuspendRuntime is still waiting on to reach a GC safe point, plus one while
+    // it is still making its first pass over the threads. A thread that acknowledges the rendezvous
+    // signals g_pGCSuspendEvent only once the count drops to s_cRendezvousWakeThreshold, so that the
+    // suspending thread is woken up a few times rather than once per thread.
+    static Volatile<LONG> s_cRendezvousPending;
+
+    // Count at which acknowledging threads wake up SuspendRuntime, set to half of the threads still
+    // pending before each wait. Threads that leave cooperative mode without acknowledging (e.g. through
+    // inlined N/Direct) stay in the count until a rescan finds them, see SuspendRuntime.
+    static Volatile<LONG> s_cRendezvousWakeThreshold;
+
+    // Whether threads acknowledge the rendezvous in batches, see INTERNAL_ThreadSuspendBatchedRendezvous.
+    // g_pGCSuspendEvent is then signaled by the thread that brings s_cRendezvousPending down to
+    // s_cRendezvousWakeThreshold, and SuspendRuntime rescans the threads between short waits to
+    // find the ones that did not acknowledge. Otherwise every thread leaving cooperative mode signals it.
+    static bool s_fBatchedRendezvous;
+
+    // Whether per thread rendezvous times are being recorded for the GCThreadRendezvous event, and the
+    // performance counter value at which the current suspension started
+    static bool s_fTraceRendezvous;
+    static LONGLONG s_rendezvousStartTicks;
+
+    static void ArmRendezvous(Thread *pThread);
+    static bool AcknowledgeRendezvous(Thread *pThread);
+    static void CancelRendezvous(Thread *pThread);
+    static void TraceRendezvousTimes();
+
     // This is true iff we're currently in the process of suspending threads.  Once the
     // threads have been suspended, this is false.  This is set via an instance of
     // SuspendRuntimeInProgressHolder placed in SuspendRuntime, SysStartSuspendForDebug,
@@ -43,6 +43,10 @@
 // QueueUserWorkItem to recruit one. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
 // queue another threadpool work item if m_methodsToOptimize hasn't been drained.
+// When the queue builds up faster than a single worker drains it (for instance
+// when the tiering delay expires after startup) additional workers are recruited
+// the same way, up to TC_BackgroundWorkerCount, as long as the machine has spare
+// CPU capacity.
 //
 // The background thread enters at StaticOptimizeMethodsCallback(), enters the
 // appdomain, and then begins calling OptimizeMethod on each method in the
@@ -271,7 +275,8 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
     // unserviced. Synchronous retries appear unlikely to offer any material improvement 
     // and complicating the code to narrow an already rare error case isn't desirable.
     {
-        SListElem<NativeCodeVersion>* pMethodListItem = new (nothrow) SListElem<NativeCodeVersion>(t1NativeCodeVersion);
+        SListElem<MethodToOptimize>* pMethodListItem =
+            new (nothrow) SListElem<MethodToOptimize>(MethodToOptimize(t1NativeCodeVersion, GetTickCount()));
         CrstHolder holder(&m_lock);
         if (pMethodListItem != NULL)
         {
@@ -637,6 +642,8 @@ void TieredCompilationManager::OptimizeMethods()
         GCX_PREEMP();
         while (true)
         {
+            bool recruitWorker;
+            DWORD queuedTickCount;
             {
                 CrstHolder holder(&m_lock);
 
@@ -646,21 +653,39 @@ void TieredCompilationManager::OptimizeMethods()
                     break;
                 }
 
-                nativeCodeVersion = GetNextMethodToOptimize();
+                nativeCodeVersion = GetNextMethodToOptimize(&queuedTickCount);
                 if (nativeCodeVersion.IsNull())
                 {
                     DecrementWorkerThreadCount();
                     break;
                 }
+
+                recruitWorker = IncrementWorkerThreadCountIfNeeded();
+            }
+
+            // Share a large backlog with another worker
+            if (recruitWorker && !TryAsyncOptimizeMethods())
+            {
+                CrstHolder holder(&m_lock);
+                DecrementWorkerThreadCount();
             }
 
+            DWORD optimizeStartTickCount = GetTickCount();
             OptimizeMethod(nativeCodeVersion);
             ++jittedMethodCount;
+            DWORD currentTickCount = GetTickCount();
+
+            if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
+            {
+                ETW::CompilationLog::TieredCompilation::Runtime::SendBackgroundJitMethod(
+                    nativeCodeVersion.GetMethodDesc(),
+                    optimizeStartTickCount - queuedTickCount,
+                    currentTickCount - optimizeStartTickCount);
+            }
 
             // If we have been running for too long return the thread to the threadpool and queue another event
             // This gives the threadpool a chance to service other requests on this thread before returning to
             // this work.
-            DWORD currentTickCount = GetTickCount();
             if (currentTickCount - startTickCount >= OptimizationQuantumMs)
             {
                 if (!TryAsyncOptimizeMethods())
@@ -797,17 +822,20 @@ void TieredCompilationManager::ActivateCodeVersion(NativeCodeVersion nativeCodeV
     }
 }
 
-// Dequeues the next method in the optmization queue.
+// Dequeues the next method in the optmization queue, along with the
+// tick count at which it was queued.
 // This should be called with m_lock already held and runs
 // on the background thread.
-NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize()
+NativeCodeVersion TieredCompilationManager::GetNextMethodToOptimize(DWORD* queuedTickCountRef)
 {
     STANDARD_VM_CONTRACT;
+    _ASSERTE(queuedTickCountRef != NULL);
 
-    SListElem<NativeCodeVersion>* pElem = m_methodsToOptimize.RemoveHead();
+    SListElem<MethodToOptimize>* pElem = m_methodsToOptimize.RemoveHead();
     if (pElem != NULL)
     {
-        NativeCodeVersion nativeCodeVersion = pElem->GetValue();
+        NativeCodeVersion nativeCodeVersion = pElem->GetValue().nativeCodeVersion;
+        *queuedTickCountRef = pElem->GetValue().queuedTickCount;
         delete pElem;
         --m_countOfMethodsToOptimize;
         return nativeCodeVersion;
@@ -820,17 +848,32 @@ bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
     WRAPPER_NO_CONTRACT;
     // m_lock should be held
 
-    if (0 == m_countOptimizationThreadsRunning &&
-        !m_isAppDomainShuttingDown &&
-        !m_methodsToOptimize.IsEmpty() &&
-        !IsTieringDelayActive())
+    if (m_isAppDomainShuttingDown ||
+        m_methodsToOptimize.IsEmpty() ||
+        IsTieringDelayActive())
     {
-        // Our current policy throttles at 1 thread, but in the future we
-        // could experiment with more parallelism.
-        m_countOptimizationThreadsRunning++;
-        return true;
+        return false;
     }
-    return false;
+
+    if (m_countOptimizationThreadsRunning != 0)
+    {
+        // Only recruit an additional worker when the backlog is large enough to keep it busy, the configured
+        // limit has not been reached, and the machine has spare CPU capacity, so that background jitting
+        // doesn't compete with foreground work. Until the gate thread has sampled the CPU utilization there
+        // is no evidence of spare capacity, so stay with the existing workers.
+        const UINT32 MethodsToOptimizePerWorker = 8;
+        LONG cpuUtilization;
+        if (m_countOptimizationThreadsRunning >= g_pConfig->TieredCompilation_BackgroundWorkerCount() ||
+            m_countOfMethodsToOptimize <= m_countOptimizationThreadsRunning * MethodsToOptimizePerWorker ||
+            !ThreadpoolMgr::TryGetCPUUtilization(&cpuUtilization) ||
+            cpuUtilization >= CpuUtilizationLow)
+        {
+            return false;
+        }
+    }
+
+    m_countOptimizationThreadsRunning++;
+    return true;
 }
 
 void TieredCompilationManager::DecrementWorkerThreadCount()
@@ -53,7 +53,7 @@ private:
     void OptimizeMethodsCallback();
     void OptimizeMethods();
     void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
-    NativeCodeVersion GetNextMethodToOptimize();
+    NativeCodeVersion GetNextMethodToOptimize(DWORD* queuedTickCountRef);
     BOOL CompileCodeVersion(NativeCodeVersion nativeCodeVersion);
     void ActivateCodeVersion(NativeCodeVersion nativeCodeVersion);
 
@@ -63,8 +63,22 @@ private:
     DWORD DebugGetWorkerThreadCount();
 #endif
 
+    // An entry in the optimization queue. The tick count at which the method was queued is kept so that the
+    // background jit events can report how long each method waited before being optimized.
+    struct MethodToOptimize
+    {
+        NativeCodeVersion nativeCodeVersion;
+        DWORD queuedTickCount;
+
+        MethodToOptimize(NativeCodeVersion nativeCodeVersion, DWORD queuedTickCount)
+            : nativeCodeVersion(nativeCodeVersion), queuedTickCount(queuedTickCount)
+        {
+            LIMITED_METHOD_CONTRACT;
+        }
+    };
+
     Crst m_lock;
-    SList<SListElem<NativeCodeVersion>> m_methodsToOptimize;
+    SList<SListElem<MethodToOptimize>> m_methodsToOptimize;
     UINT32 m_countOfMethodsToOptimize;
     BOOL m_isAppDomainShuttingDown;
     DWORD m_countOptimizationThreadsRunning;
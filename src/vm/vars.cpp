@@ -144,7 +144,8 @@ SpinConstants g_SpinConstants = {
     40000,     // dwMaximumDuration - ideally (20000 * max(2, numProc))
     3,         // dwBackoffFactor
     10,        // dwRepetitions
-    0          // dwMonitorSpinCount
+    0,         // dwMonitorSpinCount
+    0          // dwMonitorThinLockYieldCount
 };
 
 // support for Event Tracing for Windows (ETW)
@@ -32,6 +32,7 @@ UINT32 g_site_counter = 0;              //# of call sites
 UINT32 g_site_write = 0;                //# of call site backpatch writes
 UINT32 g_site_write_poly = 0;           //# of call site backpatch writes to point to resolve stubs
 UINT32 g_site_write_mono = 0;           //# of call site backpatch writes to point to dispatch stubs
+UINT32 g_site_write_chain = 0;          //# of call site backpatch writes to extend a chain of dispatch stubs
 
 UINT32 g_stub_lookup_counter = 0;       //# of lookup stubs
 UINT32 g_stub_mono_counter = 0;         //# of dispatch stubs
@@ -112,6 +113,8 @@ DispatchCache *g_resolveCache = NULL;    //cache of dispatch stubs for in line l
 
 size_t g_dispatch_cache_chain_success_counter = CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT;
 
+UINT32 VirtualCallStubManager::s_polymorphicSiteMaxEntries = 4;
+
 #ifdef STUB_LOGGING 
 UINT32 g_resetCacheCounter;
 UINT32 g_resetCacheIncr;
@@ -227,6 +230,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", g_site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", g_site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), "\r\n%-30s %d\r\n", "reclaim_counter", g_reclaim_counter);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -889,6 +894,8 @@ void VirtualCallStubManager::InitStatic()
     g_resetCacheIncr       = (INT32) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubResetCacheIncr);
 #endif // STUB_LOGGING
 
+    s_polymorphicSiteMaxEntries = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubPolymorphicMax);
+
 #ifndef STUB_DISPATCH_PORTABLE
     DispatchHolder::InitializeStatic();
     ResolveHolder::InitializeStatic();
@@ -1514,8 +1521,8 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     if (kind == SK_DISPATCH)
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
-        DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        UINT32 cEntries;
+        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(pMgr->GetDispatchChainFailEntry(stub, &cEntries));
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -1672,15 +1679,13 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
     VirtualCallStubManager *pMgr = VirtualCallStubManager::FindStubManager(callSiteTarget, &stubKind);
     PREFIX_ASSUME(pMgr != NULL);
 
+    BOOL fBackPatchSite = FALSE;
 #ifndef _TARGET_X86_ 
     // Have we failed the dispatch stub too many times?
-    if (flags & SDF_ResolveBackPatch)
-    {
-        pMgr->BackPatchWorker(&callSite);
-    }
+    fBackPatchSite = (flags & SDF_ResolveBackPatch) != 0;
 #endif
 
-    target = pMgr->ResolveWorker(&callSite, protectedObj, representativeToken, stubKind);
+    target = pMgr->ResolveWorker(&callSite, protectedObj, representativeToken, stubKind, fBackPatchSite);
 
     GCPROTECT_END();
 
@@ -1726,7 +1731,8 @@ void BackPatchWorkerStaticStub(PCODE returnAddr, TADDR siteAddrForRegisterIndire
 PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
                                             OBJECTREF *protectedObj,
                                             DispatchToken token,
-                                            StubKind stubKind)
+                                            StubKind stubKind,
+                                            BOOL fBackPatchSite)
 {
     CONTRACTL {
         THROWS;
@@ -1812,6 +1818,7 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
     PCODE stub = CALL_STUB_EMPTY_ENTRY;
     PCODE target = NULL;
     BOOL patch = FALSE;
+    BOOL fExtendedSite = FALSE;
 
     // This code can throw an OOM, but we do not want to fail in this case because
     // we must always successfully determine the target of a virtual call so that
@@ -1915,6 +1922,13 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
 
         if (target != NULL)
         {
+            // The dispatch stubs at this call site have missed too often. Rather than sending every call
+            // through the resolve stub, try to handle this receiver type inline as well.
+            if (fBackPatchSite && patch && bCreateDispatchStub && stubKind == SK_DISPATCH)
+            {
+                fExtendedSite = ExtendPolymorphicSite(pCallSite, objectType, token, target);
+            }
+
             if (patch)
             {
                 // NOTE: This means that we are sharing dispatch stubs among callsites. If we decide we don't want
@@ -2152,6 +2166,12 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
     }
     EX_END_CATCH (SwallowAllExceptions);
 
+    // If the call site could not be made polymorphic, switch it over to the resolve stub
+    if (fBackPatchSite && !fExtendedSite)
+    {
+        BackPatchWorker(pCallSite);
+    }
+
     // Target can be NULL only if we can't resolve to an address
     _ASSERTE(target != NULL);
 
@@ -2649,8 +2669,9 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
         //yes, patch it to point to the resolve stub
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
-        //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
+        //We find the correct resolve stub by following the failure path in the dispatcher stubs themselves
+        UINT32 cEntries;
+        PCODE failEntry    = GetDispatchChainFailEntry(callSiteTarget, &cEntries);
         ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
@@ -2717,6 +2738,150 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     pCallSite->SetSiteTarget(patch);
 
     stats.site_write++;
+
+    LogSiteTransition(pCallSite, prior, patch);
+}
+
+//----------------------------------------------------------------------------
+/* The dispatch stubs at the call site keep failing their expected MT test. If the call
+site has only seen a few receiver types, put a new dispatch stub for pMT in front of the
+dispatch stubs already there instead of switching the call site over to the resolve stub.
+These dispatch stubs are specific to the call site, so they are not added to the
+dispatchers table. Returns TRUE if the call site was changed.
+*/
+BOOL VirtualCallStubManager::ExtendPolymorphicSite(StubCallSite* pCallSite,
+                                                   MethodTable*  pMT,
+                                                   DispatchToken token,
+                                                   PCODE         target)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(CheckPointer(pMT));
+        PRECONDITION(target != NULL);
+    } CONTRACTL_END
+
+    PCODE prior = pCallSite->GetSiteTarget();
+    if (!isDispatchingStub(prior))
+        return FALSE;
+
+    UINT32 cEntries;
+    PCODE failEntry = GetDispatchChainFailEntry(prior, &cEntries);
+    if (cEntries >= s_polymorphicSiteMaxEntries)
+        return FALSE;
+
+    bool reenteredCooperativeGCMode = false;
+    DispatchHolder *pDispatchHolder = GenerateDispatchStub(
+        target, prior, pMT, token.To_SIZE_T(), &reenteredCooperativeGCMode);
+    PCODE stub = pDispatchHolder->stub()->entryPoint();
+
+    // Another thread may have changed the call site in the meantime; the new stub is
+    // then simply not used
+    PTR_PCODE pCell = pCallSite->GetIndirectCell();
+    if (!EnsureWritablePagesNoThrow(pCell, sizeof(PCODE)) ||
+        InterlockedCompareExchangeT(pCell, stub, prior) != prior)
+    {
+        return FALSE;
+    }
+
+    LOG((LF_STUBS, LL_INFO10000, "ExtendPolymorphicSite call-site" FMT_ADDR "dispatchStub" FMT_ADDR "entries %d\n",
+         DBG_ADDR(pCallSite->GetReturnAddress()), DBG_ADDR(pDispatchHolder->stub()), cEntries + 1));
+
+    //Give the longer chain a fresh set of misses before the call site is considered for
+    //extension again, same as BackPatchWorker does when it switches to the resolve stub
+    INT32* counter = ResolveHolder::FromFailEntry(failEntry)->stub()->pCounter();
+    *counter += STUB_MISS_COUNT_VALUE;
+
+    stats.site_write++;
+    stats.site_write_chain++;
+
+    LogSiteTransition(pCallSite, prior, stub);
+
+    return TRUE;
+}
+
+//----------------------------------------------------------------------------
+PCODE VirtualCallStubManager::GetDispatchChainFailEntry(PCODE dispatchEntry, UINT32 *pcEntries)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+        PRECONDITION(isDispatchingStub(dispatchEntry));
+        PRECONDITION(CheckPointer(pcEntries));
+    } CONTRACTL_END
+
+    UINT32 cEntries = 0;
+    PCODE failEntry = dispatchEntry;
+    do
+    {
+        failEntry = DispatchHolder::FromDispatchEntry(failEntry)->stub()->failTarget();
+        cEntries++;
+    }
+    while (isDispatchingStub(failEntry));
+
+    _ASSERTE(isResolvingStub(failEntry));
+    *pcEntries = cEntries;
+    return failEntry;
+}
+
+//----------------------------------------------------------------------------
+VirtualCallStubManager::SiteKind VirtualCallStubManager::GetSiteKind(PCODE stub, UINT32 *pcEntries)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    *pcEntries = 0;
+
+    if (isDispatchingStub(stub))
+    {
+        GetDispatchChainFailEntry(stub, pcEntries);
+        return (*pcEntries > 1) ? SITE_POLYMORPHIC_DISPATCH : SITE_DISPATCH;
+    }
+
+    if (isResolvingStub(stub))
+        return SITE_RESOLVE;
+
+    // Lookup stubs, and anything the call site pointed at before we first saw it
+    return SITE_LOOKUP;
+}
+
+//----------------------------------------------------------------------------
+void VirtualCallStubManager::LogSiteTransition(StubCallSite* pCallSite, PCODE prior, PCODE stub)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+#ifdef FEATURE_EVENT_TRACE
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PRIVATE_PROVIDER_DOTNET_Context, VirtualStubDispatchSiteTransition))
+        return;
+
+    UINT32 cPriorEntries;
+    UINT32 cEntries;
+    SiteKind priorKind = GetSiteKind(prior, &cPriorEntries);
+    SiteKind newKind = GetSiteKind(stub, &cEntries);
+    if (newKind == SITE_LOOKUP)
+        return;
+
+    size_t token = GetTokenFromStubQuick(this, stub, (newKind == SITE_RESOLVE) ? SK_RESOLVE : SK_DISPATCH);
+
+    FireEtwVirtualStubDispatchSiteTransition(
+        (const void *)pCallSite->GetIndirectCell(),
+        (ULONGLONG)token,
+        priorKind,
+        newKind,
+        cEntries,
+        GetClrInstanceId());
+#endif // FEATURE_EVENT_TRACE
 }
 
 //----------------------------------------------------------------------------
@@ -3143,6 +3308,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", stats.site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", stats.site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), "\r\nstub data\r\n");
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
@@ -3185,6 +3352,7 @@ void VirtualCallStubManager::LogStats()
     g_site_write += stats.site_write;
     g_site_write_poly += stats.site_write_poly;
     g_site_write_mono += stats.site_write_mono;
+    g_site_write_chain += stats.site_write_chain;
     g_worker_call += stats.worker_call;
     g_worker_call_no_patch += stats.worker_call_no_patch;
     g_worker_collide_to_mono += stats.worker_collide_to_mono;
@@ -3200,6 +3368,7 @@ void VirtualCallStubManager::LogStats()
     stats.site_write = 0;
     stats.site_write_poly = 0;
     stats.site_write_mono = 0;
+    stats.site_write_chain = 0;
     stats.worker_call = 0;
     stats.worker_call_no_patch = 0;
     stats.worker_collide_to_mono = 0;
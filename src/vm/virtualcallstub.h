@@ -208,9 +208,15 @@ typedef VPTR(class VirtualCallStubManager) PTR_VirtualCallStubManager;
 //     * On first call they get updated into a dispatch stub. When this misses, it calls a resolve stub,
 //         which populates a resovle stub's cache, but does not update the call site' cell (thus it is still
 //         pointing at the dispatch cell.
-//     * After code:STUB_MISS_COUNT_VALUE misses, we update the call site's cell to point directly at the
-//         resolve stub (thus avoiding the overhead of the quick check that always seems to be failing and
-//         the miss count update).
+//     * After code:STUB_MISS_COUNT_VALUE misses, if the call site has seen only a few receiver types we
+//         put another dispatch stub for the missing type in front of the ones already there (see
+//         code:VirtualCallStubManager.ExtendPolymorphicSite). These extra dispatch stubs are private to
+//         the call site and fail over to the next stub in the chain, the last one failing over to the
+//         shared resolve stub as before.
+//     * Once the chain holds code:VirtualCallStubManager.s_polymorphicSiteMaxEntries types, the next time
+//         the miss count runs out we update the call site's cell to point directly at the resolve stub
+//         (thus avoiding the overhead of the quick checks that always seem to be failing and the miss
+//         count update).
 //         
 // QUESTION: What is the lifetimes of the various stubs and hash table entries?
 // 
@@ -604,12 +610,35 @@ private:
     static void STDCALL BackPatchWorkerStatic(PCODE returnAddr, TADDR siteAddrForRegisterIndirect);
 
 public:
-    PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind);
+    PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind,
+                        BOOL fBackPatchSite = FALSE);
     void BackPatchWorker(StubCallSite* pCallSite);
 
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
+private:
+    //Put a dispatch stub for pMT in front of the dispatch stubs at the callsite
+    BOOL ExtendPolymorphicSite(StubCallSite* pCallSite, MethodTable* pMT, DispatchToken token, PCODE target);
+
+    //Follow the chain of dispatch stubs starting at dispatchEntry to the resolve stub's fail entry
+    PCODE GetDispatchChainFailEntry(PCODE dispatchEntry, UINT32 *pcEntries);
+
+    // Kinds of call site reported by the VirtualStubDispatchSiteTransition event
+    enum SiteKind
+    {
+        SITE_LOOKUP                 = 0,
+        SITE_DISPATCH               = 1,
+        SITE_POLYMORPHIC_DISPATCH   = 2,
+        SITE_RESOLVE                = 3,
+    };
+
+    SiteKind GetSiteKind(PCODE stub, UINT32 *pcEntries);
+    void LogSiteTransition(StubCallSite* pCallSite, PCODE prior, PCODE stub);
+
+    // Maximum number of dispatch stubs chained at a polymorphic call site
+    static UINT32 s_polymorphicSiteMaxEntries;
+
 public:
     /* the following two public functions are to support tracing or stepping thru
     stubs via the debugger. */
@@ -809,6 +838,7 @@ public:
         UINT32 site_write;              //# of call site backpatch writes
         UINT32 site_write_poly;         //# of call site backpatch writes to point to resolve stubs
         UINT32 site_write_mono;         //# of call site backpatch writes to point to dispatch stubs
+        UINT32 site_write_chain;        //# of call site backpatch writes to extend a chain of dispatch stubs
         UINT32 worker_call;             //# of calls into ResolveWorker
         UINT32 worker_call_no_patch;    //# of times call_worker resulted in no patch
         UINT32 worker_collide_to_mono;  //# of times we converted a poly stub to a mono stub instead of writing the cache entry
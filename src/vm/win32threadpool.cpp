@@ -93,6 +93,7 @@ SVAL_IMPL(LONG,ThreadpoolMgr,MaxLimitTotalWorkerThreads);        // = MaxLimitCP
 
 SVAL_IMPL(LONG,ThreadpoolMgr,cpuUtilization);
 LONG    ThreadpoolMgr::cpuUtilizationAverage = 0;
+Volatile<BOOL> ThreadpoolMgr::cpuUtilizationSampled = FALSE;
 
 HillClimbing ThreadpoolMgr::HillClimbingInstance;
 
@@ -107,6 +108,11 @@ unsigned int ThreadpoolMgr::WorkerThreadSpinLimit;
 bool ThreadpoolMgr::IsHillClimbingDisabled;
 int ThreadpoolMgr::ThreadAdjustmentInterval;
 
+bool ThreadpoolMgr::UseLatencyController;
+LatencyController ThreadpoolMgr::LatencyControllerInstance;
+LONG ThreadpoolMgr::NumBlockedWorkers;
+LONG ThreadpoolMgr::WorkerStarvedSince;
+
 #define INVALID_HANDLE ((HANDLE) -1)
 #define NEW_THREAD_THRESHOLD            7       // Number of requests outstanding before we start a new thread
 #define CP_THREAD_PENDINGIO_WAIT 5000           // polling interval when thread is retired but has a pending io
@@ -126,7 +132,7 @@ DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) int ThreadpoolMgr::offset_counter = 0;
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestHead);        // Head of work request queue
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestTail);        // Head of work request queue
 
-SVAL_IMPL(ThreadpoolMgr::LIST_ENTRY,ThreadpoolMgr,TimerQueue);  // queue of timers
+SVAL_IMPL(LONG,ThreadpoolMgr,TimerCount);                   // number of active timers
 
 //unsigned int ThreadpoolMgr::LastCpuSamplingTime=0;      //  last time cpu utilization was sampled by gate thread
 unsigned int ThreadpoolMgr::LastCPThreadCreation=0;     //  last time a completion port thread was created
@@ -137,16 +143,21 @@ CrstStatic ThreadpoolMgr::WorkerCriticalSection;
 CLREvent * ThreadpoolMgr::RetiredCPWakeupEvent;       // wakeup event for completion port threads
 CrstStatic ThreadpoolMgr::WaitThreadsCriticalSection;
 ThreadpoolMgr::LIST_ENTRY ThreadpoolMgr::WaitThreadsHead;
+#ifdef FEATURE_PAL
+bool ThreadpoolMgr::UseWaitPorts;
+#endif // FEATURE_PAL
 
 CLRLifoSemaphore* ThreadpoolMgr::WorkerSemaphore;
 CLRLifoSemaphore* ThreadpoolMgr::RetiredWorkerSemaphore;
 
 CrstStatic ThreadpoolMgr::TimerQueueCriticalSection;
+ThreadpoolMgr::LIST_ENTRY ThreadpoolMgr::TimerWheel[TIMER_WHEEL_SLOTS];
+DWORD ThreadpoolMgr::TimerWheelLevelCount[TIMER_WHEEL_LEVELS];
 HANDLE ThreadpoolMgr::TimerThread=NULL;
 Thread *ThreadpoolMgr::pTimerThread=NULL;
 
 // Cacheline aligned, hot variable
-DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) DWORD ThreadpoolMgr::LastTickCount;
+DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) DWORD ThreadpoolMgr::TimerWheelTime;
 
 #ifdef _DEBUG
 DWORD ThreadpoolMgr::TickCountAdjustment=0;
@@ -362,6 +373,19 @@ BOOL ThreadpoolMgr::Initialize()
         WorkerThreadSpinLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UnfairSemaphoreSpinLimit);
         IsHillClimbingDisabled = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_Disable) != 0;
         ThreadAdjustmentInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_SampleIntervalLow);
+        UseLatencyController = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UseLatencyController) != 0;
+        if (UseLatencyController)
+        {
+            LatencyControllerSettings settings;
+            settings.TargetQueueWaitMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_LatencyControllerTargetWaitMs);
+            settings.RetireDelayMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_LatencyControllerRetireDelayMs);
+            settings.MaxInjectionPerSample = (int)NumberOfProcessors;
+            settings.NumProcessors = (int)NumberOfProcessors;
+            settings.CpuUtilizationHigh = CpuUtilizationHigh;
+            LatencyControllerInstance.Initialize(settings);
+
+            ThreadAdjustmentInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_LatencyControllerSampleIntervalMs);
+        }
         
         pADTPCount->InitResources();
         WorkerCriticalSection.Init(CrstThreadpoolWorker);
@@ -370,9 +394,15 @@ BOOL ThreadpoolMgr::Initialize()
 
         // initialize WaitThreadsHead
         InitializeListHead(&WaitThreadsHead);
+#ifdef FEATURE_PAL
+        UseWaitPorts = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UseWaitPorts) != 0;
+#endif // FEATURE_PAL
 
-        // initialize TimerQueue
-        InitializeListHead(&TimerQueue);
+        // initialize the timer wheel slots
+        for (int i = 0; i < TIMER_WHEEL_SLOTS; i++)
+        {
+            InitializeListHead(&TimerWheel[i]);
+        }
 
         RetiredCPWakeupEvent = new CLREvent();
         RetiredCPWakeupEvent->CreateAutoEvent(FALSE);
@@ -946,44 +976,25 @@ void ThreadpoolMgr::AdjustMaxWorkersActive()
     {
         ThreadCounter::Counts currentCounts = WorkerCounter.GetCleanCounts();
 
-        int newMax = HillClimbingInstance.Update(
-            currentCounts.MaxWorking, 
-            elapsed, 
-            numCompletions,
-            &ThreadAdjustmentInterval);
-
-        while (newMax != currentCounts.MaxWorking)
+        if (UseLatencyController)
         {
-            ThreadCounter::Counts newCounts = currentCounts;
-            newCounts.MaxWorking = newMax;
-
-            ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, currentCounts);
-            if (oldCounts == currentCounts)
+            HillClimbingStateTransition transition;
+            int newMax = UpdateLatencyController(currentCounts, (DWORD)(elapsed * 1000.0), &transition);
+            if (newMax != currentCounts.MaxWorking)
             {
-                //
-                // If we're increasing the max, inject a thread.  If that thread finds work, it will inject
-                // another thread, etc., until nobody finds work or we reach the new maximum.
-                //
-                // If we're reducing the max, whichever threads notice this first will retire themselves.
-                //
-                if (newMax > oldCounts.MaxWorking)
-                    MaybeAddWorkingWorker();
-
-                break;
+                ChangeMaxWorkersActive(currentCounts, newMax);
+                HillClimbingInstance.ForceChange(newMax, transition);
             }
-            else
-            {
-                // we failed - maybe try again
-                if (oldCounts.MaxWorking > currentCounts.MaxWorking &&
-                    oldCounts.MaxWorking >= newMax)
-                {
-                    // someone (probably the gate thread) increased the thread count more than
-                    // we are about to do.  Don't interfere.
-                    break;
-                }
+        }
+        else
+        {
+            int newMax = HillClimbingInstance.Update(
+                currentCounts.MaxWorking, 
+                elapsed, 
+                numCompletions,
+                &ThreadAdjustmentInterval);
 
-                currentCounts = oldCounts;
-            }
+            ChangeMaxWorkersActive(currentCounts, newMax);
         }
 
         PriorCompletedWorkRequests = totalNumCompletions;
@@ -995,6 +1006,186 @@ void ThreadpoolMgr::AdjustMaxWorkersActive()
 }
 
 
+//
+// Sets MaxWorking to newMax, unless someone else raced us to a higher limit.  Must be called with
+// ThreadAdjustmentLock held.
+//
+void ThreadpoolMgr::ChangeMaxWorkersActive(ThreadCounter::Counts currentCounts, int newMax)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        if (GetThread()) { GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(ThreadAdjustmentLock.IsHeld());
+
+    while (newMax != currentCounts.MaxWorking)
+    {
+        ThreadCounter::Counts newCounts = currentCounts;
+        newCounts.MaxWorking = newMax;
+
+        ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, currentCounts);
+        if (oldCounts == currentCounts)
+        {
+            //
+            // If we're increasing the max, inject a thread.  If that thread finds work, it will inject
+            // another thread, etc., until nobody finds work or we reach the new maximum.
+            //
+            // If we're reducing the max, whichever threads notice this first will retire themselves.
+            //
+            if (newMax > oldCounts.MaxWorking)
+                MaybeAddWorkingWorker();
+
+            break;
+        }
+        else
+        {
+            // we failed - maybe try again
+            if (oldCounts.MaxWorking > currentCounts.MaxWorking &&
+                oldCounts.MaxWorking >= newMax)
+            {
+                // someone (probably the gate thread) increased the thread count more than
+                // we are about to do.  Don't interfere.
+                break;
+            }
+
+            currentCounts = oldCounts;
+        }
+    }
+}
+
+//
+// Feeds the current state of the worker pool to the LatencyController and returns the MaxWorking
+// it asks for.  Must be called with ThreadAdjustmentLock held.
+//
+int ThreadpoolMgr::UpdateLatencyController(ThreadCounter::Counts counts, DWORD elapsedMs, HillClimbingStateTransition* pTransition)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(UseLatencyController);
+    _ASSERTE(ThreadAdjustmentLock.IsHeld());
+
+    DWORD currentTicks = GetTickCount();
+    LONG starvedSince = VolatileLoad(&WorkerStarvedSince);
+
+    LatencyControllerSample sample;
+    sample.MaxWorking = counts.MaxWorking;
+    sample.NumActive = counts.NumActive;
+    sample.NumWorking = counts.NumWorking;
+    sample.NumBlocked = max(VolatileLoad(&NumBlockedWorkers), (LONG)0);
+    sample.MinThreads = MinLimitTotalWorkerThreads;
+    sample.MaxThreads = MaxLimitTotalWorkerThreads;
+    sample.RequestsPending = PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains() ? true : false;
+    sample.QueueWaitMs = (starvedSince != 0) ? currentTicks - (DWORD)starvedSince : 0;
+    sample.ElapsedMs = elapsedMs;
+    sample.CpuUtilization = cpuUtilization;
+
+    LatencyControllerReason reason;
+    int newMax = LatencyControllerInstance.Update(sample, &reason);
+
+    switch (reason)
+    {
+    case LatencyReason_QueueLatency:
+        // Measure the wait afresh, so that the same wait does not inject again on every sample
+        if (starvedSince != 0)
+            FastInterlockCompareExchange(&WorkerStarvedSince, (LONG)(currentTicks | 1), starvedSince);
+        *pTransition = QueueLatency;
+        break;
+    case LatencyReason_BlockingCompensation:
+        *pTransition = BlockingCompensation;
+        break;
+    case LatencyReason_IdleRetirement:
+        *pTransition = IdleRetirement;
+        break;
+    default:
+        *pTransition = Undefined;
+        break;
+    }
+
+    return newMax;
+}
+
+//
+// Runs the LatencyController outside of the regular sample schedule, when a worker starts or stops
+// blocking.  If another thread is already adjusting, it will see the new blocked count.
+//
+void ThreadpoolMgr::AdjustMaxWorkersForBlocking()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        if (GetThread()) { GC_TRIGGERS;} else {DISABLED(GC_NOTRIGGER);}
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    DangerousNonHostedSpinLockTryHolder tal(&ThreadAdjustmentLock);
+    if (!tal.Acquired())
+        return;
+
+    ThreadCounter::Counts currentCounts = WorkerCounter.GetCleanCounts();
+
+    HillClimbingStateTransition transition;
+    int newMax = UpdateLatencyController(currentCounts, 0, &transition);
+    if (newMax != currentCounts.MaxWorking)
+    {
+        ChangeMaxWorkersActive(currentCounts, newMax);
+        HillClimbingInstance.ForceChange(newMax, transition);
+    }
+}
+
+bool ThreadpoolMgr::NotifyWorkerBlocking()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!UseLatencyController)
+        return false;
+
+    Thread *pThread = GetThread();
+    if (pThread == NULL || !pThread->HasThreadState(Thread::TS_TPWorkerThread))
+        return false;
+
+    FastInterlockIncrement(&NumBlockedWorkers);
+
+    // Only compensate if there is work the blocked worker is holding up
+    if (PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains())
+        AdjustMaxWorkersForBlocking();
+
+    return true;
+}
+
+void ThreadpoolMgr::NotifyWorkerUnblocked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(UseLatencyController);
+
+    FastInterlockDecrement(&NumBlockedWorkers);
+    AdjustMaxWorkersForBlocking();
+}
+
+
 void ThreadpoolMgr::MaybeAddWorkingWorker()
 {
     CONTRACTL
@@ -1016,7 +1207,14 @@ void ThreadpoolMgr::MaybeAddWorkingWorker()
         newCounts.NumRetired = max(0, counts.NumRetired - (newCounts.NumActive - counts.NumActive));
 
         if (newCounts == counts)
+        {
+            // Every worker is busy, so the request has to wait. Remember since when for the
+            // LatencyController.
+            if (UseLatencyController && VolatileLoad(&WorkerStarvedSince) == 0)
+                FastInterlockCompareExchange(&WorkerStarvedSince, (LONG)(GetTickCount() | 1), 0);
+
             return;
+        }
 
         ThreadCounter::Counts oldCounts = WorkerCounter.CompareExchangeCounts(newCounts, counts);
 
@@ -1226,7 +1424,7 @@ ThreadpoolMgr::CallbackForInitiateDrainageOfCompletionPortQueue(
 
     CounterHolder hldNumCPIT(&NumCPInfrastructureThreads);
     {
-        ThreadStoreLockHolder tsl;
+        ThreadStoreReaderHolder tsr;
         Thread *pThread = NULL;
         while ((pThread = ThreadStore::GetAllThreadList(pThread, Thread::TS_CompletionPortThread, Thread::TS_CompletionPortThread)) != NULL)
         {
@@ -1991,8 +2189,12 @@ Work:
         {
             if (retired)
                 goto Retire;
-            else
-                goto WaitForWork;
+
+            // A worker is going idle, so requests are no longer waiting for one
+            if (UseLatencyController)
+                VolatileStore(&WorkerStarvedSince, (LONG)0);
+
+            goto WaitForWork;
         }
 
         counts = oldCounts;
@@ -2277,11 +2479,35 @@ BOOL ThreadpoolMgr::RegisterWaitForSingleObject(PHANDLE phNewWaitObject,
     CONTRACTL_END;
     EnsureInitialized();
 
+    // Events and semaphores can be multiplexed on a wait port; other handles (e.g. processes
+    // and mutexes) and platforms without wait ports use WaitForMultipleObjectsEx.
+    BOOL usePort = FALSE;
+#ifdef FEATURE_PAL
+    usePort = UseWaitPorts && PAL_WaitPortCanAdd(hWaitObject);
+#endif // FEATURE_PAL
+
     ThreadCB* threadCB;
+#ifdef FEATURE_PAL
+    PVOID waitRegistration = NULL;
+#endif // FEATURE_PAL
     {
         CrstHolder csh(&WaitThreadsCriticalSection);
 
-        threadCB = FindWaitThread();
+        threadCB = FindWaitThread(usePort);
+
+#ifdef FEATURE_PAL
+        // Add the handle to the port here rather than on the wait thread, so that running out of
+        // resources (e.g. file descriptors) moves the wait to a thread that does not use a port
+        // instead of leaving it inactive. The registration stays disabled until InsertNewWaitForSelf
+        // has inserted the wait, since a signal acquired by the port before that would be lost.
+        if (threadCB != NULL && threadCB->waitPort != NULL &&
+            !PAL_WaitPortAdd(threadCB->waitPort, hWaitObject, hWaitObject, FALSE, &waitRegistration))
+        {
+            STRESS_LOG1(LF_THREADPOOL, LL_ERROR, "PAL_WaitPortAdd failed in RegisterWaitForSingleObject %x", GetLastError());
+            InterlockedDecrement(&threadCB->NumWaitHandles);
+            threadCB = FindWaitThread(FALSE);
+        }
+#endif // FEATURE_PAL
     }
 
     *phNewWaitObject = NULL;
@@ -2291,7 +2517,13 @@ BOOL ThreadpoolMgr::RegisterWaitForSingleObject(PHANDLE phNewWaitObject,
         WaitInfo* waitInfo = new (nothrow) WaitInfo;
 
         if (waitInfo == NULL)
+        {
+#ifdef FEATURE_PAL
+            if (waitRegistration != NULL)
+                PAL_WaitPortRemove(threadCB->waitPort, waitRegistration);
+#endif // FEATURE_PAL
             return FALSE;
+        }
 
         waitInfo->waitHandle = hWaitObject;
         waitInfo->Callback = Callback;
@@ -2303,6 +2535,9 @@ BOOL ThreadpoolMgr::RegisterWaitForSingleObject(PHANDLE phNewWaitObject,
         waitInfo->refCount = 1;     // safe to do this since no wait has yet been queued, so no other thread could be modifying this
         waitInfo->ExternalCompletionEvent = INVALID_HANDLE;
         waitInfo->ExternalEventSafeHandle = NULL;
+#ifdef FEATURE_PAL
+        waitInfo->waitRegistration = waitRegistration;
+#endif // FEATURE_PAL
 
         waitInfo->timer.startTime = GetTickCount();
         waitInfo->timer.remainingTime = timeout;
@@ -2315,10 +2550,14 @@ BOOL ThreadpoolMgr::RegisterWaitForSingleObject(PHANDLE phNewWaitObject,
         if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ThreadPoolIOEnqueue))
             FireEtwThreadPoolIOEnqueue((LPOVERLAPPED)waitInfo, reinterpret_cast<void*>(Callback), (dwFlag & WAIT_SINGLE_EXECUTION) == 0, GetClrInstanceId());
     
-        BOOL status = QueueUserAPC((PAPCFUNC)InsertNewWaitForSelf, threadCB->threadHandle, (size_t) waitInfo);
+        BOOL status = QueueWaitThreadAPC(threadCB, (PAPCFUNC)InsertNewWaitForSelf, (size_t) waitInfo);
 
         if (status == FALSE)
         {
+#ifdef FEATURE_PAL
+            if (waitRegistration != NULL)
+                PAL_WaitPortRemove(threadCB->waitPort, waitRegistration);
+#endif // FEATURE_PAL
             *phNewWaitObject = NULL;
             delete waitInfo;
         }
@@ -2332,7 +2571,7 @@ BOOL ThreadpoolMgr::RegisterWaitForSingleObject(PHANDLE phNewWaitObject,
 
 // Returns a wait thread that can accomodate another wait request. The
 // caller is responsible for synchronizing access to the WaitThreadsHead
-ThreadpoolMgr::ThreadCB* ThreadpoolMgr::FindWaitThread()
+ThreadpoolMgr::ThreadCB* ThreadpoolMgr::FindWaitThread(BOOL usePort)
 {
     CONTRACTL
     {
@@ -2351,7 +2590,12 @@ ThreadpoolMgr::ThreadCB* ThreadpoolMgr::FindWaitThread()
 
             ThreadCB*  threadCB = ((WaitThreadInfo*) Node)->threadCB;
 
-            if (threadCB->NumWaitHandles < MAX_WAITHANDLES)         // this test and following ...
+#ifdef FEATURE_PAL
+            if ((threadCB->waitPort != NULL) != (usePort != FALSE))
+                continue;
+#endif // FEATURE_PAL
+
+            if (threadCB->NumWaitHandles < MaxWaitHandles(threadCB))    // this test and following ...
 
             {
                 InterlockedIncrement(&threadCB->NumWaitHandles);    // ... increment are protected by WaitThreadsCriticalSection.
@@ -2362,8 +2606,17 @@ ThreadpoolMgr::ThreadCB* ThreadpoolMgr::FindWaitThread()
         }
 
         // if reached here, there are no wait threads available, so need to create a new one
-        if (!CreateWaitThread())
-            return NULL;
+        if (!CreateWaitThread(usePort))
+        {
+            if (!usePort)
+                return NULL;
+
+            // Most likely the wait port could not be created (e.g. out of file descriptors),
+            // so fall back to a thread that uses WaitForMultipleObjectsEx, which can wait on
+            // any handle.
+            STRESS_LOG1(LF_THREADPOOL, LL_ERROR, "CreateWaitThread failed to create a wait port thread %x", GetLastError());
+            usePort = FALSE;
+        }
 
 
         // Now loop back
@@ -2371,7 +2624,7 @@ ThreadpoolMgr::ThreadCB* ThreadpoolMgr::FindWaitThread()
 
 }
 
-BOOL ThreadpoolMgr::CreateWaitThread()
+BOOL ThreadpoolMgr::CreateWaitThread(BOOL usePort)
 {
     CONTRACTL
     {
@@ -2400,22 +2653,64 @@ BOOL ThreadpoolMgr::CreateWaitThread()
         return FALSE;
     }
 
+    // Size the wait arrays for the kind of thread, a port thread takes many more waits than a
+    // thread that waits with WaitForMultipleObjectsEx
+#ifdef FEATURE_PAL
+    LONG maxWaitHandles = usePort ? MAX_WAITPORT_HANDLES : MAX_WAITHANDLES;
+#else // FEATURE_PAL
+    _ASSERTE(!usePort);
+    LONG maxWaitHandles = MAX_WAITHANDLES;
+#endif // FEATURE_PAL
+
+    NewArrayHolder<HANDLE> waitHandle(new (nothrow) HANDLE[maxWaitHandles]);
+    NewArrayHolder<LIST_ENTRY> waitPointer(new (nothrow) LIST_ENTRY[maxWaitHandles]);
+    if (waitHandle == NULL || waitPointer == NULL)
+        return FALSE;
+
+    threadCB->waitHandle = waitHandle;
+    threadCB->waitPointer = waitPointer;
+
+#ifdef FEATURE_PAL
+    NewArrayHolder<PVOID> waitRegistration(NULL);
+    threadCB->waitPort = NULL;
+    if (usePort)
+    {
+        waitRegistration = new (nothrow) PVOID[MAX_WAITPORT_HANDLES];
+        if (waitRegistration == NULL)
+            return FALSE;
+
+        threadCB->waitPort = PAL_CreateWaitPort();
+        if (threadCB->waitPort == NULL)
+            return FALSE;
+    }
+    threadCB->waitRegistration = waitRegistration;
+#endif // FEATURE_PAL
+
     threadCB->startEvent.CreateAutoEvent(FALSE);
     HANDLE threadHandle = Thread::CreateUtilityThread(Thread::StackSize_Small, WaitThreadStart, (LPVOID)threadCB, W(".NET ThreadPool Wait"), CREATE_SUSPENDED, &threadId);
 
     if (threadHandle == NULL)
     {
         threadCB->startEvent.CloseEvent();
+#ifdef FEATURE_PAL
+        if (threadCB->waitPort != NULL)
+            PAL_CloseWaitPort(threadCB->waitPort);
+#endif // FEATURE_PAL
         return FALSE;
     }
 
     waitThreadInfo.SuppressRelease();
     threadCB.SuppressRelease();
+    waitHandle.SuppressRelease();
+    waitPointer.SuppressRelease();
+#ifdef FEATURE_PAL
+    waitRegistration.SuppressRelease();
+#endif // FEATURE_PAL
     threadCB->threadHandle = threadHandle;
     threadCB->threadId = threadId;              // may be useful for debugging otherwise not used
     threadCB->NumWaitHandles = 0;
     threadCB->NumActiveWaits = 0;
-    for (int i=0; i< MAX_WAITHANDLES; i++)
+    for (int i=0; i< MaxWaitHandles(threadCB); i++)
     {
         InitializeListHead(&(threadCB->waitPointer[i]));
     }
@@ -2455,6 +2750,24 @@ BOOL ThreadpoolMgr::CreateWaitThread()
 
 }
 
+// Queues an APC to a wait thread. A wait thread that waits on a PAL wait port only runs
+// APCs once the port is woken up.
+BOOL ThreadpoolMgr::QueueWaitThreadAPC(ThreadCB* threadCB, PAPCFUNC pfnAPC, ULONG_PTR data)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    BOOL status = QueueUserAPC(pfnAPC, threadCB->threadHandle, data);
+
+#ifdef FEATURE_PAL
+    if (status && threadCB->waitPort != NULL)
+    {
+        PAL_WaitPortWake(threadCB->waitPort);
+    }
+#endif // FEATURE_PAL
+
+    return status;
+}
+
 // Executed as an APC on a WaitThread. Add the wait specified in pArg to the list of objects it is waiting on
 void ThreadpoolMgr::InsertNewWaitForSelf(WaitInfo* pArgs)
 {
@@ -2470,6 +2783,13 @@ void ThreadpoolMgr::InsertNewWaitForSelf(WaitInfo* pArgs)
     else
     {
         // some thread unregistered the wait
+#ifdef FEATURE_PAL
+        if (waitInfo->waitRegistration != NULL)
+        {
+            PAL_WaitPortRemove(waitInfo->threadCB->waitPort, waitInfo->waitRegistration);
+            waitInfo->waitRegistration = NULL;
+        }
+#endif // FEATURE_PAL
         DeleteWait(waitInfo);
         return;
     }
@@ -2484,6 +2804,18 @@ void ThreadpoolMgr::InsertNewWaitForSelf(WaitInfo* pArgs)
 
     if (index == threadCB->NumActiveWaits)
     {
+#ifdef FEATURE_PAL
+        // RegisterWaitForSingleObject added the handle to the port, with the wait handle as the
+        // context the port hands back for a signaled registration
+        if (threadCB->waitPort != NULL)
+        {
+            _ASSERTE(waitInfo->waitRegistration != NULL);
+            threadCB->waitRegistration[index] = waitInfo->waitRegistration;
+            waitInfo->waitRegistration = NULL;
+            PAL_WaitPortEnable(threadCB->waitPort, threadCB->waitRegistration[index]);
+        }
+#endif // FEATURE_PAL
+
         threadCB->waitHandle[threadCB->NumActiveWaits] = waitInfo->waitHandle;
         threadCB->NumActiveWaits++;
     }
@@ -2492,6 +2824,15 @@ void ThreadpoolMgr::InsertNewWaitForSelf(WaitInfo* pArgs)
         // this is a duplicate waithandle, so the increment in FindWaitThread
         // wasn't strictly necessary.  This will avoid unnecessary thread creation.
         InterlockedDecrement(&threadCB->NumWaitHandles);
+
+#ifdef FEATURE_PAL
+        // the port already waits on the handle for the first wait
+        if (waitInfo->waitRegistration != NULL)
+        {
+            PAL_WaitPortRemove(threadCB->waitPort, waitInfo->waitRegistration);
+            waitInfo->waitRegistration = NULL;
+        }
+#endif // FEATURE_PAL
     }
 
     _ASSERTE(offsetof(WaitInfo, link) == 0);
@@ -2599,6 +2940,13 @@ DWORD WINAPI ThreadpoolMgr::WaitThreadStart(LPVOID lpArgs)
         return 0;
     }
 
+#ifdef FEATURE_PAL
+    if (threadCB->waitPort != NULL)
+    {
+        WaitPortThreadLoop(threadCB);
+    }
+#endif // FEATURE_PAL
+
     {
         // wait threads never die. (Why?)
         for (;;)
@@ -2668,26 +3016,7 @@ DWORD WINAPI ThreadpoolMgr::WaitThreadStart(LPVOID lpArgs)
 
             if (status == WAIT_TIMEOUT)
             {
-                for (int i=0; i< threadCB->NumActiveWaits; i++)
-                {
-                    WaitInfo* waitInfo = (WaitInfo*) (threadCB->waitPointer[i]).Flink;
-                    PVOID waitInfoHead = &(threadCB->waitPointer[i]);
-
-                    do
-                    {
-                        _ASSERTE(waitInfo->timer.remainingTime >= timeout);
-
-                        WaitInfo* wTemp = (WaitInfo*) waitInfo->link.Flink;
-
-                        if (waitInfo->timer.remainingTime == timeout)
-                        {
-                            ProcessWaitCompletion(waitInfo,i,TRUE);
-                        }
-
-                        waitInfo = wTemp;
-
-                    } while ((PVOID) waitInfo != waitInfoHead);
-                }
+                ProcessWaitTimeouts(threadCB, timeout);
             }
             else if (status >= WAIT_OBJECT_0 && status < (DWORD)(WAIT_OBJECT_0 + threadCB->NumActiveWaits))
             {
@@ -2723,39 +3052,7 @@ DWORD WINAPI ThreadpoolMgr::WaitThreadStart(LPVOID lpArgs)
             else
             {
                 _ASSERTE(status == WAIT_FAILED);
-                // wait failed: application error
-                // find out which wait handle caused the wait to fail
-                for (int i = 0; i < threadCB->NumActiveWaits; i++)
-                {
-                    DWORD subRet = WaitForSingleObject(threadCB->waitHandle[i], 0);
-
-                    if (subRet != WAIT_FAILED)
-                        continue;
-
-                    // remove all waits associated with this wait handle
-
-                    WaitInfo* waitInfo = (WaitInfo*) (threadCB->waitPointer[i]).Flink;
-                    PVOID waitInfoHead = &(threadCB->waitPointer[i]);
-
-                    do
-                    {
-                        WaitInfo* temp  = (WaitInfo*) waitInfo->link.Flink;
-
-                        DeactivateNthWait(waitInfo,i);
-
-
-                // Note, we cannot cleanup here since there is no way to suppress finalization
-                // we will just leak, and rely on the finalizer to clean up the memory
-                        //if (InterlockedDecrement(&waitInfo->refCount) == 0)
-                        //    DeleteWait(waitInfo);
-
-
-                        waitInfo = temp;
-
-                    } while ((PVOID) waitInfo != waitInfoHead);
-
-                    break;
-                }
+                ProcessWaitFailure(threadCB);
             }
         }
     }
@@ -2774,6 +3071,136 @@ DWORD WINAPI ThreadpoolMgr::WaitThreadStart(LPVOID lpArgs)
 #endif
 #endif
 
+#ifdef FEATURE_PAL
+// Wait loop of a wait thread that waits on a PAL wait port instead of calling WaitForMultipleObjectsEx.
+// The port acquires every signaled handle in one go, and runs the APCs queued by QueueWaitThreadAPC
+// before it waits again, so an always-signaled handle cannot hold up registrations.
+void ThreadpoolMgr::WaitPortThreadLoop(ThreadCB* threadCB)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    const DWORD MaxSignaledPerWait = 64;
+    PVOID signaled[MaxSignaledPerWait];
+
+    for (;;)
+    {
+        DWORD timeout = INFINITE;
+        DWORD count = 0;
+
+        if (threadCB->NumActiveWaits != 0)
+        {
+            // compute minimum timeout. this call also updates the remainingTime field for each wait
+            timeout = MinimumRemainingWait(threadCB->waitPointer,threadCB->NumActiveWaits);
+        }
+
+        DWORD status = PAL_WaitPortWait(threadCB->waitPort, timeout, TRUE, signaled, MaxSignaledPerWait, &count);
+
+        if (status == WAIT_IO_COMPLETION)
+            continue;
+
+        if (status == WAIT_TIMEOUT)
+        {
+            _ASSERTE(threadCB->NumActiveWaits != 0);
+            ProcessWaitTimeouts(threadCB, timeout);
+        }
+        else if (status == WAIT_OBJECT_0)
+        {
+            for (DWORD i = 0; i < count; i++)
+            {
+                int index = FindWaitIndex(threadCB, (HANDLE) signaled[i]);
+
+                // the wait may have been deregistered by an APC that ran in the same wait
+                if (index == threadCB->NumActiveWaits)
+                    continue;
+
+                // as in WaitThreadStart, only the first wait on a handle is completed
+                ProcessWaitCompletion((WaitInfo*) (threadCB->waitPointer[index]).Flink, index, FALSE);
+            }
+        }
+        else
+        {
+            _ASSERTE(status == WAIT_FAILED);
+            ProcessWaitFailure(threadCB);
+        }
+    }
+}
+#endif // FEATURE_PAL
+
+// Completes the waits whose timeout has expired, timeout being the minimum remaining wait the
+// wait thread waited for.
+void ThreadpoolMgr::ProcessWaitTimeouts(ThreadCB* threadCB, DWORD timeout)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_PREEMPTIVE;
+
+    for (int i=0; i< threadCB->NumActiveWaits; i++)
+    {
+        WaitInfo* waitInfo = (WaitInfo*) (threadCB->waitPointer[i]).Flink;
+        PVOID waitInfoHead = &(threadCB->waitPointer[i]);
+
+        do
+        {
+            _ASSERTE(waitInfo->timer.remainingTime >= timeout);
+
+            WaitInfo* wTemp = (WaitInfo*) waitInfo->link.Flink;
+
+            if (waitInfo->timer.remainingTime == timeout)
+            {
+                ProcessWaitCompletion(waitInfo,i,TRUE);
+            }
+
+            waitInfo = wTemp;
+
+        } while ((PVOID) waitInfo != waitInfoHead);
+    }
+}
+
+// The wait failed: application error. Find out which wait handle caused the wait to fail and
+// remove all waits associated with it.
+void ThreadpoolMgr::ProcessWaitFailure(ThreadCB* threadCB)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (int i = 0; i < threadCB->NumActiveWaits; i++)
+    {
+        DWORD subRet = WaitForSingleObject(threadCB->waitHandle[i], 0);
+
+        if (subRet != WAIT_FAILED)
+            continue;
+
+        // remove all waits associated with this wait handle
+
+        WaitInfo* waitInfo = (WaitInfo*) (threadCB->waitPointer[i]).Flink;
+        PVOID waitInfoHead = &(threadCB->waitPointer[i]);
+
+        do
+        {
+            WaitInfo* temp  = (WaitInfo*) waitInfo->link.Flink;
+
+            DeactivateNthWait(waitInfo,i);
+
+
+    // Note, we cannot cleanup here since there is no way to suppress finalization
+    // we will just leak, and rely on the finalizer to clean up the memory
+            //if (InterlockedDecrement(&waitInfo->refCount) == 0)
+            //    DeleteWait(waitInfo);
+
+
+            waitInfo = temp;
+
+        } while ((PVOID) waitInfo != waitInfoHead);
+
+        break;
+    }
+}
+
 void ThreadpoolMgr::ProcessWaitCompletion(WaitInfo* waitInfo,
                                           unsigned index,
                                           BOOL waitTimedOut
@@ -2931,6 +3358,11 @@ void ThreadpoolMgr::DeactivateNthWait(WaitInfo* waitInfo, DWORD index)
 
         ULONG EndIndex = threadCB->NumActiveWaits -1;
 
+#ifdef FEATURE_PAL
+        if (threadCB->waitPort != NULL)
+            PAL_WaitPortRemove(threadCB->waitPort, threadCB->waitRegistration[index]);
+#endif // FEATURE_PAL
+
         // Move the remaining ActiveWaitArray left.
 
         ShiftWaitArray( threadCB, index+1, index,EndIndex - index ) ;
@@ -3038,7 +3470,7 @@ BOOL ThreadpoolMgr::UnregisterWaitEx(HANDLE hWaitObject,HANDLE Event)
         waitInfo->PartialCompletionEvent.CreateAutoEvent(FALSE);
     }
 
-    BOOL status = QueueDeregisterWait(waitInfo->threadCB->threadHandle, waitInfo);
+    BOOL status = QueueDeregisterWait(waitInfo->threadCB, waitInfo);
 
 
     if (status == 0)
@@ -3131,7 +3563,7 @@ void ThreadpoolMgr::WaitHandleCleanup(HANDLE hWaitObject)
     WaitInfo* waitInfo = (WaitInfo*) hWaitObject;
     _ASSERTE(waitInfo->refCount > 0);
 
-    DWORD result = QueueDeregisterWait(waitInfo->threadCB->threadHandle, waitInfo);
+    DWORD result = QueueDeregisterWait(waitInfo->threadCB, waitInfo);
 
     if (result == 0)
         STRESS_LOG1(LF_THREADPOOL, LL_ERROR, "Queue APC failed in WaitHandleCleanup %x", result);
@@ -4215,6 +4647,7 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                 cpuUtilization = cpuUtilizationTemp;
             IgnoreNextSample = TRUE;
         }
+        cpuUtilizationSampled = TRUE;
 
 #ifndef FEATURE_PAL
         // don't mess with CP thread pool settings if not initialized yet
@@ -4310,6 +4743,15 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
         }
 #endif // !FEATURE_PAL
 
+        // Workers only sample the LatencyController as they complete work items.  If they are all
+        // stuck in long running ones, take the sample here instead.
+        if (UseLatencyController && ShouldAdjustMaxWorkersActive())
+        {
+            DangerousNonHostedSpinLockTryHolder tal(&ThreadAdjustmentLock);
+            if (tal.Acquired())
+                AdjustMaxWorkersActive();
+        }
+
         if (0 == CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_DisableStarvationDetection))
         {
             if (PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains() && SufficientDelaySinceLastDequeue())
@@ -4553,7 +4995,7 @@ DWORD WINAPI ThreadpoolMgr::TimerThreadStart(LPVOID p)
     pTimerThread = pThread;
     // Timer threads never die
 
-    LastTickCount = GetTickCount();
+    TimerWheelTime = GetTickCount();
 
 #ifdef FEATURE_COMINTEROP
     if (pThread->SetApartment(Thread::AS_InMTA, TRUE) != Thread::AS_InMTA)
@@ -4667,17 +5109,170 @@ void ThreadpoolMgr::InsertNewTimer(TimerInfo* pArg)
         timerInfo->state = (TIMER_REGISTERED | TIMER_ACTIVE);
         timerInfo->refCount = 1;
 
-        // insert the timer in the queue
-        InsertTailList(&TimerQueue,(&timerInfo->link));
+        // insert the timer in the wheel
+        InsertTimerInWheel(timerInfo, currentTime);
     }
 
     return;
 }
 
 
+inline DWORD TimerWheelShift(DWORD level)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return (level == 0) ? 0 : TIMER_WHEEL_LEVEL0_BITS + (level - 1) * TIMER_WHEEL_LEVEL_BITS;
+}
+
+// index in ThreadpoolMgr::TimerWheel of the slot of the given level for the tick
+inline DWORD TimerWheelSlot(DWORD level, DWORD tick)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (level == 0)
+    {
+        return tick & ((1 << TIMER_WHEEL_LEVEL0_BITS) - 1);
+    }
+
+    return (1 << TIMER_WHEEL_LEVEL0_BITS) + (level - 1) * (1 << TIMER_WHEEL_LEVEL_BITS) +
+           ((tick >> TimerWheelShift(level)) & ((1 << TIMER_WHEEL_LEVEL_BITS) - 1));
+}
+
+// Timers further away than this are parked in the top level slot for this distance and get placed again from there
+#define TIMER_WHEEL_MAX_DISTANCE ((ULONGLONG) 1 << 31)
+
+// executed by the Timer thread
+// links an active timer in the slot of the wheel level covering its distance from the wheel time
+void ThreadpoolMgr::InsertTimerInWheel(TimerInfo* timerInfo, DWORD currentTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The wheel time lags behind the current time until the wheel is advanced, or is one tick ahead after it was advanced
+    // up to the current time, so add that difference to the due time of the timer
+    LONGLONG distance = (LONGLONG) (ULONG) (timerInfo->FiringTime - currentTime) + (LONG) (currentTime - TimerWheelTime);
+    if (distance < 0)
+    {
+        distance = 0;
+    }
+    else if ((ULONGLONG) distance > TIMER_WHEEL_MAX_DISTANCE)
+    {
+        distance = TIMER_WHEEL_MAX_DISTANCE;
+    }
+
+    DWORD level = 0;
+    while ((level < TIMER_WHEEL_LEVELS - 1) && ((ULONGLONG) distance >= ((ULONGLONG) 1 << TimerWheelShift(level + 1))))
+    {
+        level++;
+    }
+
+    LIST_ENTRY* slot = &TimerWheel[TimerWheelSlot(level, TimerWheelTime + (DWORD) distance)];
+    InsertTailList(slot, (&timerInfo->link));
+
+    timerInfo->WheelLevel = level;
+    TimerWheelLevelCount[level]++;
+    TimerCount++;
+}
+
+// executed by the Timer thread
+void ThreadpoolMgr::RemoveTimerFromWheel(TimerInfo* timerInfo)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(TimerWheelLevelCount[timerInfo->WheelLevel] > 0);
+
+    RemoveEntryList((LIST_ENTRY*) timerInfo);
+
+    TimerWheelLevelCount[timerInfo->WheelLevel]--;
+    TimerCount--;
+}
+
+// executed by the Timer thread when the wheel time starts a new turn of level 0
+// moves the timers of the higher level slots reached by the wheel time down to the levels covering them now
+void ThreadpoolMgr::CascadeTimerWheel()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(TimerWheelSlot(0, TimerWheelTime) == 0);
+
+    for (DWORD level = 1; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        if (TimerWheelLevelCount[level] != 0)
+        {
+            LIST_ENTRY* slot = &TimerWheel[TimerWheelSlot(level, TimerWheelTime)];
+
+            while (!IsListEmpty(slot))
+            {
+                TimerInfo* timerInfo = (TimerInfo*) slot->Flink;
+
+                RemoveTimerFromWheel(timerInfo);
+                InsertTimerInWheel(timerInfo, TimerWheelTime);
+            }
+        }
+
+        // The next level only starts a new slot when this one wraps around
+        if (((TimerWheelTime >> TimerWheelShift(level)) & ((1 << TIMER_WHEEL_LEVEL_BITS) - 1)) != 0)
+        {
+            break;
+        }
+    }
+}
+
+// returns the first tick at or after the given one where the lowest non-empty level above level 0 cascades
+DWORD ThreadpoolMgr::GetNextTimerWheelCascade(DWORD tick)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD level = 1;
+    while ((level < TIMER_WHEEL_LEVELS - 1) && (TimerWheelLevelCount[level] == 0))
+    {
+        level++;
+    }
+
+    DWORD span = (DWORD) 1 << TimerWheelShift(level);
+    return (tick + span - 1) & ~(span - 1);
+}
+
+// returns the time until the wheel has timers to fire or to cascade
+DWORD ThreadpoolMgr::GetNextTimerWheelInterval(DWORD currentTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (TimerCount == 0)
+    {
+        return (DWORD) -1;
+    }
+
+    if ((LONG) (TimerWheelTime - currentTime) <= 0)
+    {
+        // The wheel could not be advanced up to the current time, retry shortly
+        return 1;
+    }
+
+    DWORD nextTick;
+    if (TimerWheelLevelCount[0] != 0)
+    {
+        // Look for a non-empty slot in the rest of the current turn of level 0, the next turn starts with a cascade
+        DWORD turnEnd = (TimerWheelTime | ((1 << TIMER_WHEEL_LEVEL0_BITS) - 1)) + 1;
+
+        for (nextTick = TimerWheelTime; nextTick != turnEnd; nextTick++)
+        {
+            if (!IsListEmpty(&TimerWheel[TimerWheelSlot(0, nextTick)]))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        nextTick = GetNextTimerWheelCascade(TimerWheelTime);
+    }
+
+    return nextTick - currentTime;
+}
+
 // executed by the Timer thread
-// sweeps through the list of timers, readjusting the firing times, queueing APCs for
-// those that have expired, and returns the next firing time interval
+// advances the timer wheel up to the current time, queueing APCs for the timers of the slots it goes through, and
+// returns the next firing time interval
 DWORD ThreadpoolMgr::FireTimers()
 {
     CONTRACTL
@@ -4689,69 +5284,92 @@ DWORD ThreadpoolMgr::FireTimers()
     CONTRACTL_END;
 
     DWORD currentTime = GetTickCount();
-    DWORD nextFiringInterval = (DWORD) -1;
     TimerInfo* timerInfo = NULL;
-    
-    EX_TRY 
+
+    // number of ticks up to and including the current time that the wheel has not gone through yet
+    DWORD ticksLeft = currentTime - TimerWheelTime + 1;
+
+    EX_TRY
     {
-        for (LIST_ENTRY* node = (LIST_ENTRY*) TimerQueue.Flink;
-             node != &TimerQueue;
-            )
+        while (ticksLeft != 0)
         {
-            timerInfo = (TimerInfo*) node;
-            node = (LIST_ENTRY*) node->Flink;
+            if (TimerCount == 0)
+            {
+                TimerWheelTime = currentTime + 1;
+                break;
+            }
 
-            if (TimeExpired(LastTickCount, currentTime, timerInfo->FiringTime))
+            DWORD slotIndex = TimerWheelSlot(0, TimerWheelTime);
+            if (slotIndex == 0)
             {
-                if (timerInfo->Period == 0 || timerInfo->Period == (ULONG) -1)
+                CascadeTimerWheel();
+            }
+
+            if (TimerWheelLevelCount[0] == 0)
+            {
+                // Nothing happens before the next cascade
+                DWORD skip = GetNextTimerWheelCascade(TimerWheelTime + 1) - TimerWheelTime;
+                if (skip > ticksLeft)
                 {
-                    DeactivateTimer(timerInfo);
+                    skip = ticksLeft;
                 }
 
+                TimerWheelTime += skip;
+                ticksLeft -= skip;
+                continue;
+            }
+
+            LIST_ENTRY* slot = &TimerWheel[slotIndex];
+
+            while (!IsListEmpty(slot))
+            {
+                timerInfo = (TimerInfo*) slot->Flink;
+
                 InterlockedIncrement(&timerInfo->refCount);
 
                 QueueUserWorkItem(AsyncTimerCallbackCompletion,
                                   timerInfo,
                                   QUEUE_ONLY /* TimerInfo take care of deleting*/);
 
-                if (timerInfo->Period != 0 && timerInfo->Period != (ULONG)-1)
+                if (timerInfo->Period == 0 || timerInfo->Period == (ULONG) -1)
+                {
+                    DeactivateTimer(timerInfo);
+                }
+                else
                 {
                     ULONG nextFiringTime = timerInfo->FiringTime + timerInfo->Period;
-                    DWORD firingInterval;
                     if (TimeExpired(timerInfo->FiringTime, currentTime, nextFiringTime))
                     {
                         // Enough time has elapsed to fire the timer yet again. The timer is not able to keep up with the short
                         // period, have it fire 1 ms from now to avoid spinning without a delay.
                         timerInfo->FiringTime = currentTime + 1;
-                        firingInterval = 1;
                     }
                     else
                     {
                         timerInfo->FiringTime = nextFiringTime;
-                        firingInterval = TimeInterval(nextFiringTime, currentTime);
                     }
 
-                    if (firingInterval < nextFiringInterval)
-                        nextFiringInterval = firingInterval;
+                    RemoveTimerFromWheel(timerInfo);
+                    InsertTimerInWheel(timerInfo, currentTime);
                 }
+
+                timerInfo = NULL;
             }
-            else
-            {
-                DWORD firingInterval = TimeInterval(timerInfo->FiringTime, currentTime);
-                if (firingInterval < nextFiringInterval)
-                    nextFiringInterval = firingInterval;
-            }
+
+            TimerWheelTime++;
+            ticksLeft--;
         }
     } 
     EX_CATCH 
     {
         // If QueueUserWorkItem throws OOM, swallow the exception and retry on
-        // the next call to FireTimers(), otherwise retrhow.
+        // the next call to FireTimers(), otherwise retrhow. The timer is still
+        // linked in the slot, and the wheel time has not moved past it.
         Exception *ex = GET_EXCEPTION();
-        // undo the call to DeactivateTimer()
-        InterlockedDecrement(&timerInfo->refCount);
-        timerInfo->state = timerInfo->state & TIMER_ACTIVE;
-        InsertTailList(&TimerQueue, (&timerInfo->link));
+        if (timerInfo != NULL)
+        {
+            InterlockedDecrement(&timerInfo->refCount);
+        }
         if (ex->GetHR() != E_OUTOFMEMORY)
         {
            EX_RETHROW;
@@ -4759,9 +5377,7 @@ DWORD ThreadpoolMgr::FireTimers()
     }
     EX_END_CATCH(RethrowTerminalExceptions);
 
-    LastTickCount = currentTime;
-
-    return nextFiringInterval;
+    return GetNextTimerWheelInterval(currentTime);
 }
 
 DWORD WINAPI ThreadpoolMgr::AsyncTimerCallbackCompletion(PVOID pArgs)
@@ -4803,13 +5419,13 @@ DWORD WINAPI ThreadpoolMgr::AsyncTimerCallbackCompletion(PVOID pArgs)
 }
 
 
-// removes the timer from the timer queue, thereby cancelling it
+// removes the timer from the timer wheel, thereby cancelling it
 // there may still be pending callbacks that haven't completed
 void ThreadpoolMgr::DeactivateTimer(TimerInfo* timerInfo)
 {
     LIMITED_METHOD_CONTRACT;
 
-    RemoveEntryList((LIST_ENTRY*) timerInfo);
+    RemoveTimerFromWheel(timerInfo);
 
     // This timer info could go into another linked list of timer infos
     // waiting to be released. Reinitialize the list pointers
@@ -5090,16 +5706,21 @@ void ThreadpoolMgr::UpdateTimer(TimerUpdateInfo* pArgs)
 
     delete updateInfo;
 
-    if (! (timerInfo->state & TIMER_ACTIVE))
+    if (timerInfo->state & TIMER_ACTIVE)
+    {
+        // the timer moves to the slot for its new firing time
+        RemoveTimerFromWheel(timerInfo);
+    }
+    else
     {
         // timer not active (probably a one shot timer that has expired), so activate it
         timerInfo->state |= TIMER_ACTIVE;
         _ASSERTE(timerInfo->refCount >= 1);
-        // insert the timer in the queue
-        InsertTailList(&TimerQueue,(&timerInfo->link));
-
     }
 
+    // insert the timer in the wheel
+    InsertTimerInWheel(timerInfo, currentTime);
+
     return;
 }
 
@@ -25,9 +25,14 @@ Revision History:
 #include "util.hpp"
 #include "nativeoverlapped.h"
 #include "hillclimbing.h"
+#include "latencycontroller.h"
 
 #define MAX_WAITHANDLES 64
 
+#ifdef FEATURE_PAL
+#define MAX_WAITPORT_HANDLES 1024   // wait threads that wait on a PAL wait port are not limited by MAXIMUM_WAIT_OBJECTS
+#endif
+
 #define MAX_CACHED_EVENTS 40        // upper limit on number of wait events cached 
 
 #define WAIT_REGISTERED     0x01
@@ -38,6 +43,13 @@ Revision History:
 #define TIMER_ACTIVE        0x02
 #define TIMER_DELETE        0x04
 
+// Timer wheel: level 0 has a slot per millisecond tick, and a slot of each higher level spans a full turn of the level
+// below. Together the levels cover the range of the 32-bit tick count.
+#define TIMER_WHEEL_LEVELS          5
+#define TIMER_WHEEL_LEVEL0_BITS     8
+#define TIMER_WHEEL_LEVEL_BITS      6
+#define TIMER_WHEEL_SLOTS           ((1 << TIMER_WHEEL_LEVEL0_BITS) + (TIMER_WHEEL_LEVELS - 1) * (1 << TIMER_WHEEL_LEVEL_BITS))
+
 #define WAIT_SINGLE_EXECUTION      0x00000001
 #define WAIT_FREE_CONTEXT          0x00000002
 #define WAIT_INTERNAL_COMPLETION   0x00000004
@@ -260,6 +272,22 @@ public:
         return GlobalCompletionPort != NULL;
     }
 
+    // Retrieves the most recent CPU utilization (in percent) sampled by the gate thread. Returns FALSE if the gate thread
+    // has not taken a sample yet, in which case the utilization is unknown.
+    inline static BOOL TryGetCPUUtilization(LONG* pCpuUtilization)
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE(pCpuUtilization != NULL);
+
+        if (!cpuUtilizationSampled)
+        {
+            return FALSE;
+        }
+
+        *pCpuUtilization = cpuUtilization;
+        return TRUE;
+    }
+
     static BOOL DrainCompletionPortQueue();
 
     static BOOL RegisterWaitForSingleObject(PHANDLE phNewWaitObject,
@@ -302,6 +330,34 @@ public:
         VolatileStore(&LastDequeueTime, (unsigned int)GetTickCount());
     }
 
+    // Called around blocking waits on worker threads, so that the latency
+    // controller can compensate for blocked workers. NotifyWorkerBlocking
+    // returns false if the wait was not counted and must not be paired with
+    // NotifyWorkerUnblocked.
+    static bool NotifyWorkerBlocking();
+    static void NotifyWorkerUnblocked();
+
+    class BlockingWaitHolder
+    {
+    public:
+        BlockingWaitHolder(INT32 timeout)
+        {
+            WRAPPER_NO_CONTRACT;
+            // Polling waits do not block
+            m_reported = (timeout != 0) && NotifyWorkerBlocking();
+        }
+
+        ~BlockingWaitHolder()
+        {
+            WRAPPER_NO_CONTRACT;
+            if (m_reported)
+                NotifyWorkerUnblocked();
+        }
+
+    private:
+        bool m_reported;
+    };
+
     static BOOL CreateTimerQueueTimer(PHANDLE phNewTimer,
                                         WAITORTIMERCALLBACK Callback,
                                         PVOID Parameter,
@@ -395,12 +451,17 @@ private:
         HANDLE          threadHandle;
         DWORD           threadId;
         CLREvent        startEvent;
-        LONG            NumWaitHandles;                 // number of wait objects registered to the thread <=64
+        LONG            NumWaitHandles;                 // number of wait objects registered to the thread <= MaxWaitHandles(threadCB)
         LONG            NumActiveWaits;                 // number of objects, thread is actually waiting on (this may be less than
                                                            // NumWaitHandles since the thread may not have activated some waits
-        HANDLE          waitHandle[MAX_WAITHANDLES];    // array of wait handles (copied from waitInfo since 
+        // The following arrays have MaxWaitHandles(threadCB) entries, which depends on the kind of wait thread
+        HANDLE*         waitHandle;                     // array of wait handles (copied from waitInfo since 
                                                            // we need them to be contiguous)
-        LIST_ENTRY      waitPointer[MAX_WAITHANDLES];   // array of doubly linked list of corresponding waitinfo 
+        LIST_ENTRY*     waitPointer;                    // array of doubly linked list of corresponding waitinfo 
+#ifdef FEATURE_PAL
+        PVOID           waitPort;                       // PAL wait port the thread waits on, or NULL if it uses WaitForMultipleObjectsEx
+        PVOID*          waitRegistration;               // wait port registration of each wait handle, NULL if waitPort is NULL
+#endif // FEATURE_PAL
     } ThreadCB;
 
 
@@ -427,6 +488,9 @@ private:
                                                      // but I cant make a union since CLREvent has a non-default constructor
         HANDLE              ExternalCompletionEvent; // they are signalled when all callbacks have completed (refCount=0)
         OBJECTHANDLE        ExternalEventSafeHandle;
+#ifdef FEATURE_PAL
+        PVOID               waitRegistration;        // disabled wait port registration until InsertNewWaitForSelf takes it over
+#endif // FEATURE_PAL
 
     } ;
 
@@ -557,8 +621,9 @@ private:
 
     // Timer 
     typedef struct {
-        LIST_ENTRY  link;           // doubly linked list of timers
+        LIST_ENTRY  link;           // doubly linked list of timers in a timer wheel slot
         ULONG FiringTime;           // TickCount of when to fire next
+        DWORD WheelLevel;           // level of the timer wheel the timer is linked in
         WAITORTIMERCALLBACK Function;             // Function to call when timer fires
         PVOID Context;              // Context to pass to function when timer fires
         ULONG Period;
@@ -859,13 +924,16 @@ public:
         {
             ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
             if (counts.NumActive <= counts.MaxWorking)
-                return !IsHillClimbingDisabled;
+                return UseLatencyController || !IsHillClimbingDisabled;
         }
 
         return false;
     }
 
     static void AdjustMaxWorkersActive();
+    static void AdjustMaxWorkersForBlocking();
+    static void ChangeMaxWorkersActive(ThreadCounter::Counts currentCounts, int newMax);
+    static int UpdateLatencyController(ThreadCounter::Counts counts, DWORD elapsedMs, HillClimbingStateTransition* pTransition);
     static bool ShouldWorkerKeepRunning();
 
     static BOOL SuspendProcessing();
@@ -877,9 +945,21 @@ public:
     static BOOL AddWaitRequest(HANDLE waitHandle, WaitInfo* waitInfo);
 
 
-    static ThreadCB* FindWaitThread();              // returns a wait thread that can accomodate another wait request
+    static ThreadCB* FindWaitThread(BOOL usePort);  // returns a wait thread that can accomodate another wait request
+
+    static BOOL CreateWaitThread(BOOL usePort);
 
-    static BOOL CreateWaitThread();
+    inline static LONG MaxWaitHandles(const ThreadCB* threadCB)
+    {
+        LIMITED_METHOD_CONTRACT;
+#ifdef FEATURE_PAL
+        if (threadCB->waitPort != NULL)
+            return MAX_WAITPORT_HANDLES;
+#endif // FEATURE_PAL
+        return MAX_WAITHANDLES;
+    }
+
+    static BOOL QueueWaitThreadAPC(ThreadCB* threadCB, PAPCFUNC pfnAPC, ULONG_PTR data);
 
     static void WINAPI InsertNewWaitForSelf(WaitInfo* pArg);
 
@@ -891,8 +971,16 @@ public:
                                 unsigned index,      // array index 
                                 BOOL waitTimedOut);
 
+    static void ProcessWaitTimeouts(ThreadCB* threadCB, DWORD timeout);
+
+    static void ProcessWaitFailure(ThreadCB* threadCB);
+
     static DWORD WINAPI WaitThreadStart(LPVOID lpArgs);
 
+#ifdef FEATURE_PAL
+    static void WaitPortThreadLoop(ThreadCB* threadCB);
+#endif // FEATURE_PAL
+
     static DWORD WINAPI AsyncCallbackCompletion(PVOID pArgs);
 
     static void QueueTimerInfoForRelease(TimerInfo *pTimerInfo);
@@ -915,6 +1003,14 @@ public:
         memmove(&threadCB->waitPointer[DestIndex],
                &threadCB->waitPointer[SrcIndex],
                count * sizeof(LIST_ENTRY));
+#ifdef FEATURE_PAL
+        if (threadCB->waitRegistration != NULL)
+        {
+            memmove(&threadCB->waitRegistration[DestIndex],
+                   &threadCB->waitRegistration[SrcIndex],
+                   count * sizeof(PVOID));
+        }
+#endif // FEATURE_PAL
     }
 
     static void WINAPI DeregisterWait(WaitInfo* pArgs);
@@ -936,12 +1032,6 @@ public:
     static BOOL CreateCompletionPortThread(LPVOID lpArgs);
     static DWORD WINAPI CompletionPortThreadStart(LPVOID lpArgs);
 public:
-    inline static bool HaveNativeWork()
-    {
-        LIMITED_METHOD_CONTRACT;
-        return WorkRequestHead != NULL;
-    }
-
     static void GrowCompletionPortThreadpoolIfNeeded();
     static BOOL ShouldGrowCompletionPortThreadpool(ThreadCounter::Counts counts);
 #else
@@ -970,13 +1060,18 @@ private:
     static DWORD FireTimers();
     static DWORD WINAPI AsyncTimerCallbackCompletion(PVOID pArgs);
     static void DeactivateTimer(TimerInfo* timerInfo);
+    static void InsertTimerInWheel(TimerInfo* timerInfo, DWORD currentTime);
+    static void RemoveTimerFromWheel(TimerInfo* timerInfo);
+    static void CascadeTimerWheel();
+    static DWORD GetNextTimerWheelCascade(DWORD tick);
+    static DWORD GetNextTimerWheelInterval(DWORD currentTime);
     static DWORD WINAPI AsyncDeleteTimer(PVOID pArgs);
     static void DeleteTimer(TimerInfo* timerInfo);
     static void WINAPI UpdateTimer(TimerUpdateInfo* pArgs);
 
     static void WINAPI DeregisterTimer(TimerInfo* pArgs);
 
-    inline static DWORD QueueDeregisterWait(HANDLE waitThread, WaitInfo* waitInfo)
+    inline static DWORD QueueDeregisterWait(ThreadCB* threadCB, WaitInfo* waitInfo)
     {
         CONTRACTL
         {
@@ -986,7 +1081,7 @@ private:
         }
         CONTRACTL_END;
 
-        DWORD result = QueueUserAPC(reinterpret_cast<PAPCFUNC>(DeregisterWait), waitThread, reinterpret_cast<ULONG_PTR>(waitInfo));
+        DWORD result = QueueWaitThreadAPC(threadCB, reinterpret_cast<PAPCFUNC>(DeregisterWait), reinterpret_cast<ULONG_PTR>(waitInfo));
         SetWaitThreadAPCPending();
         return result;
     }
@@ -1026,6 +1121,11 @@ private:
     static bool IsHillClimbingDisabled;
     static int ThreadAdjustmentInterval;
 
+    static bool UseLatencyController;                   // LatencyController replaces HillClimbing
+    static LatencyController LatencyControllerInstance;
+    static LONG NumBlockedWorkers;                      // workers in a wait reported with NotifyWorkerBlocking
+    static LONG WorkerStarvedSince;                     // tick count (| 1) since requests found every worker busy, or 0
+
     SPTR_DECL(WorkRequest,WorkRequestHead);             // Head of work request queue
     SPTR_DECL(WorkRequest,WorkRequestTail);             // Head of work request queue
 
@@ -1066,14 +1166,19 @@ private:
     static CLREvent * RetiredCPWakeupEvent;    
     
     static CrstStatic WaitThreadsCriticalSection;
-    static LIST_ENTRY WaitThreadsHead;                  // queue of wait threads, each thread can handle upto 64 waits
+    static LIST_ENTRY WaitThreadsHead;                  // queue of wait threads, each thread can handle upto MaxWaitHandles waits
+#ifdef FEATURE_PAL
+    static bool UseWaitPorts;                           // whether wait threads multiplex events and semaphores on a PAL wait port
+#endif // FEATURE_PAL
 
     static TimerInfo *TimerInfosToBeRecycled;           // list of delegate infos associated with deleted timers
     static CrstStatic TimerQueueCriticalSection;        // critical section to synchronize timer queue access
-    SVAL_DECL(LIST_ENTRY,TimerQueue);                   // queue of timers
+    static LIST_ENTRY TimerWheel[TIMER_WHEEL_SLOTS];    // slots of all the timer wheel levels, only used by the timer thread
+    static DWORD TimerWheelLevelCount[TIMER_WHEEL_LEVELS]; // number of timers linked in each level
+    SVAL_DECL(LONG,TimerCount);                         // number of active timers
     static HANDLE TimerThread;                          // Currently we only have one timer thread
     static Thread*  pTimerThread;
-    DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static DWORD LastTickCount;      // the count just before timer thread goes to sleep
+    DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static DWORD TimerWheelTime;     // next tick to be processed by the timer wheel
 
     static BOOL InitCompletionPortThreadpool;           // flag indicating whether completion port threadpool has been initialized
     static HANDLE GlobalCompletionPort;                 // used for binding io completions on file handles
@@ -1092,6 +1197,7 @@ private:
 
     SVAL_DECL(LONG,cpuUtilization);
     static LONG cpuUtilizationAverage;
+    static Volatile<BOOL> cpuUtilizationSampled;        // set once the gate thread has stored its first sample in cpuUtilization
 
     DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) static RecycledListsWrapper RecycledLists;
 
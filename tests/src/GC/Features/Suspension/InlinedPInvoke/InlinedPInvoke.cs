@@ -0,0 +1,96 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+// Threads that leave cooperative mode through an inlined P/Invoke do not tell the thread
+// suspending the runtime that they reached a safe point; only a rescan of the threads finds
+// them. Make sure a GC does not end up waiting a full ping timeout for them while other
+// threads keep running managed code, by checking that blocking gen0 collections stay short.
+public class InlinedPInvoke
+{
+    // Far below the time the suspending thread waits before pinging threads again
+    private const double MaxMedianCollectMilliseconds = 5.0;
+
+    private const int Collections = 200;
+
+    private static volatile bool s_stop;
+
+    [DllImport("SuspensionNative")]
+    private static extern int Spin(int iterations);
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void PInvokeLoop()
+    {
+        int sum = 0;
+        while (!s_stop)
+        {
+            sum += Spin(200);
+        }
+        GC.KeepAlive(sum);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void AllocationLoop()
+    {
+        object[] objects = new object[64];
+        int i = 0;
+        while (!s_stop)
+        {
+            objects[i++ & 63] = new byte[32];
+        }
+        GC.KeepAlive(objects);
+    }
+
+    public static int Main()
+    {
+        int threadCount = Math.Max(4, Environment.ProcessorCount * 2);
+        Thread[] threads = new Thread[threadCount];
+        for (int i = 0; i < threadCount; i++)
+        {
+            // Mostly P/Invoke loops, with a few threads that stay in managed code
+            threads[i] = new Thread(i % 4 == 3 ? (ThreadStart)AllocationLoop : PInvokeLoop);
+            threads[i].IsBackground = true;
+            threads[i].Start();
+        }
+
+        // Let the loops get jitted and running
+        Thread.Sleep(500);
+        GC.Collect(0);
+
+        double[] collectMilliseconds = new double[Collections];
+        Stopwatch stopwatch = new Stopwatch();
+        for (int i = 0; i < Collections; i++)
+        {
+            stopwatch.Restart();
+            GC.Collect(0);
+            stopwatch.Stop();
+            collectMilliseconds[i] = stopwatch.Elapsed.TotalMilliseconds;
+        }
+
+        s_stop = true;
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+
+        Array.Sort(collectMilliseconds);
+        double median = collectMilliseconds[Collections / 2];
+        double max = collectMilliseconds[Collections - 1];
+        Console.WriteLine("{0} threads, gen0 collection median {1:F3} ms, max {2:F3} ms", threadCount, median, max);
+
+        if (median >= MaxMedianCollectMilliseconds)
+        {
+            Console.WriteLine("FAIL: median collection time is not below {0} ms", MaxMedianCollectMilliseconds);
+            return 101;
+        }
+
+        Console.WriteLine("PASS");
+        return 100;
+    }
+}
@@ -0,0 +1,18 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+#include <platformdefines.h>
+
+// Spins for a little while, so that callers spend much of their time outside of managed code
+extern "C" DLL_EXPORT int STDMETHODCALLTYPE Spin(int iterations)
+{
+    volatile int sum = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        sum += i;
+    }
+
+    return sum;
+}
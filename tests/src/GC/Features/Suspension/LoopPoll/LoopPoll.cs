@@ -0,0 +1,112 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Runs with COMPlus_GCPollType=4, where jitted code polls for a GC at loop back edges only.
+// Threads spinning in loops without calls must reach a safe point through those polls, so
+// collections triggered concurrently from several threads must not wait long for them.
+public class LoopPoll
+{
+    // Far below the time the suspending thread waits before pinging threads again
+    private const double MaxMedianCollectMilliseconds = 5.0;
+
+    // Generous bound on any single collection, a loop that never polls would hang suspension
+    private const double MaxCollectMilliseconds = 2000.0;
+
+    private const int CollectionsPerThread = 100;
+    private const int CollectingThreads = 2;
+
+    private static volatile bool s_stop;
+    private static int s_sink;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static void TightLoop()
+    {
+        int x = 1;
+        while (!s_stop)
+        {
+            x = x * 31 + 7;
+        }
+        s_sink = x;
+    }
+
+    private static void CollectLoop(object state)
+    {
+        double[] collectMilliseconds = (double[])state;
+        Stopwatch stopwatch = new Stopwatch();
+        for (int i = 0; i < collectMilliseconds.Length; i++)
+        {
+            stopwatch.Restart();
+            GC.Collect(0);
+            stopwatch.Stop();
+            collectMilliseconds[i] = stopwatch.Elapsed.TotalMilliseconds;
+        }
+    }
+
+    public static int Main()
+    {
+        int loopThreadCount = Math.Max(2, Environment.ProcessorCount);
+        Thread[] loopThreads = new Thread[loopThreadCount];
+        for (int i = 0; i < loopThreadCount; i++)
+        {
+            loopThreads[i] = new Thread(TightLoop);
+            loopThreads[i].IsBackground = true;
+            loopThreads[i].Start();
+        }
+
+        // Let the loops get jitted and running
+        Thread.Sleep(500);
+        GC.Collect(0);
+
+        double[] collectMilliseconds = new double[CollectingThreads * CollectionsPerThread];
+        Thread[] collectThreads = new Thread[CollectingThreads];
+        double[][] perThread = new double[CollectingThreads][];
+        for (int i = 0; i < CollectingThreads; i++)
+        {
+            perThread[i] = new double[CollectionsPerThread];
+            collectThreads[i] = new Thread(CollectLoop);
+            collectThreads[i].Start(perThread[i]);
+        }
+
+        foreach (Thread thread in collectThreads)
+        {
+            thread.Join();
+        }
+
+        s_stop = true;
+        foreach (Thread thread in loopThreads)
+        {
+            thread.Join();
+        }
+
+        for (int i = 0; i < CollectingThreads; i++)
+        {
+            Array.Copy(perThread[i], 0, collectMilliseconds, i * CollectionsPerThread, CollectionsPerThread);
+        }
+
+        Array.Sort(collectMilliseconds);
+        double median = collectMilliseconds[collectMilliseconds.Length / 2];
+        double max = collectMilliseconds[collectMilliseconds.Length - 1];
+        Console.WriteLine("{0} looping threads, gen0 collection median {1:F3} ms, max {2:F3} ms", loopThreadCount, median, max);
+
+        if (median >= MaxMedianCollectMilliseconds)
+        {
+            Console.WriteLine("FAIL: median collection time is not below {0} ms", MaxMedianCollectMilliseconds);
+            return 101;
+        }
+
+        if (max >= MaxCollectMilliseconds)
+        {
+            Console.WriteLine("FAIL: a collection took {0} ms or more", MaxCollectMilliseconds);
+            return 101;
+        }
+
+        Console.WriteLine("PASS");
+        return 100;
+    }
+}
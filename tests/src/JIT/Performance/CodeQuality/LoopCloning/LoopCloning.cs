@@ -0,0 +1,242 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using Microsoft.Xunit.Performance;
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+[assembly: OptimizeForBenchmarks]
+
+// Loops that the JIT can clone to hoist the bounds checks out of the fast path:
+// span indexing, non-unit strides and decreasing induction variables. Compare
+// with COMPlus_JitCloneLoops=0 (checked JIT) to see the effect of cloning.
+
+namespace LoopCloning
+{
+    public class LoopCloningBench
+    {
+        const int Length = 1024;
+        const int Iterations = 200000;
+
+        static int[] s_array = CreateArray(Length);
+
+        static int[] CreateArray(int length)
+        {
+            int[] a = new int[length];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = i;
+            }
+            return a;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumSpan(Span<int> s, int n)
+        {
+            int sum = 0;
+            for (int i = 0; i < n; i++)
+            {
+                sum += s[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumReadOnlySpan(ReadOnlySpan<int> s, int n)
+        {
+            int sum = 0;
+            for (int i = 0; i < n; i++)
+            {
+                sum += s[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumStride2(int[] a, int n)
+        {
+            int sum = 0;
+            for (int i = 0; i < n; i += 2)
+            {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumSpanStride4(Span<int> s, int n)
+        {
+            int sum = 0;
+            for (int i = 0; i < n; i += 4)
+            {
+                sum += s[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumDown(int[] a, int start)
+        {
+            int sum = 0;
+            for (int i = start; i >= 0; i--)
+            {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumSpanDown(Span<int> s, int start)
+        {
+            int sum = 0;
+            for (int i = start; i >= 0; i--)
+            {
+                sum += s[i];
+            }
+            return sum;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static int Span()
+        {
+            int result = 0;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        result += SumSpan(s_array, Length);
+                    }
+                }
+            }
+            return result;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static int ReadOnlySpan()
+        {
+            int result = 0;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        result += SumReadOnlySpan(s_array, Length);
+                    }
+                }
+            }
+            return result;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static int ArrayStride2()
+        {
+            int result = 0;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        result += SumStride2(s_array, Length);
+                    }
+                }
+            }
+            return result;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static int SpanStride4()
+        {
+            int result = 0;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        result += SumSpanStride4(s_array, Length);
+                    }
+                }
+            }
+            return result;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static int ArrayDown()
+        {
+            int result = 0;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        result += SumDown(s_array, Length - 1);
+                    }
+                }
+            }
+            return result;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static int SpanDown()
+        {
+            int result = 0;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        result += SumSpanDown(s_array, Length - 1);
+                    }
+                }
+            }
+            return result;
+        }
+
+        static bool ExpectException(Func<int> f)
+        {
+            try
+            {
+                f();
+            }
+            catch (IndexOutOfRangeException)
+            {
+                return true;
+            }
+            return false;
+        }
+
+        public static int Main()
+        {
+            int[] a = s_array;
+            int full = Length * (Length - 1) / 2;
+            int even = 0;
+            int fourth = 0;
+            for (int i = 0; i < Length; i++)
+            {
+                even += ((i % 2) == 0) ? i : 0;
+                fourth += ((i % 4) == 0) ? i : 0;
+            }
+
+            bool ok = (SumSpan(a, Length) == full) && (SumReadOnlySpan(a, Length) == full) &&
+                      (SumStride2(a, Length) == even) && (SumSpanStride4(a, Length) == fourth) &&
+                      (SumDown(a, Length - 1) == full) && (SumSpanDown(a, Length - 1) == full);
+
+            // The slow (uncloned) path must still throw when the conditions fail.
+            ok &= ExpectException(() => SumSpan(a, Length + 1));
+            ok &= ExpectException(() => SumStride2(a, Length + 2));
+            ok &= ExpectException(() => SumSpanStride4(a, Length + 4));
+            ok &= ExpectException(() => SumDown(a, Length));
+            ok &= ExpectException(() => SumSpanDown(a, Length));
+
+            return ok ? 100 : -1;
+        }
+    }
+}
@@ -0,0 +1,122 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using Microsoft.Xunit.Performance;
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading.Tasks;
+using Xunit;
+
+[assembly: OptimizeForBenchmarks]
+
+// Performance tests for looking up strings in the runtime's literal table from
+// several threads at once through String.Intern and String.IsInterned
+
+namespace Strings
+{
+    public class StringIntern
+    {
+#if DEBUG
+        public const int Iterations = 1;
+#else
+        public const int Iterations = 100000;
+#endif
+
+        const int Threads = 4;
+
+        // Equal to literals in this assembly, but distinct instances, so String.Intern has to look them up
+        static readonly string[] s_copies = new string[]
+        {
+            new string("alpha".ToCharArray()),
+            new string("bravo".ToCharArray()),
+            new string("charlie".ToCharArray()),
+            new string("delta".ToCharArray()),
+            new string("echo".ToCharArray()),
+            new string("foxtrot".ToCharArray()),
+            new string("golf".ToCharArray()),
+            new string("hotel".ToCharArray()),
+        };
+
+        static readonly string[] s_literals = new string[]
+        {
+            "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+        };
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static void Consume(bool b) { }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static bool InternAll(int count)
+        {
+            bool result = true;
+            for (int i = 0; i < count; i++)
+            {
+                string s = s_copies[i % s_copies.Length];
+                result &= (object)String.Intern(s) == (object)s_literals[i % s_literals.Length];
+            }
+            return result;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static bool IsInternedAll(int count)
+        {
+            bool result = true;
+            for (int i = 0; i < count; i++)
+            {
+                result &= String.IsInterned(s_copies[i % s_copies.Length]) != null;
+            }
+            return result;
+        }
+
+        static bool RunOnThreads(Func<int, bool> body, int count)
+        {
+            var tasks = new Task<bool>[Threads];
+            for (int t = 0; t < Threads; t++)
+            {
+                tasks[t] = Task.Factory.StartNew(() => body(count), TaskCreationOptions.LongRunning);
+            }
+
+            bool result = true;
+            foreach (Task<bool> task in tasks)
+            {
+                result &= task.Result;
+            }
+            return result;
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static void InternContended()
+        {
+            bool result = true;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    result &= RunOnThreads(InternAll, Benchmark.InnerIterationCount);
+                }
+            }
+            Consume(result);
+        }
+
+        [Benchmark(InnerIterationCount = Iterations)]
+        public static void IsInternedContended()
+        {
+            bool result = true;
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    result &= RunOnThreads(IsInternedAll, Benchmark.InnerIterationCount);
+                }
+            }
+            Consume(result);
+        }
+
+        public static int Main()
+        {
+            bool result = RunOnThreads(InternAll, Iterations) & RunOnThreads(IsInternedAll, Iterations);
+            return result ? 100 : -1;
+        }
+    }
+}
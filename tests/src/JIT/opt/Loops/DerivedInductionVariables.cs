@@ -0,0 +1,201 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Test for strength reduction of multiplications of loop iterators
+// ("i * m" with m constant or loop invariant) into derived induction variables,
+// and of array walks bounded by the array length into pointer increments.
+// Expected values are computed in closed form, not by loops of the same shape.
+
+using System;
+using System.Runtime.CompilerServices;
+
+namespace N
+{
+    public static class C
+    {
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int RowSums(int[] a, int rows, int cols)
+        {
+            int sum = 0;
+            for (int i = 0; i < rows; i++)
+            {
+                int rowStart = i * cols;
+                sum += a[rowStart] - a[rowStart + cols - 1];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int ScaledSum(int n)
+        {
+            int sum = 0;
+            for (int i = 0; i < n; i += 3)
+            {
+                sum += i * 7 + i * 7;
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int DownwardSum(int n, int m)
+        {
+            int sum = 0;
+            for (int i = n; i > 0; i -= 2)
+            {
+                sum += i * m;
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int WrappingSum(int n)
+        {
+            // i * 1000003 overflows int; the derived IV must wrap the same way.
+            int sum = 0;
+            for (int i = 0; i < n; i++)
+            {
+                sum ^= i * 1000003;
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int MultiplierChangesInLoop(int n, int m)
+        {
+            int sum = 0;
+            for (int i = 0; i < n; i++)
+            {
+                sum += i * m;
+                m++;
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumBytes(byte[] a)
+        {
+            int sum = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumEvenLongs(long[] a)
+        {
+            long sum = 0;
+            for (int i = 0; i < a.Length; i += 2)
+            {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumEveryThirdLong(long[] a)
+        {
+            // A pointer stepped by 3 longs could end up past the array; this loop keeps its index.
+            long sum = 0;
+            for (int i = 0; i < a.Length; i += 3)
+            {
+                sum += a[i];
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static void ScaleInPlace(int[] a, int k)
+        {
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = a[i] * k;
+
+                // The array may move while the loop holds a pointer into it.
+                if ((i & 127) == 0)
+                {
+                    GC.Collect();
+                }
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CountChar(string s, char c)
+        {
+            int count = 0;
+            for (int i = 0; i < s.Length; i++)
+            {
+                if (s[i] == c)
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        public static int Main()
+        {
+            bool ok = true;
+
+            int[] a = new int[12 * 13];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = i * i;
+            }
+            // sum over r of (r*c)^2 - (r*c + c - 1)^2
+            int rows = 12, cols = 13;
+            ok &= (RowSums(a, rows, cols) == -(cols - 1) * (cols * rows * (rows - 1) + rows * (cols - 1)));
+
+            // 14 * (0 + 3 + ... + 99) = 14 * 3 * (33 * 34 / 2)
+            ok &= (ScaledSum(100) == 14 * 3 * (33 * 34 / 2));
+
+            // 5 * (101 + 99 + ... + 1) = 5 * 51 * 51
+            ok &= (DownwardSum(101, 5) == 5 * 51 * 51);
+
+            int expectedWrap = 0;
+            for (long i = 0; i < 5000; i++) expectedWrap ^= unchecked((int)(i * 1000003));
+            ok &= (WrappingSum(5000) == expectedWrap);
+
+            // sum of i * (4 + i) for i < 50 = 4 * (49 * 50 / 2) + 49 * 50 * 99 / 6
+            ok &= (MultiplierChangesInLoop(50, 4) == 4 * (49 * 50 / 2) + 49 * 50 * 99 / 6);
+
+            byte[] bytes = new byte[1000];
+            for (int i = 0; i < bytes.Length; i++)
+            {
+                bytes[i] = (byte)i;
+            }
+            // three full runs of 0..255, then 0..231
+            ok &= (SumBytes(bytes) == 3 * (255 * 256 / 2) + 231 * 232 / 2);
+            ok &= (SumBytes(new byte[0]) == 0);
+
+            long[] longs = new long[1001];
+            for (int i = 0; i < longs.Length; i++)
+            {
+                longs[i] = i;
+            }
+            // 0 + 2 + ... + 1000, and 0 + 3 + ... + 999
+            ok &= (SumEvenLongs(longs) == 2 * (500 * 501 / 2));
+            ok &= (SumEveryThirdLong(longs) == 3 * (333 * 334 / 2));
+
+            int[] ints = new int[777];
+            for (int i = 0; i < ints.Length; i++)
+            {
+                ints[i] = i;
+            }
+            ScaleInPlace(ints, 7);
+            long scaledSum = 0;
+            foreach (int v in ints)
+            {
+                scaledSum += v;
+            }
+            ok &= (scaledSum == 7 * (776 * 777 / 2));
+            ok &= (ints[776] == 7 * 776);
+
+            ok &= (CountChar("a strength reduced walk over a string", 'r') == 4);
+
+            return ok ? 100 : -1;
+        }
+    }
+}
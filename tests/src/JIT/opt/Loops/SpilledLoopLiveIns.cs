@@ -0,0 +1,114 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Test for lclVars that are spilled on the path leading into a loop (e.g. across a call
+// on a rarely taken path) and are given a register again on entry to the loop header.
+
+using System;
+using System.Runtime.CompilerServices;
+
+namespace N
+{
+    public static class C
+    {
+        static int s_calls;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static void Log(int value)
+        {
+            s_calls += value;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long Sum(int[] a, int b, int c, int d, int e, bool log)
+        {
+            int f = b * c;
+            int g = d ^ e;
+            if (log)
+            {
+                // Rarely taken; the call kills the callee-trash registers.
+                Log(b + c + d + e);
+            }
+
+            long sum = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                sum += a[i] * b + c - d + (e & a[i]) + f - g;
+            }
+            return sum + b + c + d + e;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static double SumDouble(double[] a, double x, double y, bool log)
+        {
+            double z = x * y;
+            if (log)
+            {
+                Log((int)z);
+            }
+
+            double sum = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                sum += a[i] * x + y - z;
+            }
+            return sum;
+        }
+
+        static long SumReference(int[] a, int b, int c, int d, int e)
+        {
+            int f = b * c;
+            int g = d ^ e;
+            long sum = 0;
+            foreach (int v in a)
+            {
+                sum += v * b + c - d + (e & v) + f - g;
+            }
+            return sum + b + c + d + e;
+        }
+
+        public static int Main()
+        {
+            bool ok = true;
+            int[] a = new int[100];
+            double[] da = new double[100];
+            for (int i = 0; i < a.Length; i++)
+            {
+                a[i] = i * 3 - 50;
+                da[i] = i * 0.5;
+            }
+
+            long expected = SumReference(a, 3, 5, 7, 11);
+            for (int iter = 0; iter < 10; iter++)
+            {
+                bool log = (iter % 5) == 0;
+                if (Sum(a, 3, 5, 7, 11, log) != expected)
+                {
+                    Console.WriteLine("Sum failed (log = {0})", log);
+                    ok = false;
+                }
+
+                double expectedDouble = 0;
+                foreach (double v in da)
+                {
+                    expectedDouble += v * 2.0 + 3.0 - 6.0;
+                }
+                if (SumDouble(da, 2.0, 3.0, log) != expectedDouble)
+                {
+                    Console.WriteLine("SumDouble failed (log = {0})", log);
+                    ok = false;
+                }
+            }
+
+            if (s_calls != 2 * (3 + 5 + 7 + 11) + 2 * 6)
+            {
+                Console.WriteLine("Unexpected number of calls: {0}", s_calls);
+                ok = false;
+            }
+
+            Console.WriteLine(ok ? "Passed" : "Failed");
+            return ok ? 100 : -1;
+        }
+    }
+}
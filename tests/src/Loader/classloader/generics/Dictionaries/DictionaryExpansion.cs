@@ -0,0 +1,430 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Shared generic code that performs more runtime lookups than fit in the initial
+// dictionary layout causes the layout, and the dictionaries allocated against it,
+// to be expanded. Check that lookups stay correct:
+//  - through deep hierarchies, where derived types hold copies of their parents'
+//    dictionary pointers,
+//  - for derived types loaded before and after an expansion,
+//  - while several threads perform lookups that trigger expansions concurrently,
+//  - in generic method dictionaries.
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+public class W00<T> { }
+public class W01<T> { }
+public class W02<T> { }
+public class W03<T> { }
+public class W04<T> { }
+public class W05<T> { }
+public class W06<T> { }
+public class W07<T> { }
+public class W08<T> { }
+public class W09<T> { }
+public class W10<T> { }
+public class W11<T> { }
+public class W12<T> { }
+public class W13<T> { }
+public class W14<T> { }
+public class W15<T> { }
+public class W16<T> { }
+public class W17<T> { }
+public class W18<T> { }
+public class W19<T> { }
+public class W20<T> { }
+public class W21<T> { }
+public class W22<T> { }
+public class W23<T> { }
+public class W24<T> { }
+public class W25<T> { }
+public class W26<T> { }
+public class W27<T> { }
+public class W28<T> { }
+public class W29<T> { }
+public class W30<T> { }
+public class W31<T> { }
+public class W32<T> { }
+public class W33<T> { }
+public class W34<T> { }
+public class W35<T> { }
+public class W36<T> { }
+public class W37<T> { }
+public class W38<T> { }
+public class W39<T> { }
+
+public class Base<T>
+{
+    // Only needs the first slot, so it can be used to load types without expanding anything
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public Type First()
+    {
+        return typeof(W00<T>);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public Type[] Lookups()
+    {
+        return new Type[]
+        {
+            typeof(W00<T>),
+            typeof(W01<T>),
+            typeof(W02<T>),
+            typeof(W03<T>),
+            typeof(W04<T>),
+            typeof(W05<T>),
+            typeof(W06<T>),
+            typeof(W07<T>),
+            typeof(W08<T>),
+            typeof(W09<T>),
+            typeof(W10<T>),
+            typeof(W11<T>),
+            typeof(W12<T>),
+            typeof(W13<T>),
+            typeof(W14<T>),
+            typeof(W15<T>),
+            typeof(W16<T>),
+            typeof(W17<T>),
+            typeof(W18<T>),
+            typeof(W19<T>),
+            typeof(W20<T>),
+            typeof(W21<T>),
+            typeof(W22<T>),
+            typeof(W23<T>),
+            typeof(W24<T>),
+            typeof(W25<T>),
+            typeof(W26<T>),
+            typeof(W27<T>),
+            typeof(W28<T>),
+            typeof(W29<T>),
+            typeof(W30<T>),
+            typeof(W31<T>),
+            typeof(W32<T>),
+            typeof(W33<T>),
+            typeof(W34<T>),
+            typeof(W35<T>),
+            typeof(W36<T>),
+            typeof(W37<T>),
+            typeof(W38<T>),
+            typeof(W39<T>)
+        };
+    }
+}
+
+public class Mid1<T> : Base<T> { }
+public class Mid2<T> : Mid1<T> { }
+public class Mid3<T> : Mid2<T> { }
+public class Mid4<T> : Mid3<T> { }
+public class Mid5<T> : Mid4<T> { }
+public class Mid6<T> : Mid5<T> { }
+public class Mid7<T, U> : Mid6<T> { }
+public class LeafLoadedBefore : Mid7<string, int> { }
+public class LeafLoadedAfter : Mid7<string, object> { }
+
+// A separate hierarchy with its own layout, expanded for the first time by several threads at once
+public class ConcurrentBase<T>
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public Type[] Lookups()
+    {
+        return new Type[]
+        {
+            typeof(W00<T>),
+            typeof(W01<T>),
+            typeof(W02<T>),
+            typeof(W03<T>),
+            typeof(W04<T>),
+            typeof(W05<T>),
+            typeof(W06<T>),
+            typeof(W07<T>),
+            typeof(W08<T>),
+            typeof(W09<T>),
+            typeof(W10<T>),
+            typeof(W11<T>),
+            typeof(W12<T>),
+            typeof(W13<T>),
+            typeof(W14<T>),
+            typeof(W15<T>),
+            typeof(W16<T>),
+            typeof(W17<T>),
+            typeof(W18<T>),
+            typeof(W19<T>),
+            typeof(W20<T>),
+            typeof(W21<T>),
+            typeof(W22<T>),
+            typeof(W23<T>),
+            typeof(W24<T>),
+            typeof(W25<T>),
+            typeof(W26<T>),
+            typeof(W27<T>),
+            typeof(W28<T>),
+            typeof(W29<T>),
+            typeof(W30<T>),
+            typeof(W31<T>),
+            typeof(W32<T>),
+            typeof(W33<T>),
+            typeof(W34<T>),
+            typeof(W35<T>),
+            typeof(W36<T>),
+            typeof(W37<T>),
+            typeof(W38<T>),
+            typeof(W39<T>)
+        };
+    }
+}
+
+public class ConcurrentMid<T> : ConcurrentBase<T> { }
+public class ConcurrentLeaf<T> : ConcurrentMid<T> { }
+
+public static class GenericMethods
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    public static Type[] Lookups<T>()
+    {
+        return new Type[]
+        {
+            typeof(W00<T>),
+            typeof(W01<T>),
+            typeof(W02<T>),
+            typeof(W03<T>),
+            typeof(W04<T>),
+            typeof(W05<T>),
+            typeof(W06<T>),
+            typeof(W07<T>),
+            typeof(W08<T>),
+            typeof(W09<T>),
+            typeof(W10<T>),
+            typeof(W11<T>),
+            typeof(W12<T>),
+            typeof(W13<T>),
+            typeof(W14<T>),
+            typeof(W15<T>),
+            typeof(W16<T>),
+            typeof(W17<T>),
+            typeof(W18<T>),
+            typeof(W19<T>),
+            typeof(W20<T>),
+            typeof(W21<T>),
+            typeof(W22<T>),
+            typeof(W23<T>),
+            typeof(W24<T>),
+            typeof(W25<T>),
+            typeof(W26<T>),
+            typeof(W27<T>),
+            typeof(W28<T>),
+            typeof(W29<T>),
+            typeof(W30<T>),
+            typeof(W31<T>),
+            typeof(W32<T>),
+            typeof(W33<T>),
+            typeof(W34<T>),
+            typeof(W35<T>),
+            typeof(W36<T>),
+            typeof(W37<T>),
+            typeof(W38<T>),
+            typeof(W39<T>)
+        };
+    }
+}
+
+public class DictionaryExpansion
+{
+    static readonly Type[] s_definitions = new Type[]
+    {
+        typeof(W00<>),
+        typeof(W01<>),
+        typeof(W02<>),
+        typeof(W03<>),
+        typeof(W04<>),
+        typeof(W05<>),
+        typeof(W06<>),
+        typeof(W07<>),
+        typeof(W08<>),
+        typeof(W09<>),
+        typeof(W10<>),
+        typeof(W11<>),
+        typeof(W12<>),
+        typeof(W13<>),
+        typeof(W14<>),
+        typeof(W15<>),
+        typeof(W16<>),
+        typeof(W17<>),
+        typeof(W18<>),
+        typeof(W19<>),
+        typeof(W20<>),
+        typeof(W21<>),
+        typeof(W22<>),
+        typeof(W23<>),
+        typeof(W24<>),
+        typeof(W25<>),
+        typeof(W26<>),
+        typeof(W27<>),
+        typeof(W28<>),
+        typeof(W29<>),
+        typeof(W30<>),
+        typeof(W31<>),
+        typeof(W32<>),
+        typeof(W33<>),
+        typeof(W34<>),
+        typeof(W35<>),
+        typeof(W36<>),
+        typeof(W37<>),
+        typeof(W38<>),
+        typeof(W39<>)
+    };
+
+    static int s_failures;
+
+    static void Check(string scenario, Type[] actual, Type typeArg)
+    {
+        if (actual.Length != s_definitions.Length)
+        {
+            Fail(scenario, "wrong number of lookups");
+            return;
+        }
+
+        for (int i = 0; i < s_definitions.Length; i++)
+        {
+            Type expected = s_definitions[i].MakeGenericType(typeArg);
+            if (actual[i] != expected)
+            {
+                Fail(scenario, String.Format("lookup {0} returned {1}, expected {2}", i, actual[i], expected));
+                return;
+            }
+        }
+    }
+
+    static void Fail(string scenario, string message)
+    {
+        if (Interlocked.Increment(ref s_failures) <= 10)
+        {
+            Console.WriteLine("FAILED: {0}: {1}", scenario, message);
+        }
+    }
+
+    static void DeepHierarchy()
+    {
+        // Load derived types and fill the first slot of their dictionaries before the layout is expanded
+        var before = new Base<string>[]
+        {
+            new Mid3<string>(),
+            new Mid6<string>(),
+            new LeafLoadedBefore(),
+        };
+        foreach (Base<string> obj in before)
+        {
+            if (obj.First() != typeof(W00<string>))
+                Fail("DeepHierarchy", obj.GetType() + " before expansion");
+        }
+
+        // Expands the shared layout and the dictionary of Base<string>
+        Check("Base<string>", new Base<string>().Lookups(), typeof(string));
+
+        // Types loaded before the expansion still point at the old dictionaries
+        foreach (Base<string> obj in before)
+        {
+            Check(obj.GetType() + " loaded before expansion", obj.Lookups(), typeof(string));
+        }
+
+        // Types loaded after the expansion copy the expanded dictionaries
+        var after = new Base<string>[]
+        {
+            new Mid1<string>(),
+            new Mid5<string>(),
+            new Mid7<string, string>(),
+            new LeafLoadedAfter(),
+        };
+        foreach (Base<string> obj in after)
+        {
+            Check(obj.GetType() + " loaded after expansion", obj.Lookups(), typeof(string));
+        }
+
+        // Other instantiations sharing the expanded layout get dictionaries of the new size
+        Check("Mid6<object>", new Mid6<object>().Lookups(), typeof(object));
+        Check("Mid7<Exception, int>", new Mid7<Exception, int>().Lookups(), typeof(Exception));
+    }
+
+    static void ConcurrentExpansion()
+    {
+        Func<ConcurrentBase<string>>[] stringFactories =
+        {
+            () => new ConcurrentBase<string>(),
+            () => new ConcurrentMid<string>(),
+            () => new ConcurrentLeaf<string>(),
+        };
+        Func<ConcurrentBase<object>>[] objectFactories =
+        {
+            () => new ConcurrentBase<object>(),
+            () => new ConcurrentMid<object>(),
+            () => new ConcurrentLeaf<object>(),
+        };
+
+        int threadCount = Math.Max(4, Environment.ProcessorCount);
+        var barrier = new Barrier(threadCount);
+        var threads = new Thread[threadCount];
+        for (int t = 0; t < threadCount; t++)
+        {
+            int id = t;
+            threads[t] = new Thread(() =>
+            {
+                barrier.SignalAndWait();
+                for (int i = 0; i < 100; i++)
+                {
+                    switch ((id + i) % 3)
+                    {
+                        case 0:
+                            ConcurrentBase<string> s = stringFactories[(id + i) % stringFactories.Length]();
+                            Check(s.GetType().ToString(), s.Lookups(), typeof(string));
+                            break;
+                        case 1:
+                            ConcurrentBase<object> o = objectFactories[(id + i) % objectFactories.Length]();
+                            Check(o.GetType().ToString(), o.Lookups(), typeof(object));
+                            break;
+                        default:
+                            Check("GenericMethods.Lookups<Version>", GenericMethods.Lookups<Version>(), typeof(Version));
+                            break;
+                    }
+                }
+            });
+            threads[t].Start();
+        }
+
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+    }
+
+    static void MethodDictionaries()
+    {
+        Check("GenericMethods.Lookups<string>", GenericMethods.Lookups<string>(), typeof(string));
+        Check("GenericMethods.Lookups<object>", GenericMethods.Lookups<object>(), typeof(object));
+        Check("GenericMethods.Lookups<Exception>", GenericMethods.Lookups<Exception>(), typeof(Exception));
+    }
+
+    public static int Main()
+    {
+        // Run everything more than once so that both the slow paths filling the slots and the
+        // fast paths reading them are exercised, and so that methods get promoted when tiering
+        // is enabled
+        for (int i = 0; i < 3; i++)
+        {
+            DeepHierarchy();
+            ConcurrentExpansion();
+            MethodDictionaries();
+        }
+
+        if (s_failures != 0)
+        {
+            Console.WriteLine("FAILED: {0} incorrect lookups", s_failures);
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,155 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Casts that the non-framed casting helpers cannot decide (variance, arrays
+// cast to generic interfaces, shared generic code) are resolved by the slow
+// path and remembered in the runtime's cast cache. Run many such casts from
+// several threads at once, with more distinct (type, target) pairs than fit
+// without collisions, and check that every answer is still correct while
+// cache entries are being filled and replaced concurrently.
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+public interface IProducer<out T> { }
+public interface IConsumer<in T> { }
+public class Producer<T> : IProducer<T> { }
+public class Consumer<T> : IConsumer<T> { }
+
+public class Base { }
+public class Derived : Base { }
+public class MoreDerived : Derived { }
+
+public class ConcurrentCasts
+{
+    const int Iterations = 10000;
+
+    struct Case
+    {
+        public object Obj;
+        public Func<object, bool> IsInst;
+        public Func<object, bool> CastClass;
+        public bool Expected;
+        public string Name;
+    }
+
+    static Case Make<T>(object obj, bool expected, string name) where T : class
+    {
+        return new Case
+        {
+            Obj = obj,
+            IsInst = IsInstanceOf<T>,
+            CastClass = CastSucceeds<T>,
+            Expected = expected,
+            Name = name,
+        };
+    }
+
+    // Shared generic code goes through the IsInstanceOfAny/ChkCastAny helpers
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool IsInstanceOf<T>(object obj) where T : class
+    {
+        return obj is T;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool CastSucceeds<T>(object obj) where T : class
+    {
+        try
+        {
+            T t = (T)obj;
+            return t != null;
+        }
+        catch (InvalidCastException)
+        {
+            return false;
+        }
+    }
+
+    static Case[] BuildCases()
+    {
+        var cases = new List<Case>
+        {
+            Make<IEnumerable<object>>(new List<string>(), true, "List<string> -> IEnumerable<object>"),
+            Make<IEnumerable<object>>(new List<int>(), false, "List<int> -> IEnumerable<object>"),
+            Make<IList<object>>(new string[1], true, "string[] -> IList<object>"),
+            Make<IList<object>>(new int[1], false, "int[] -> IList<object>"),
+            Make<IReadOnlyList<Base>>(new Derived[1], true, "Derived[] -> IReadOnlyList<Base>"),
+            Make<IReadOnlyList<Derived>>(new Base[1], false, "Base[] -> IReadOnlyList<Derived>"),
+            Make<Func<object>>(new Func<string>(() => null), true, "Func<string> -> Func<object>"),
+            Make<Func<object>>(new Func<int>(() => 0), false, "Func<int> -> Func<object>"),
+            Make<Action<string>>(new Action<object>(o => { }), true, "Action<object> -> Action<string>"),
+            Make<Action<object>>(new Action<string>(s => { }), false, "Action<string> -> Action<object>"),
+        };
+
+        // Many distinct pairs so that cache entries collide and get replaced while other threads read them
+        cases.Add(Make<IProducer<Base>>(new Producer<Derived>(), true, "Producer<Derived> -> IProducer<Base>"));
+        cases.Add(Make<IProducer<Base>>(new Producer<MoreDerived>(), true, "Producer<MoreDerived> -> IProducer<Base>"));
+        cases.Add(Make<IProducer<Derived>>(new Producer<Base>(), false, "Producer<Base> -> IProducer<Derived>"));
+        cases.Add(Make<IProducer<object>>(new Producer<string>(), true, "Producer<string> -> IProducer<object>"));
+        cases.Add(Make<IProducer<object>>(new Producer<int>(), false, "Producer<int> -> IProducer<object>"));
+        cases.Add(Make<IProducer<Exception>>(new Producer<ArgumentException>(), true, "Producer<ArgumentException> -> IProducer<Exception>"));
+        cases.Add(Make<IProducer<Exception>>(new Producer<string>(), false, "Producer<string> -> IProducer<Exception>"));
+        cases.Add(Make<IConsumer<Derived>>(new Consumer<Base>(), true, "Consumer<Base> -> IConsumer<Derived>"));
+        cases.Add(Make<IConsumer<MoreDerived>>(new Consumer<Base>(), true, "Consumer<Base> -> IConsumer<MoreDerived>"));
+        cases.Add(Make<IConsumer<Base>>(new Consumer<Derived>(), false, "Consumer<Derived> -> IConsumer<Base>"));
+        cases.Add(Make<IConsumer<string>>(new Consumer<object>(), true, "Consumer<object> -> IConsumer<string>"));
+        cases.Add(Make<IConsumer<object>>(new Consumer<string>(), false, "Consumer<string> -> IConsumer<object>"));
+        cases.Add(Make<IConsumer<ArgumentException>>(new Consumer<Exception>(), true, "Consumer<Exception> -> IConsumer<ArgumentException>"));
+        cases.Add(Make<IConsumer<Exception>>(new Consumer<ArgumentException>(), false, "Consumer<ArgumentException> -> IConsumer<Exception>"));
+
+        return cases.ToArray();
+    }
+
+    public static int Main()
+    {
+        Case[] cases = BuildCases();
+        int threadCount = Math.Max(4, Environment.ProcessorCount);
+        int failures = 0;
+
+        var threads = new Thread[threadCount];
+        for (int t = 0; t < threadCount; t++)
+        {
+            int seed = t;
+            threads[t] = new Thread(() =>
+            {
+                // Each thread walks the cases in a different order so that fills and lookups of the same entry overlap
+                int index = seed;
+                for (int i = 0; i < Iterations; i++)
+                {
+                    index = (index + 7 + seed) % cases.Length;
+                    Case c = cases[index];
+
+                    if (c.IsInst(c.Obj) != c.Expected || c.CastClass(c.Obj) != c.Expected)
+                    {
+                        if (Interlocked.Increment(ref failures) <= 10)
+                        {
+                            Console.WriteLine("FAILED: {0}, expected {1}", c.Name, c.Expected);
+                        }
+                    }
+                }
+            });
+        }
+
+        foreach (Thread thread in threads)
+        {
+            thread.Start();
+        }
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+
+        if (failures != 0)
+        {
+            Console.WriteLine("FAILED: {0} incorrect cast results", failures);
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
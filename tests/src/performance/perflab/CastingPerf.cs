@@ -389,5 +389,56 @@ namespace PerfLabTests
                         res = arr is IMyInterface1[];
             return res;
         }
+
+        // The casts below cannot be decided by the non-framed casting helpers and are answered from the
+        // runtime's cast cache after the first call
+
+        [Benchmark(InnerIterationCount = 100000)]
+        public static bool CheckIsInstVariantInterfaceYes()
+        {
+            bool res = false;
+            Object obj = new List<string>();
+            foreach (var iteration in Benchmark.Iterations)
+                using (iteration.StartMeasurement())
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                        res = obj is IEnumerable<object>;
+            return res;
+        }
+
+        [Benchmark(InnerIterationCount = 100000)]
+        public static bool CheckIsInstVariantInterfaceNo()
+        {
+            bool res = false;
+            Object obj = new List<int>();
+            foreach (var iteration in Benchmark.Iterations)
+                using (iteration.StartMeasurement())
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                        res = obj is IEnumerable<object>;
+            return res;
+        }
+
+        [Benchmark(InnerIterationCount = 100000)]
+        public static IEnumerable<object> CastVariantInterface()
+        {
+            IEnumerable<object> res = null;
+            Object obj = new List<string>();
+            foreach (var iteration in Benchmark.Iterations)
+                using (iteration.StartMeasurement())
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                        res = (IEnumerable<object>)obj;
+            return res;
+        }
+
+        [Benchmark(InnerIterationCount = 100000)]
+        public static bool CheckArrayIsGenericInterface()
+        {
+            bool res = false;
+            Object obj = new string[5];
+            foreach (var iteration in Benchmark.Iterations)
+                using (iteration.StartMeasurement())
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                        res = obj is IList<object>;
+            return res;
+        }
     }
 }
\ No newline at end of file
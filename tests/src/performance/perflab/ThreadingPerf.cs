@@ -3,6 +3,8 @@
 
 using Microsoft.Xunit.Performance;
 using System;
+using System.Reflection;
+using System.Runtime.InteropServices;
 using System.Threading;
 
 namespace PerfLabTests
@@ -74,4 +76,150 @@ namespace PerfLabTests
                         Interlocked.Decrement(ref s_i);
         }
     }
+
+    public class Timers
+    {
+        private static readonly TimerCallback s_callback = state => { };
+
+        [Benchmark(InnerIterationCount = 1000000)]
+        public static void CreateAndDispose()
+        {
+            foreach (var iteration in Benchmark.Iterations)
+                using (iteration.StartMeasurement())
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                        using (new Timer(s_callback, null, 60000, Timeout.Infinite)) { }
+        }
+
+        [Benchmark(InnerIterationCount = 1000000)]
+        public static void CreateManyThenDispose()
+        {
+            Timer[] timers = new Timer[Benchmark.InnerIterationCount];
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < timers.Length; i++)
+                        timers[i] = new Timer(s_callback, null, 60000 + i % 1000, Timeout.Infinite);
+                    for (int i = 0; i < timers.Length; i++)
+                        timers[i].Dispose();
+                }
+            }
+        }
+    }
+
+    public class ThreadChurn
+    {
+        private static readonly ThreadStart s_work = () => { };
+
+        // Reads the counters that sum per-thread counts over the thread list while
+        // other threads keep starting and joining short-lived threads and triggering
+        // gen0 GCs, so the walks race with threads being added, removed and deleted.
+        [Benchmark(InnerIterationCount = 10000)]
+        public static void ReadThreadCountersUnderChurn()
+        {
+            const int ChurnThreads = 4;
+            bool done = false;
+            long sink = 0;
+
+            Thread churner = new Thread(() =>
+            {
+                Thread[] threads = new Thread[ChurnThreads];
+                while (!Volatile.Read(ref done))
+                {
+                    for (int j = 0; j < threads.Length; j++)
+                    {
+                        threads[j] = new Thread(s_work);
+                        threads[j].Start();
+                    }
+                    for (int j = 0; j < threads.Length; j++)
+                        threads[j].Join();
+                }
+            });
+            churner.Start();
+
+            Thread collector = new Thread(() =>
+            {
+                while (!Volatile.Read(ref done))
+                {
+                    GC.Collect(0);
+                    Thread.Sleep(1);
+                }
+            });
+            collector.Start();
+
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                    {
+                        sink += Monitor.LockContentionCount;
+                        sink += ThreadPool.CompletedWorkItemCount;
+                    }
+                }
+            }
+
+            Volatile.Write(ref done, true);
+            churner.Join();
+            collector.Join();
+            GC.KeepAlive(sink);
+        }
+    }
+
+    // Managed timers are multiplexed on a handful of native timers, so the Timers benchmarks above never put many
+    // timers in the native timer queue. These benchmarks create native timers directly through the QCalls that
+    // TimerQueue uses, one per call to ThreadpoolMgr::CreateTimerQueueTimer, and delete them by disposing the handle.
+    public class NativeTimers
+    {
+        private static readonly Func<uint, int, SafeHandle> s_createAppDomainTimer = GetCreateAppDomainTimer();
+
+        private static Func<uint, int, SafeHandle> GetCreateAppDomainTimer()
+        {
+            Type timerQueue = typeof(Timer).GetTypeInfo().Assembly.GetType("System.Threading.TimerQueue");
+            MethodInfo create = timerQueue.GetTypeInfo().GetDeclaredMethod("CreateAppDomainTimer");
+            return (Func<uint, int, SafeHandle>)create.CreateDelegate(typeof(Func<uint, int, SafeHandle>));
+        }
+
+        // Timer creation and deletion are queued to the native timer thread. Changing a managed timer is queued behind
+        // them, so once it fires the timer thread has processed everything queued before it.
+        private static void WaitForTimerThread()
+        {
+            using (var fired = new ManualResetEvent(false))
+            using (new Timer(state => ((ManualResetEvent)state).Set(), fired, 0, Timeout.Infinite))
+                fired.WaitOne();
+        }
+
+        [Benchmark(InnerIterationCount = 100000)]
+        public static void CreateAndDelete()
+        {
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    for (int i = 0; i < Benchmark.InnerIterationCount; i++)
+                        s_createAppDomainTimer(60000, 0).Dispose();
+                    WaitForTimerThread();
+                }
+            }
+        }
+
+        [Benchmark(InnerIterationCount = 100000)]
+        public static void CreateManyThenDelete()
+        {
+            SafeHandle[] timers = new SafeHandle[Benchmark.InnerIterationCount];
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                using (iteration.StartMeasurement())
+                {
+                    // Spread the due times so that the timers land on several levels of the timing wheel
+                    for (int i = 0; i < timers.Length; i++)
+                        timers[i] = s_createAppDomainTimer(60000 + (uint)i * 97, 0);
+                    WaitForTimerThread();
+                    for (int i = 0; i < timers.Length; i++)
+                        timers[i].Dispose();
+                    WaitForTimerThread();
+                }
+            }
+        }
+    }
 }
\ No newline at end of file
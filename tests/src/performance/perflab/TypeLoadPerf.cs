@@ -0,0 +1,70 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.Xunit.Performance;
+
+namespace PerfLabTests
+{
+    public class TypeLoad
+    {
+        private const int LookupThreads = 4;
+
+        private static readonly Type[] s_args = new Type[]
+        {
+            typeof(byte), typeof(sbyte), typeof(short), typeof(ushort), typeof(int), typeof(uint),
+            typeof(long), typeof(ulong), typeof(float), typeof(double), typeof(char), typeof(bool),
+            typeof(string), typeof(object), typeof(decimal), typeof(DateTime),
+        };
+
+        private static int s_iteration;
+
+        // Looks up generic instantiations that are already loaded from several threads at once while another
+        // thread keeps loading brand new ones, so the lookups race with growth of the loader's hash tables.
+        [Benchmark(InnerIterationCount = 2000)]
+        public static void MakeGenericTypeWhileLoading()
+        {
+            Type[] loaded = new Type[s_args.Length * s_args.Length];
+            for (int i = 0; i < s_args.Length; i++)
+                for (int j = 0; j < s_args.Length; j++)
+                    loaded[i * s_args.Length + j] = typeof(Dictionary<,>).MakeGenericType(s_args[i], s_args[j]);
+
+            foreach (var iteration in Benchmark.Iterations)
+            {
+                // Every iteration picks a different pair of arguments for the outer type so the loader thread creates new
+                // types. The pairs repeat after s_args.Length^2 iterations, which bounds the number of types loaded.
+                int pair = s_iteration++ % (s_args.Length * s_args.Length);
+                Type outer = typeof(List<>).MakeGenericType(
+                    typeof(Tuple<,>).MakeGenericType(s_args[pair / s_args.Length], s_args[pair % s_args.Length]));
+
+                using (iteration.StartMeasurement())
+                {
+                    Task loader = Task.Run(() =>
+                    {
+                        for (int i = 0; i < s_args.Length; i++)
+                            for (int j = 0; j < s_args.Length; j++)
+                                typeof(KeyValuePair<,>).MakeGenericType(outer, typeof(Tuple<,>).MakeGenericType(s_args[i], s_args[j]));
+                    });
+
+                    Task[] lookups = new Task[LookupThreads];
+                    for (int t = 0; t < LookupThreads; t++)
+                    {
+                        lookups[t] = Task.Run(() =>
+                        {
+                            for (int n = 0; n < Benchmark.InnerIterationCount; n++)
+                                for (int i = 0; i < s_args.Length; i++)
+                                    if (typeof(Dictionary<,>).MakeGenericType(s_args[i], s_args[n % s_args.Length]) != loaded[i * s_args.Length + n % s_args.Length])
+                                        throw new InvalidOperationException();
+                        });
+                    }
+
+                    loader.Wait();
+                    Task.WaitAll(lookups);
+                }
+            }
+        }
+    }
+}